@@ -0,0 +1,52 @@
+// Serves the OTA interface through ESPAsyncWebServer. The library has to be
+// built with the same flag, e.g. in platformio.ini:
+//
+//   build_flags = -D ESP32FW_ASYNC_WEBSERVER
+//   lib_deps = esphome/ESPAsyncWebServer-esphome
+//
+// Flash this sketch and BasicOTA in turn and push the same image to each with
+// tools/fleet_push, then compare the reported throughput and /ota/metrics to
+// see what the transport changes on your board and network.
+#if !defined(ESP32FW_ASYNC_WEBSERVER)
+  #error "Build with -D ESP32FW_ASYNC_WEBSERVER"
+#endif
+
+#include <WiFi.h>
+#include <ESPAsyncWebServer.h>
+#include <ESP32FwUploader.h>
+
+const char* ssid = "your_wifi_ssid";
+const char* password = "your_wifi_password";
+
+AsyncWebServer server(80);
+
+void setup() {
+  Serial.begin(115200);
+  
+  // Connect to WiFi
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED) {
+    delay(1000);
+    Serial.println("Connecting to WiFi...");
+  }
+  
+  Serial.println("WiFi connected!");
+  Serial.print("IP address: ");
+  Serial.println(WiFi.localIP());
+  
+  ESP32FwUploader.setDebug(true);
+  ESP32FwUploader.onError([](ESP32Fw_Error error, const String& message) {
+    Serial.printf("OTA Error %d: %s\n", error, message.c_str());
+  });
+  ESP32FwUploader.begin(&server);
+  
+  // Start web server; requests are handled in the background
+  server.begin();
+  Serial.println("Web server started");
+  Serial.println("Open http://" + WiFi.localIP().toString() + "/update to access OTA interface");
+}
+
+void loop() {
+  // Still needed for reboots, session timeouts, pull updates and debug output
+  ESP32FwUploader.loop();
+}
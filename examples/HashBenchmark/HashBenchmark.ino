@@ -0,0 +1,82 @@
+#include <ESP32FwUploader.h>
+
+// Measures what upload verification costs: the digests and the streaming
+// signature check run once per received chunk, the signature itself is
+// checked once at the end. The web server hands uploads over in 1436 byte
+// chunks on ESP32 (2048 on ESP8266); compare the numbers with the time a
+// chunk takes to arrive over WiFi (about 1 ms at 1.4 MB/s).
+
+const size_t chunkSize = 1436;
+const int chunkCount = 1024;
+uint8_t chunk[chunkSize];
+
+// Public key and signature of the benchmark data (chunkCount copies of
+// chunk), made with tools/sign_firmware.py
+const char* signingKey =
+  "-----BEGIN PUBLIC KEY-----\n"
+  "MFkwEwYHKoZIzj0CAQYIKoZIzj0DAQcDQgAEcrl3K2OJZxFTaguDRTUhUfySHa0S\n"
+  "vRZTL9/1GGs/+cDL9hiUy8ih77YaaulRZdPo3Hx6EiLz6BD3srAm4/3VqQ==\n"
+  "-----END PUBLIC KEY-----\n";
+uint8_t trailer[] = {
+  0x30, 0x46, 0x02, 0x21, 0x00, 0xfd, 0x4d, 0x07, 0xeb, 0x79, 0xcd, 0x73,
+  0x6d, 0x43, 0xfc, 0x6d, 0xc8, 0xa3, 0xc5, 0x4e, 0xe3, 0xc8, 0x16, 0xcf,
+  0xc8, 0x59, 0x62, 0x78, 0x70, 0xee, 0x25, 0xf8, 0xcc, 0xf4, 0x32, 0x2f,
+  0x1c, 0x02, 0x21, 0x00, 0xdb, 0x27, 0x63, 0xe4, 0xeb, 0xba, 0x4c, 0xe6,
+  0x42, 0xd4, 0xe7, 0x6d, 0x50, 0x17, 0xa8, 0xb1, 0x0e, 0xa6, 0x06, 0x9c,
+  0x23, 0x2a, 0x2e, 0x6b, 0x19, 0xfd, 0x0e, 0x2e, 0xaf, 0x42, 0x4f, 0x46,
+  72, 0, 0, 0  // signature length
+};
+
+void report(const char* name, unsigned long elapsedUs) {
+  float perChunk = (float)elapsedUs / chunkCount;
+  float perMB = (float)elapsedUs / 1000.0 * 1048576.0 / (chunkSize * chunkCount);
+  Serial.printf("%-10s %7.1f us/chunk  %7.1f ms/MB\n", name, perChunk, perMB);
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  for (size_t i = 0; i < chunkSize; i++) {
+    chunk[i] = (uint8_t)(i * 31 + 7);
+  }
+  Serial.printf("Processing %d chunks of %d bytes\n", chunkCount, (int)chunkSize);
+  
+  ESP32FwSha256 sha256;
+  uint8_t digest[ESP32FW_SHA256_SIZE];
+  unsigned long start = micros();
+  sha256.begin();
+  for (int i = 0; i < chunkCount; i++) {
+    sha256.update(chunk, chunkSize);
+  }
+  sha256.finish(digest);
+  report("SHA-256", micros() - start);
+  
+  MD5Builder md5;
+  start = micros();
+  md5.begin();
+  for (int i = 0; i < chunkCount; i++) {
+    md5.add(chunk, chunkSize);
+  }
+  md5.calculate();
+  report("MD5", micros() - start);
+  
+  ESP32FwSignatureVerifier verifier;
+  if (!verifier.setKey(signingKey)) {
+    Serial.println("Failed to load the signing key");
+    return;
+  }
+  verifier.begin([](uint8_t* data, size_t len) { return true; });
+  start = micros();
+  for (int i = 0; i < chunkCount; i++) {
+    verifier.write(chunk, chunkSize);
+  }
+  report("Signature", micros() - start);
+  
+  start = micros();
+  verifier.write(trailer, sizeof(trailer));
+  bool verified = verifier.finish();
+  Serial.printf("Signature check at end of upload: %lu us (%s)\n", micros() - start, verified ? "valid" : "INVALID");
+}
+
+void loop() {
+}
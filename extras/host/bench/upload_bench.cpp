@@ -0,0 +1,263 @@
+// Upload throughput on the host model of the device: a whole image sent
+// through /ota/upload (multipart) and /ota/raw over a paced link, into a
+// flash that takes time to erase and program. The figures describe the
+// library on this model, not on a chip; they are for comparing changes.
+//
+//   upload_bench_sync [--quick] [--section NAME] [--size KB] [--link B/s] [--window B] [--erase-us N] [--write-us N]
+#include <ESP32FwUploader.h>
+#include <MD5Builder.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "digest.h"
+#include "signature.h"
+#include "host_sim.h"
+
+#ifndef BENCH_VARIANT
+  #define BENCH_VARIANT "sync"
+#endif
+
+struct Profile {
+  size_t imageSize = 1024 * 1024;
+  uint32_t linkRate = 1000000;      // bytes per second, 0 is instant
+  size_t window = 5744;             // TCP receive window (lwIP default 4 x MSS)
+  uint32_t eraseUs = 10000;         // per 4 KB sector
+  uint32_t writeUs = 100;           // per 256 byte page
+  bool quick = false;
+  const char* section = nullptr;    // run only this section
+};
+
+// One measured upload; the cases of a section differ in one setting
+struct Case {
+  const char* section;
+  bool raw;
+  size_t mss;
+  bool pipelined;
+  size_t block;
+  const char* check;                // expected digests sent with the upload
+};
+
+struct Result {
+  double seconds = 0;
+  uint32_t chunks = 0;
+  uint64_t allocations = 0;
+  uint32_t updateWrites = 0;
+  uint32_t flashWrites = 0;
+  bool ok = false;
+};
+
+static uint32_t jsonCount(const std::string& json, const char* histogram){
+  std::string key = std::string("\"") + histogram + "\":{\"count\":";
+  size_t at = json.find(key);
+  return at == std::string::npos ? 0 : (uint32_t)strtoul(json.c_str() + at + key.size(), nullptr, 10);
+}
+
+static const hostsim::SigningKey& signingKey(){
+  static hostsim::SigningKey key = hostsim::makeSigningKey();
+  return key;
+}
+
+static Result run(const Profile& profile, const Case& c){
+  hostsim::reset();
+  hostsim::setFlashTiming(profile.eraseUs, profile.writeUs);
+  Result result;
+  std::string image = hostsim::makeFirmwareImage(profile.imageSize, 11);
+  bool signedImage = !strcmp(c.check, "signed");
+  std::string body = signedImage ? hostsim::signImage(image, signingKey()) : image;
+  {
+    ESP32FW_WEBSERVER server(80);
+    ESP32FwUploaderClass uploader;
+    uploader.setAutoReboot(false);
+    uploader.setPipelined(c.pipelined);
+    uploader.setWriteBlockSize(c.block);
+    if (signedImage) {
+      uploader.setSigningKey(signingKey().publicPem.c_str());
+    }
+    uploader.begin(&server);
+    hostsim::HttpRequest request = c.raw ? hostsim::HttpRequest::raw("POST", "/ota/raw", body)
+                                       : hostsim::HttpRequest::multipart("POST", "/ota/upload", body);
+    if (strstr(c.check, "sha256")) {
+      request.header("X-Firmware-SHA256", hostsim::sha256Hex(image).c_str());
+    }
+    if (strstr(c.check, "md5")) {
+      request.header("X-Firmware-MD5", hostsim::md5Hex(image).c_str());
+    }
+    hostsim::setLink(profile.linkRate, c.mss, std::max(c.mss, profile.window));
+    hostsim::AllocStats before = hostsim::allocStats();
+    auto start = std::chrono::steady_clock::now();
+    hostsim::HttpExchange exchange = server.serve(request);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.allocations = hostsim::allocStats().allocations - before.allocations;
+    hostsim::setLink(0);
+    result.ok = exchange.code() == 200 && exchange.body() == "OK" &&
+                hostsim::readFlash(hostsim::partition("app1"), 0, image.size()) == image;
+    hostsim::FlashStats flash = hostsim::flashStats();
+    result.updateWrites = hostsim::updateWriteCalls();
+    result.flashWrites = flash.writeCalls;
+    result.chunks = jsonCount(server.serve(hostsim::HttpRequest::get("/ota/metrics")).body(), "chunk_size_bytes");
+  }
+  return result;
+}
+
+// What the digests cost per received chunk, measured on their own
+static void hashCost(const Profile& profile){
+  std::string data = hostsim::makeFileSystemImage(profile.imageSize, 5);
+  const size_t chunk = 1436;
+  size_t chunks = (data.size() + chunk - 1) / chunk;
+  uint8_t digest[ESP32FW_SHA256_SIZE];
+
+  auto start = std::chrono::steady_clock::now();
+  ESP32FwSha256 sha;
+  sha.begin();
+  for (size_t pos = 0; pos < data.size(); pos += chunk) {
+    sha.update((const uint8_t*)data.data() + pos, std::min(chunk, data.size() - pos));
+  }
+  sha.finish(digest);
+  double shaSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  MD5Builder md5;
+  md5.begin();
+  for (size_t pos = 0; pos < data.size(); pos += chunk) {
+    md5.add((const uint8_t*)data.data() + pos, std::min(chunk, data.size() - pos));
+  }
+  md5.calculate();
+  double md5Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("\nhash cost per %u-byte chunk (host CPU, OpenSSL in place of mbedtls)\n", (unsigned)chunk);
+  printf("SHA-256 %8.2f us/chunk %8.1f MB/s\n", shaSeconds * 1e6 / chunks, data.size() / shaSeconds / 1e6);
+  printf("MD5     %8.2f us/chunk %8.1f MB/s\n", md5Seconds * 1e6 / chunks, data.size() / md5Seconds / 1e6);
+}
+
+// The verifier on its own: hashing while the image streams through, then
+// one ECDSA verification in finish()
+static bool signatureCost(const Profile& profile){
+  std::string image = hostsim::makeFirmwareImage(profile.imageSize, 6);
+  std::string signedImage = hostsim::signImage(image, signingKey());
+  ESP32FwSignatureVerifier verifier;
+  if (!verifier.setKey(signingKey().publicPem.c_str())) {
+    printf("signature key rejected\n");
+    return false;
+  }
+  size_t out = 0;
+  verifier.begin([&](uint8_t*, size_t len){ out += len; return true; });
+  auto start = std::chrono::steady_clock::now();
+  bool ok = true;
+  for (size_t pos = 0; pos < signedImage.size(); pos += 1436) {
+    ok = verifier.write((uint8_t*)&signedImage[pos], std::min((size_t)1436, signedImage.size() - pos)) && ok;
+  }
+  auto streamed = std::chrono::steady_clock::now();
+  ok = verifier.finish() && ok && out == image.size();
+  auto finished = std::chrono::steady_clock::now();
+  verifier.end();
+  double streamSeconds = std::chrono::duration<double>(streamed - start).count();
+  double finishUs = std::chrono::duration<double>(finished - streamed).count() * 1e6;
+  printf("\nsignature cost (host CPU, OpenSSL in place of mbedtls)\n");
+  printf("streaming %8.2f ms/MB, finish() %8.1f us (ECDSA P-256 verify)%s\n",
+         streamSeconds * 1e3 * 1e6 / image.size(), finishUs, ok ? "" : "  FAILED");
+  return ok;
+}
+
+static void usage(){
+  printf("usage: upload_bench_" BENCH_VARIANT " [--quick] [--section NAME] [--size KB] [--link B/s] [--window B] [--erase-us N] [--write-us N]\n");
+}
+
+int main(int argc, char** argv){
+  Profile profile;
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "--quick")) {
+      profile.quick = true;
+      profile.imageSize = 128 * 1024;
+      profile.linkRate = 0;
+      profile.eraseUs = 0;
+      profile.writeUs = 0;
+    } else if (!strcmp(argv[i], "--section") && hasValue) {
+      profile.section = argv[++i];
+    } else if (!strcmp(argv[i], "--size") && hasValue) {
+      profile.imageSize = strtoul(argv[++i], nullptr, 10) * 1024;
+    } else if (!strcmp(argv[i], "--link") && hasValue) {
+      profile.linkRate = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--window") && hasValue) {
+      profile.window = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--erase-us") && hasValue) {
+      profile.eraseUs = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--write-us") && hasValue) {
+      profile.writeUs = strtoul(argv[++i], nullptr, 10);
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  printf("upload_bench (%s backend), host model of the device%s\n", BENCH_VARIANT, profile.quick ? ", quick run" : "");
+  printf("image %u KB, link %u B/s, window %u B, erase %u us/sector, program %u us/page\n",
+         (unsigned)(profile.imageSize / 1024), (unsigned)profile.linkRate, (unsigned)profile.window,
+         (unsigned)profile.eraseUs, (unsigned)profile.writeUs);
+  if (!hostsim::allocCounting()) {
+    printf("allocation counters compiled out (sanitizer build)\n");
+  }
+
+  std::vector<Case> cases;
+  for (int raw = 0; raw < 2; raw++) {
+    for (size_t mss : {536, 1436, 2872, 5744}) {
+      cases.push_back(Case{"segment size", (bool)raw, mss, false, ESP32FW_WRITE_BLOCK_SIZE, "-"});
+    }
+  }
+  // Flash writes inline in the request handler or on the writer task
+  for (int raw = 0; raw < 2; raw++) {
+    for (int pipelined = 0; pipelined < 2; pipelined++) {
+      cases.push_back(Case{"writer", (bool)raw, 1436, (bool)pipelined, ESP32FW_WRITE_BLOCK_SIZE, "-"});
+    }
+  }
+  // Chunks passed to Update.write() as received or coalesced into blocks
+  for (int raw = 0; raw < 2; raw++) {
+    for (size_t block : {0, 4096, 16384}) {
+      cases.push_back(Case{"block size", (bool)raw, 1436, false, block, "-"});
+    }
+  }
+  // SHA-256 of the payload is always measured; checked against a header or
+  // also MD5 on request
+  for (int raw = 0; raw < 2; raw++) {
+    for (const char* check : {"-", "sha256", "sha256+md5"}) {
+      cases.push_back(Case{"digest", (bool)raw, 1436, false, ESP32FW_WRITE_BLOCK_SIZE, check});
+    }
+  }
+  // Unsigned images with no key set against signed images verified on the way
+  for (int raw = 0; raw < 2; raw++) {
+    for (const char* check : {"-", "signed"}) {
+      cases.push_back(Case{"signature", (bool)raw, 1436, false, ESP32FW_WRITE_BLOCK_SIZE, check});
+    }
+  }
+
+  bool ok = true;
+  const char* section = "";
+  for (const Case& c : cases) {
+    if (profile.section && strcmp(profile.section, c.section)) {
+      continue;
+    }
+    if (strcmp(section, c.section)) {
+      section = c.section;
+      printf("\n%s\n", section);
+      printf("%-10s %6s %-9s %6s %-10s %8s %8s %10s %12s %13s %12s\n",
+             "body", "mss", "writer", "block", "check", "MB/s", "chunks", "us/chunk", "allocs/chunk", "Update.write", "flash writes");
+    }
+    Result r = run(profile, c);
+    ok = ok && r.ok;
+    double mbps = r.seconds > 0 ? profile.imageSize / r.seconds / 1e6 : 0;
+    double usPerChunk = r.chunks ? r.seconds * 1e6 / r.chunks : 0;
+    double allocsPerChunk = r.chunks ? (double)r.allocations / r.chunks : 0;
+    printf("%-10s %6u %-9s %6u %-10s %8.3f %8u %10.1f %12.2f %13u %12u%s\n",
+           c.raw ? "raw" : "multipart", (unsigned)c.mss, c.pipelined ? "pipelined" : "inline", (unsigned)c.block, c.check,
+           mbps, r.chunks, usPerChunk, allocsPerChunk, r.updateWrites, r.flashWrites, r.ok ? "" : "  FAILED");
+  }
+  if (!profile.section || !strcmp(profile.section, "digest")) {
+    hashCost(profile);
+  }
+  if (!profile.section || !strcmp(profile.section, "signature")) {
+    ok = signatureCost(profile) && ok;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,62 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// Host stand-in for the parts of the Arduino ESP32 core the library uses.
+// Behaviour that matters to the library (String, timing, flash, the web
+// servers) is implemented in ../sim; see host_sim.h for the test controls.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+
+#define ESP_ARDUINO_VERSION_MAJOR 2
+#define ESP_ARDUINO_VERSION_MINOR 0
+#define ESP_ARDUINO_VERSION_PATCH 14
+
+#include "pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+#include "Esp.h"
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+// newlib has it, glibc before 2.38 does not
+extern "C" size_t strlcpy(char* dst, const char* src, size_t size);
+
+class HardwareSerial : public Stream{
+  public:
+    void begin(unsigned long baud) {}
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+};
+
+// Discards its output unless hostsim::setSerialOutput(true)
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef _ESPAsyncWebServer_H_
+#define _ESPAsyncWebServer_H_
+
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <list>
+#include "host_http.h"
+
+typedef enum {
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_DELETE = 0b00000100,
+  HTTP_PUT = 0b00001000,
+  HTTP_PATCH = 0b00010000,
+  HTTP_HEAD = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY = 0b01111111
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+typedef std::function<void(void)> ArDisconnectHandler;
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+class AsyncWebHandler;
+class AsyncHostConnection;
+
+class AsyncWebHeader{
+  public:
+    AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+
+  private:
+    String _name;
+    String _value;
+};
+
+class AsyncWebParameter{
+  public:
+    AsyncWebParameter(const String& name, const String& value, bool form = false, bool file = false)
+      : _name(name), _value(value), _isForm(form), _isFile(file) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+    bool isPost() const { return _isForm; }
+    bool isFile() const { return _isFile; }
+
+  private:
+    String _name;
+    String _value;
+    bool _isForm;
+    bool _isFile;
+};
+
+class AsyncWebServerResponse{
+  public:
+    AsyncWebServerResponse(int code, const String& contentType, const std::string& content)
+      : _code(code), _contentType(contentType), _content(content) {}
+    void addHeader(const String& name, const String& value) { _headers.push_back(std::make_pair(name, value)); }
+    int code() const { return _code; }
+
+  private:
+    friend class AsyncWebServerRequest;
+    int _code;
+    String _contentType;
+    std::string _content;
+    std::vector<std::pair<String, String>> _headers;
+};
+
+// The TCP connection under a request. close() from inside one of the
+// request's own callbacks frees the request under the caller in AsyncTCP;
+// here it is recorded as a fault.
+class AsyncClient{
+  public:
+    explicit AsyncClient(AsyncWebServerRequest* request) : _request(request) {}
+    void close(bool now = false);
+    bool connected() const;
+    IPAddress remoteIP() const { return IPAddress(192, 168, 4, 2); }
+
+  private:
+    AsyncWebServerRequest* _request;
+};
+
+// ESPAsyncWebServer's request, with the parts of its life cycle the library
+// depends on: responses go out as soon as send() is called, even in the
+// middle of the body; the rest of the body is still parsed and handed to
+// the body callbacks, and the request handler still runs at its end. The
+// request is freed once the connection closes, after its disconnect
+// handlers; any later use is recorded as a fault.
+class AsyncWebServerRequest{
+  public:
+    void* _tempObject = nullptr;
+
+    ~AsyncWebServerRequest();
+    AsyncClient* client();
+    WebRequestMethodComposite method() const { return _method; }
+    const String& url() const { return _url; }
+    const String& contentType() const { return _contentType; }
+    size_t contentLength() const;
+    bool multipart() const { return _isMultipart; }
+
+    size_t params() const { return _params.size(); }
+    bool hasParam(const String& name, bool post = false, bool file = false) const;
+    AsyncWebParameter* getParam(const String& name, bool post = false, bool file = false) const;
+    bool hasArg(const char* name) const;
+    const String& arg(const char* name) const;
+    const String& arg(const String& name) const { return arg(name.c_str()); }
+    bool hasHeader(const String& name) const;
+    AsyncWebHeader* getHeader(const char* name) const;
+    AsyncWebHeader* getHeader(const String& name) const { return getHeader(name.c_str()); }
+
+    bool authenticate(const char* username, const char* password, const char* realm = nullptr, bool passwordIsHash = false);
+    void requestAuthentication(const char* realm = nullptr, bool isDigest = true);
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String());
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t len, void* callback = nullptr);
+    void send(AsyncWebServerResponse* response);
+    void send(int code, const String& contentType = String(), const String& content = String());
+    void onDisconnect(ArDisconnectHandler fn);
+
+  private:
+    friend class AsyncWebServer;
+    friend class AsyncClient;
+    friend class AsyncEventSource;
+    friend class AsyncHostConnection;
+    AsyncWebServer* _server;
+    AsyncHostConnection* _connection = nullptr;
+    AsyncClient _client;
+    WebRequestMethodComposite _method = HTTP_GET;
+    String _url;
+    String _contentType;
+    size_t _contentLength = 0;
+    bool _isMultipart = false;
+    std::string _delimiter; // CRLF, "--" and the boundary
+    std::vector<std::unique_ptr<AsyncWebParameter>> _params;
+    std::vector<std::unique_ptr<AsyncWebHeader>> _headers;
+    std::vector<ArDisconnectHandler> _onDisconnect;
+    AsyncWebHandler* _handler = nullptr;
+    hostsim::HttpExchange* _exchange = nullptr;
+    bool _sent = false;
+    bool _deleted = false;
+    bool _closeRequested = false;
+    bool _kept = false;             // turned into an event stream
+    int _callbackDepth = 0;
+    std::string _formBody;          // application/x-www-form-urlencoded
+
+    // Multipart parser state
+    int _multipartState = 0;
+    std::string _multipartLine;
+    String _itemName;
+    String _itemFilename;
+    String _itemValue;
+    std::string _itemBuffer;
+    size_t _itemSize = 0;
+    std::string _pending;   // bytes that may be the start of a boundary
+
+    AsyncWebServerRequest(AsyncWebServer* server, const hostsim::HttpRequest& request, hostsim::HttpExchange* exchange);
+    bool live(const char* what) const;
+    void addParams(const String& query, bool post);
+    void parseMultipart(const uint8_t* data, size_t len);
+    void multipartByte(uint8_t c);
+    void uploadByte(uint8_t c);
+    void finishItem();
+};
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+
+class AsyncWebHandler{
+  public:
+    virtual ~AsyncWebHandler() {}
+    AsyncWebHandler& setAuthentication(const char* username, const char* password);
+    virtual bool canHandle(AsyncWebServerRequest* request) { return false; }
+    virtual void handleRequest(AsyncWebServerRequest* request) {}
+    virtual void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final) {}
+    virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {}
+
+  protected:
+    String _username;
+    String _password;
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler{
+  public:
+    AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                            ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody)
+      : _uri(uri), _method(method), _onRequest(onRequest), _onUpload(onUpload), _onBody(onBody) {}
+    bool canHandle(AsyncWebServerRequest* request) override;
+    void handleRequest(AsyncWebServerRequest* request) override;
+    void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final) override;
+    void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) override;
+
+  private:
+    String _uri;
+    WebRequestMethodComposite _method;
+    ArRequestHandlerFunction _onRequest;
+    ArUploadHandlerFunction _onUpload;
+    ArBodyHandlerFunction _onBody;
+};
+
+class AsyncEventSourceClient{
+  public:
+    uint32_t lastId() const { return _lastId; }
+    bool connected() const { return _connected; }
+    void close() { _connected = false; }
+    // Events sent to this listener, in SSE framing
+    const std::string& received() const { return _received; }
+
+  private:
+    friend class AsyncEventSource;
+    uint32_t _lastId = 0;
+    bool _connected = true;
+    std::string _received;
+};
+
+typedef std::function<void(AsyncEventSourceClient* client)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler{
+  public:
+    AsyncEventSource(const String& url) : _url(url) {}
+    const char* url() const { return _url.c_str(); }
+    void onConnect(ArEventHandlerFunction cb) { _connect = cb; }
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    size_t count() const;
+    void close();
+    bool canHandle(AsyncWebServerRequest* request) override;
+    void handleRequest(AsyncWebServerRequest* request) override;
+
+    // Host driver: a browser subscribing to the stream
+    AsyncEventSourceClient* hostConnect();
+
+  private:
+    String _url;
+    ArEventHandlerFunction _connect;
+    std::list<std::unique_ptr<AsyncEventSourceClient>> _clients;
+};
+
+// One client connection to the fake server, for tests that interleave
+// requests or feed a body piece by piece. Body bytes are delivered in
+// segments (the link's MSS unless given) as AsyncTCP would.
+class AsyncHostConnection{
+  public:
+    ~AsyncHostConnection();
+    // Delivers the next len body bytes as one segment; false once the body
+    // has ended or the connection is gone
+    bool sendSegment(size_t len);
+    // Delivers the rest of the body (up to the client's disconnect point)
+    void sendAll(size_t segment = 0);
+    // The client goes away without sending the rest
+    void disconnect();
+    bool closed() const { return _closed; }
+    size_t remaining() const;
+    const hostsim::HttpExchange& exchange() const { return _exchange; }
+    AsyncWebServerRequest* request() const { return _request.get(); }
+
+  private:
+    friend class AsyncWebServer;
+    friend class AsyncClient;
+    AsyncWebServer* _server = nullptr;
+    hostsim::HttpRequest _source;
+    hostsim::HttpExchange _exchange;
+    std::unique_ptr<AsyncWebServerRequest> _request;
+    std::unique_ptr<hostsim::BodyReader> _reader;
+    size_t _delivered = 0;
+    bool _closed = false;
+    std::vector<uint8_t> _segment;
+
+    void deliver(uint8_t* data, size_t len);
+    void close();
+    void complete();
+};
+
+class AsyncWebServer{
+  public:
+    AsyncWebServer(uint16_t port);
+    ~AsyncWebServer();
+    void begin() {}
+    void end() {}
+    AsyncCallbackWebHandler& on(const char* uri, ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody);
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler);
+    bool removeHandler(AsyncWebHandler* handler);
+    void onNotFound(ArRequestHandlerFunction fn) { _notFound = fn; }
+
+    // Host driver: opens a connection whose headers have arrived. serve()
+    // runs a whole request in the calling thread.
+    std::unique_ptr<AsyncHostConnection> connect(const hostsim::HttpRequest& request);
+    hostsim::HttpExchange serve(const hostsim::HttpRequest& request);
+    AsyncEventSource* eventSource(const String& url);
+
+  private:
+    friend class AsyncWebServerRequest;
+    friend class AsyncHostConnection;
+    std::vector<AsyncWebHandler*> _handlers;
+    std::vector<std::unique_ptr<AsyncWebHandler>> _ownHandlers;
+    ArRequestHandlerFunction _notFound;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef Esp_h
+#define Esp_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ESP object of the core. The flash calls go to the simulated flash, the
+// heap figures come from the allocation counters and restart() throws
+// hostsim::Restart instead of returning, like the real one.
+class EspClass{
+  public:
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getSketchSize();
+    uint32_t getFreeSketchSpace();
+    uint32_t getFlashChipSize();
+    uint32_t getFlashChipRealSize() { return getFlashChipSize(); }
+    uint32_t magicFlashChipSize(uint8_t byte);
+    const char* getSdkVersion() { return "host"; }
+    bool flashEraseSector(uint32_t sector);
+    bool flashWrite(uint32_t offset, const uint32_t* data, size_t size);
+    bool flashRead(uint32_t offset, uint32_t* data, size_t size);
+    bool flashWrite(uint32_t offset, const uint8_t* data, size_t size) { return flashWrite(offset, (const uint32_t*)data, size); }
+    bool flashRead(uint32_t offset, uint8_t* data, size_t size) { return flashRead(offset, (uint32_t*)data, size); }
+    [[noreturn]] void restart();
+};
+
+extern EspClass ESP;
+
+#endif
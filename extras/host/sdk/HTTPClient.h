@@ -0,0 +1,38 @@
+#ifndef HTTPClient_h
+#define HTTPClient_h
+
+#include <Arduino.h>
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_PARTIAL_CONTENT 206
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTP_CODE_RANGE_NOT_SATISFIABLE 416
+
+// GET against the files published with hostsim::serveUrl(); nothing else is
+// reachable
+class HTTPClient{
+  public:
+    bool begin(WiFiClient& client, const String& url);
+    void end();
+    void setTimeout(uint16_t timeout) {}
+    void setReuse(bool reuse) {}
+    void addHeader(const String& name, const String& value);
+    int GET();
+    int getSize() const { return _size; }
+    bool connected();
+    WiFiClient* getStreamPtr() { return _client; }
+    static String errorToString(int error);
+
+  private:
+    WiFiClient* _client = nullptr;
+    String _url;
+    String _range;
+    int _size = -1;
+};
+
+#endif
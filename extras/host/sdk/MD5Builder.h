@@ -0,0 +1,26 @@
+#ifndef MD5Builder_h
+#define MD5Builder_h
+
+#include <Arduino.h>
+
+class MD5Builder{
+  public:
+    MD5Builder();
+    ~MD5Builder();
+    MD5Builder(const MD5Builder&) = delete;
+    MD5Builder& operator=(const MD5Builder&) = delete;
+    void begin();
+    void add(const uint8_t* data, size_t len);
+    void add(const char* data) { add((const uint8_t*)data, strlen(data)); }
+    void add(const String& data) { add((const uint8_t*)data.c_str(), data.length()); }
+    void calculate();
+    void getBytes(uint8_t* output);
+    void getChars(char* output);
+    String toString();
+
+  private:
+    void* _ctx = nullptr;
+    uint8_t _digest[16] = {};
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef SPIFFS_h
+#define SPIFFS_h
+
+#include "FS.h"
+
+namespace fs {
+
+// In-memory file system; directories exist implicitly wherever a file does,
+// and mkdir() adds empty ones
+class SPIFFSFS : public FS{
+  public:
+    SPIFFSFS();
+    bool begin(bool formatOnFail = false, const char* basePath = "/spiffs", uint8_t maxOpenFiles = 10, const char* partitionLabel = nullptr) { return true; }
+    bool format();
+    void end() {}
+    size_t totalBytes() { return 0x160000; }
+    size_t usedBytes();
+};
+
+} // namespace fs
+
+extern fs::SPIFFSFS SPIFFS;
+
+#endif
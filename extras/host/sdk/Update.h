@@ -0,0 +1,75 @@
+#ifndef Update_h
+#define Update_h
+
+#include <Arduino.h>
+#include <MD5Builder.h>
+#include "esp_partition.h"
+
+#define UPDATE_ERROR_OK 0
+#define UPDATE_ERROR_WRITE 1
+#define UPDATE_ERROR_ERASE 2
+#define UPDATE_ERROR_READ 3
+#define UPDATE_ERROR_SPACE 4
+#define UPDATE_ERROR_SIZE 5
+#define UPDATE_ERROR_STREAM 6
+#define UPDATE_ERROR_MD5 7
+#define UPDATE_ERROR_MAGIC_BYTE 8
+#define UPDATE_ERROR_ACTIVATE 9
+#define UPDATE_ERROR_NO_PARTITION 10
+#define UPDATE_ERROR_BAD_ARGUMENT 11
+#define UPDATE_ERROR_ABORT 12
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+#define U_FLASH 0
+#define U_SPIFFS 100
+#define U_AUTH 200
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+// The core's UpdateClass on the simulated flash: data is collected into
+// sector-sized buffers, each sector is erased before it is written, the
+// first bytes of a firmware image are written last (so a half-written
+// image never looks bootable) and end() makes the new slot the boot
+// partition.
+class UpdateClass{
+  public:
+    UpdateClass();
+    ~UpdateClass();
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN, int command = U_FLASH, int ledPin = -1, uint8_t ledOn = 0, const char* label = nullptr);
+    size_t write(uint8_t* data, size_t len);
+    bool end(bool evenIfRemaining = false);
+    void abort();
+    void printError(Print& out);
+    const char* errorString();
+    bool setMD5(const char* expected_md5);
+    String md5String() { return _md5.toString(); }
+    uint8_t getError() const { return _error; }
+    void clearError() { _error = UPDATE_ERROR_OK; }
+    bool hasError() const { return _error != UPDATE_ERROR_OK; }
+    bool isRunning() const { return _size > 0; }
+    bool isFinished() const { return _progress == _size; }
+    size_t size() const { return _size; }
+    size_t progress() const { return _progress; }
+    size_t remaining() const { return _size - _progress; }
+
+  private:
+    uint8_t _error = UPDATE_ERROR_OK;
+    uint8_t* _buffer = nullptr;
+    uint8_t _skipBuffer[16];
+    size_t _bufferLen = 0;
+    size_t _size = 0;
+    size_t _progress = 0;
+    int _command = U_FLASH;
+    const esp_partition_t* _partition = nullptr;
+    MD5Builder _md5;
+    String _target_md5;
+
+    void reset();
+    bool writeBuffer();
+    void abort(uint8_t err);
+};
+
+extern UpdateClass Update;
+
+#endif
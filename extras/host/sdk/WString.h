@@ -0,0 +1,112 @@
+#ifndef WString_h
+#define WString_h
+
+#include <string>
+#include <string.h>
+#include <type_traits>
+
+class __FlashStringHelper;
+
+// Arduino String over std::string. Numeric constructors are explicit as in
+// the core, so code that relies on a conversion the core does not allow
+// fails here too.
+class String{
+  public:
+    String() {}
+    String(const char* cstr) : _s(cstr ? cstr : "") {}
+    String(const char* cstr, unsigned int length) : _s(cstr ? std::string(cstr, length) : std::string()) {}
+    String(const __FlashStringHelper* str) : String((const char*)str) {}
+    String(const std::string& s) : _s(s) {}
+    String(const String& other) = default;
+    String(String&& other) = default;
+    explicit String(char c) : _s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10);
+    explicit String(unsigned long long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimalPlaces = 2);
+    explicit String(double value, unsigned char decimalPlaces = 2);
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) = default;
+    String& operator=(const char* cstr) { _s = cstr ? cstr : ""; return *this; }
+
+    bool reserve(unsigned int size) { _s.reserve(size); return true; }
+    unsigned int length() const { return _s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    const char* c_str() const { return _s.c_str(); }
+    char* begin() { return &_s[0]; }
+    char* end() { return &_s[0] + _s.size(); }
+
+    bool concat(const String& str) { _s += str._s; return true; }
+    bool concat(const char* cstr) { if (cstr) { _s += cstr; } return cstr != nullptr; }
+    bool concat(const char* cstr, unsigned int length) { _s.append(cstr, length); return true; }
+    bool concat(const __FlashStringHelper* str) { return concat((const char*)str); }
+    bool concat(char c) { _s += c; return true; }
+    template<typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+    bool concat(T value) { return concat(String(value)); }
+
+    template<typename T>
+    String& operator+=(const T& rhs) { concat(rhs); return *this; }
+
+    bool equals(const String& s) const { return _s == s._s; }
+    bool equals(const char* cstr) const { return _s == (cstr ? cstr : ""); }
+    bool equalsIgnoreCase(const String& s) const;
+    bool operator==(const String& rhs) const { return equals(rhs); }
+    bool operator==(const char* cstr) const { return equals(cstr); }
+    bool operator!=(const String& rhs) const { return !equals(rhs); }
+    bool operator!=(const char* cstr) const { return !equals(cstr); }
+    bool operator<(const String& rhs) const { return _s < rhs._s; }
+    bool operator>(const String& rhs) const { return _s > rhs._s; }
+    int compareTo(const String& s) const { return _s.compare(s._s); }
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+    bool startsWith(const String& prefix, unsigned int offset) const;
+    bool endsWith(const String& suffix) const;
+
+    char charAt(unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+    void setCharAt(unsigned int index, char c) { if (index < _s.size()) { _s[index] = c; } }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return _s[index]; }
+    void getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index = 0) const;
+    void toCharArray(char* buf, unsigned int bufsize, unsigned int index = 0) const { getBytes((unsigned char*)buf, bufsize, index); }
+
+    int indexOf(char ch, unsigned int fromIndex = 0) const;
+    int indexOf(const String& str, unsigned int fromIndex = 0) const;
+    int indexOf(const char* str, unsigned int fromIndex = 0) const { return indexOf(String(str), fromIndex); }
+    int lastIndexOf(char ch) const;
+    int lastIndexOf(const String& str) const;
+    String substring(unsigned int beginIndex) const { return substring(beginIndex, _s.size()); }
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    void replace(char find, char replace);
+    void replace(const String& find, const String& replace);
+    void remove(unsigned int index) { if (index < _s.size()) { _s.erase(index); } }
+    void remove(unsigned int index, unsigned int count) { if (index < _s.size()) { _s.erase(index, count); } }
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+    const std::string& str() const { return _s; }
+
+  private:
+    std::string _s;
+};
+
+inline String operator+(const String& lhs, const String& rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String& lhs, const char* rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const char* lhs, const String& rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String& lhs, char rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String& lhs, const __FlashStringHelper* rhs) { String s(lhs); s.concat(rhs); return s; }
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+inline String operator+(const String& lhs, T rhs) { String s(lhs); s.concat(rhs); return s; }
+inline bool operator==(const char* lhs, const String& rhs) { return rhs.equals(lhs); }
+inline bool operator!=(const char* lhs, const String& rhs) { return !rhs.equals(lhs); }
+
+#endif
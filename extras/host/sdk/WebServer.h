@@ -0,0 +1,149 @@
+#ifndef WEBSERVER_H
+#define WEBSERVER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "host_http.h"
+
+enum HTTPMethod {
+  HTTP_DELETE = 0,
+  HTTP_GET = 1,
+  HTTP_HEAD = 2,
+  HTTP_POST = 3,
+  HTTP_PUT = 4,
+  HTTP_OPTIONS = 6,
+  HTTP_PATCH = 28,
+  HTTP_ANY = 255
+};
+
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+enum HTTPRawStatus { RAW_START, RAW_WRITE, RAW_END, RAW_ABORTED };
+enum HTTPAuthMethod { BASIC_AUTH, DIGEST_AUTH };
+
+#ifndef HTTP_UPLOAD_BUFLEN
+#define HTTP_UPLOAD_BUFLEN 1436
+#endif
+
+#ifndef HTTP_RAW_BUFLEN
+#define HTTP_RAW_BUFLEN 1436
+#endif
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+typedef struct {
+  HTTPUploadStatus status;
+  String filename;
+  String name;
+  String type;
+  size_t totalSize;
+  size_t currentSize;
+  uint8_t buf[HTTP_UPLOAD_BUFLEN];
+} HTTPUpload;
+
+typedef struct {
+  HTTPRawStatus status;
+  size_t totalSize;
+  size_t currentSize;
+  uint8_t buf[HTTP_RAW_BUFLEN];
+  void* data;
+} HTTPRaw;
+
+// The synchronous WebServer of arduino-esp32 2.x, reduced to what the
+// library touches. Requests are not read from a socket: serve() runs one
+// the way handleClient() runs a request that has arrived. A multipart file
+// is parsed byte by byte into HTTP_UPLOAD_BUFLEN pieces and a raw body is
+// read with readBytes() into HTTP_RAW_BUFLEN pieces, both as the core does.
+// Once the handler has stopped the client, reads fail: the upload handler
+// gets ABORTED and the request handler does not run. Only the Authorization
+// header and the ones passed to collectHeaders() are visible.
+class WebServer{
+  public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    WebServer(int port = 80);
+    ~WebServer();
+    void begin() {}
+    void close() {}
+    void stop() {}
+    void handleClient() {}
+
+    void on(const String& uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction fn) { on(uri, method, fn, nullptr); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn);
+    void onNotFound(THandlerFunction fn) { _notFound = fn; }
+
+    String uri() const { return _uri; }
+    HTTPMethod method() const { return _method; }
+    String arg(const String& name) const;
+    String arg(int i) const;
+    String argName(int i) const;
+    int args() const { return (int)_args.size(); }
+    bool hasArg(const String& name) const;
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+    String header(const String& name) const;
+    String header(int i) const;
+    String headerName(int i) const;
+    int headers() const { return (int)_headers.size(); }
+    bool hasHeader(const String& name) const;
+    int clientContentLength() const { return (int)_contentLength; }
+
+    bool authenticate(const char* username, const char* password);
+    void requestAuthentication(HTTPAuthMethod mode = BASIC_AUTH, const char* realm = nullptr, const String& authFailMsg = String(""));
+
+    void send(int code, const char* content_type = nullptr, const String& content = String(""));
+    void send(int code, char* content_type, const String& content) { send(code, (const char*)content_type, content); }
+    void send(int code, const String& content_type, const String& content) { send(code, content_type.c_str(), content); }
+    void send_P(int code, PGM_P content_type, PGM_P content);
+    void send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(const size_t contentLength) {}
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t contentLength);
+
+    HTTPUpload& upload();
+    HTTPRaw& raw();
+    WiFiClient client() { return _client; }
+
+    // Host driver: serves one request and returns what was sent back
+    hostsim::HttpExchange serve(const hostsim::HttpRequest& request);
+
+  private:
+    struct Route {
+      String uri;
+      HTTPMethod method;
+      THandlerFunction fn;
+      THandlerFunction ufn;
+    };
+    std::vector<Route> _routes;
+    THandlerFunction _notFound;
+    std::vector<String> _headerKeys;
+
+    // The request being served
+    String _uri;
+    HTTPMethod _method = HTTP_GET;
+    std::vector<std::pair<String, String>> _args;
+    std::vector<std::pair<String, String>> _headers;
+    size_t _contentLength = 0;
+    WiFiClient _client;
+    std::unique_ptr<hostsim::BodyReader> _body;
+    std::unique_ptr<HTTPUpload> _currentUpload;
+    std::unique_ptr<HTTPRaw> _currentRaw;
+    const Route* _currentRoute = nullptr;
+    hostsim::HttpExchange* _exchange = nullptr;
+    std::vector<std::pair<String, String>> _responseHeaders;
+
+    void reset();
+    void parseQuery(const String& query);
+    bool parseForm(const String& boundary);
+    bool parseRaw();
+    int uploadReadByte();
+    void uploadWriteByte(uint8_t b);
+    bool uploadAborted();
+    void callUpload();
+};
+
+#endif
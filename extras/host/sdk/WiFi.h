@@ -0,0 +1,7 @@
+#ifndef WiFi_h
+#define WiFi_h
+
+#include <Arduino.h>
+#include "WiFiClient.h"
+
+#endif
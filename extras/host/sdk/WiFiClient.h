@@ -0,0 +1,40 @@
+#ifndef WiFiClient_h
+#define WiFiClient_h
+
+#include <Arduino.h>
+#include <memory>
+
+namespace hostsim { struct Connection; }
+
+// TCP client over a simulated connection. Copies share the connection, as
+// copies of the core's WiFiClient share the socket.
+class WiFiClient : public Stream{
+  public:
+    WiFiClient() {}
+    explicit WiFiClient(std::shared_ptr<hostsim::Connection> connection) : _connection(connection) {}
+    int connect(IPAddress ip, uint16_t port);
+    int connect(const char* host, uint16_t port);
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int availableForWrite() override;
+    int available() override;
+    int read() override;
+    int read(uint8_t* buffer, size_t size);
+    int peek() override;
+    uint8_t connected();
+    void stop();
+    void setNoDelay(bool noDelay) {}
+    int fd() const;
+    IPAddress remoteIP() const;
+    uint16_t remotePort() const;
+    explicit operator bool() const { return _connection != nullptr; }
+    bool operator==(const WiFiClient& other) const { return _connection == other._connection; }
+
+    const std::shared_ptr<hostsim::Connection>& connection() const { return _connection; }
+
+  private:
+    std::shared_ptr<hostsim::Connection> _connection;
+};
+
+#endif
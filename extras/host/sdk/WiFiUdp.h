@@ -0,0 +1,40 @@
+#ifndef WiFiUdp_h
+#define WiFiUdp_h
+
+#include <Arduino.h>
+#include <deque>
+#include <string>
+
+// UDP socket on the simulated network: packets are handed to it with
+// hostsim::sendUdp() and the ones it sends are collected per port
+class WiFiUDP : public Stream{
+  public:
+    ~WiFiUDP();
+    uint8_t begin(uint16_t port);
+    void stop();
+    int parsePacket();
+    int available() override;
+    int read() override;
+    int read(uint8_t* buffer, size_t len);
+    int read(char* buffer, size_t len) { return read((uint8_t*)buffer, len); }
+    int peek() override;
+    IPAddress remoteIP() const { return _remoteIP; }
+    uint16_t remotePort() const { return _remotePort; }
+    int beginPacket(IPAddress ip, uint16_t port);
+    int endPacket();
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+  private:
+    uint16_t _port = 0;
+    std::string _packet;
+    size_t _readPos = 0;
+    IPAddress _remoteIP;
+    uint16_t _remotePort = 0;
+    std::string _out;
+    IPAddress _outIP;
+    uint16_t _outPort = 0;
+};
+
+#endif
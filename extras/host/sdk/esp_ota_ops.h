@@ -0,0 +1,12 @@
+#ifndef esp_ota_ops_h
+#define esp_ota_ops_h
+
+#include "esp_partition.h"
+
+const esp_partition_t* esp_ota_get_running_partition();
+const esp_partition_t* esp_ota_get_boot_partition();
+const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t* start_from);
+// Refuses a partition that does not start with an application image
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* partition);
+
+#endif
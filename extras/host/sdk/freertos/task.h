@@ -0,0 +1,31 @@
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+struct tskTaskControlBlock;
+typedef struct tskTaskControlBlock* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef enum {
+  eRunning = 0,
+  eReady,
+  eBlocked,
+  eSuspended,
+  eDeleted,
+  eInvalid
+} eTaskState;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth,
+                                   void* pvParameters, UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask,
+                                   BaseType_t xCoreID);
+// A task suspends or deletes itself with a NULL handle
+void vTaskSuspend(TaskHandle_t xTaskToSuspend);
+void vTaskDelete(TaskHandle_t xTaskToDelete);
+eTaskState eTaskGetState(TaskHandle_t xTask);
+void vTaskDelay(TickType_t xTicksToDelay);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+BaseType_t xPortGetCoreID();
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef lwip_sockets_h
+#define lwip_sockets_h
+
+// The socket calls the library makes on a WiFiClient's fd(); MSG_DONTWAIT
+// and the errno values come from the host
+#include <sys/socket.h>
+#include <errno.h>
+#include <stddef.h>
+
+// Sends on the simulated connection behind fd. Fails with EAGAIN while the
+// peer accepts nothing more (Connection::writeLimit), as a full send
+// buffer does with MSG_DONTWAIT.
+int lwip_send(int s, const void* data, size_t size, int flags);
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef MBEDTLS_SHA256_H
+#define MBEDTLS_SHA256_H
+
+// mbedTLS 2.28 as shipped with arduino-esp32 2.x, implemented with OpenSSL
+#include <stddef.h>
+#include <stdint.h>
+
+#define MBEDTLS_VERSION_NUMBER 0x021C0000
+
+typedef struct {
+  alignas(8) unsigned char state[128];
+} mbedtls_sha256_context;
+
+void mbedtls_sha256_init(mbedtls_sha256_context* ctx);
+void mbedtls_sha256_free(mbedtls_sha256_context* ctx);
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context* ctx, int is224);
+int mbedtls_sha256_update_ret(mbedtls_sha256_context* ctx, const unsigned char* input, size_t ilen);
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context* ctx, unsigned char output[32]);
+
+#endif
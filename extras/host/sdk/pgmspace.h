@@ -0,0 +1,32 @@
+#ifndef pgmspace_h
+#define pgmspace_h
+
+// Flash and RAM share one address space on ESP32, so these are plain
+// memory accesses there as well
+#include <string.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PGM_VOID_P const void*
+#define PSTR(s) (s)
+
+class __FlashStringHelper;
+#define FPSTR(p) ((const __FlashStringHelper*)(p))
+#define F(s) FPSTR(PSTR(s))
+
+#define pgm_read_byte(addr) (*(const unsigned char*)(addr))
+#define pgm_read_word(addr) (*(const unsigned short*)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long*)(addr))
+#define pgm_read_ptr(addr) (*(const void* const*)(addr))
+
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcpy_P strcpy
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef _ROM_CRC_H_
+#define _ROM_CRC_H_
+
+#include <stdint.h>
+
+// CRC-32 as zlib computes it: crc32_le(0, "123456789", 9) == 0xCBF43926
+uint32_t crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len);
+
+#endif
@@ -0,0 +1,94 @@
+// Heap call counters: malloc and friends wrap glibc's own entry points, so
+// operator new and everything else in the process is counted as well.
+// Left out of sanitizer builds (HOSTSIM_COUNT_ALLOCATIONS=0), which bring
+// their own allocator.
+#include <atomic>
+#include <malloc.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "host_sim.h"
+#include "sim_internal.h"
+
+#if !defined(HOSTSIM_COUNT_ALLOCATIONS)
+  #define HOSTSIM_COUNT_ALLOCATIONS 1
+#endif
+
+namespace hostsim {
+
+static std::atomic<uint64_t> allocations{0};
+static std::atomic<uint64_t> frees{0};
+static std::atomic<int64_t> liveBytes{0};
+static AllocStats baseline;
+
+AllocStats allocStats(){
+  AllocStats stats;
+  stats.allocations = allocations - baseline.allocations;
+  stats.frees = frees - baseline.frees;
+  stats.liveBytes = liveBytes - baseline.liveBytes;
+  return stats;
+}
+
+bool allocCounting(){
+  return HOSTSIM_COUNT_ALLOCATIONS;
+}
+
+void resetAllocBaseline(){
+  baseline.allocations = allocations;
+  baseline.frees = frees;
+  baseline.liveBytes = liveBytes;
+}
+
+} // namespace hostsim
+
+#if HOSTSIM_COUNT_ALLOCATIONS
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t n, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size){
+  void* p = __libc_malloc(size);
+  if (p) {
+    hostsim::allocations++;
+    hostsim::liveBytes += malloc_usable_size(p);
+  }
+  return p;
+}
+
+void* calloc(size_t n, size_t size){
+  void* p = __libc_calloc(n, size);
+  if (p) {
+    hostsim::allocations++;
+    hostsim::liveBytes += malloc_usable_size(p);
+  }
+  return p;
+}
+
+void* realloc(void* ptr, size_t size){
+  size_t before = ptr ? malloc_usable_size(ptr) : 0;
+  void* p = __libc_realloc(ptr, size);
+  if (p || size == 0) {
+    hostsim::liveBytes -= before;
+    if (p) {
+      hostsim::liveBytes += malloc_usable_size(p);
+      hostsim::allocations++;
+    }
+    if (ptr) {
+      hostsim::frees++;
+    }
+  }
+  return p;
+}
+
+void free(void* ptr){
+  if (ptr) {
+    hostsim::frees++;
+    hostsim::liveBytes -= malloc_usable_size(ptr);
+  }
+  __libc_free(ptr);
+}
+
+} // extern "C"
+#endif
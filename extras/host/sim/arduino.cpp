@@ -0,0 +1,365 @@
+// String, Print, Stream, timing and Serial of the host core
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <mutex>
+#include <atomic>
+#include "host_sim.h"
+
+// ---- String ----------------------------------------------------------------
+
+static std::string toBase(unsigned long long value, unsigned char base){
+  if (base < 2 || base > 36) {
+    base = 10;
+  }
+  if (value == 0) {
+    return "0";
+  }
+  std::string out;
+  while (value > 0) {
+    unsigned digit = value % base;
+    out.insert(out.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+    value /= base;
+  }
+  return out;
+}
+
+static std::string signedToBase(long long value, unsigned char base){
+  if (value < 0 && base == 10) {
+    return "-" + toBase(0ULL - (unsigned long long)value, base);
+  }
+  // Other bases print the two's complement of the type's width, as the core
+  return toBase(value < 0 ? (unsigned long)value : (unsigned long long)value, base);
+}
+
+static std::string toFixed(double value, unsigned char decimalPlaces){
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  return buf;
+}
+
+String::String(unsigned char value, unsigned char base) : _s(toBase(value, base)) {}
+String::String(int value, unsigned char base) : _s(signedToBase(value, base)) {}
+String::String(unsigned int value, unsigned char base) : _s(toBase(value, base)) {}
+String::String(long value, unsigned char base) : _s(signedToBase(value, base)) {}
+String::String(unsigned long value, unsigned char base) : _s(toBase(value, base)) {}
+String::String(long long value, unsigned char base) : _s(signedToBase(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : _s(toBase(value, base)) {}
+String::String(float value, unsigned char decimalPlaces) : _s(toFixed(value, decimalPlaces)) {}
+String::String(double value, unsigned char decimalPlaces) : _s(toFixed(value, decimalPlaces)) {}
+
+bool String::equalsIgnoreCase(const String& s) const{
+  if (_s.size() != s._s.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < _s.size(); i++) {
+    if (tolower((unsigned char)_s[i]) != tolower((unsigned char)s._s[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const{
+  return offset <= _s.size() && _s.compare(offset, prefix._s.size(), prefix._s) == 0;
+}
+
+bool String::endsWith(const String& suffix) const{
+  return suffix._s.size() <= _s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+}
+
+void String::getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index) const{
+  if (!buf || bufsize == 0) {
+    return;
+  }
+  if (index >= _s.size()) {
+    buf[0] = 0;
+    return;
+  }
+  size_t n = std::min((size_t)bufsize - 1, _s.size() - index);
+  memcpy(buf, _s.data() + index, n);
+  buf[n] = 0;
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const{
+  size_t pos = _s.find(ch, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& str, unsigned int fromIndex) const{
+  size_t pos = _s.find(str._s, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char ch) const{
+  size_t pos = _s.rfind(ch);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(const String& str) const{
+  size_t pos = _s.rfind(str._s);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const{
+  if (beginIndex > endIndex) {
+    std::swap(beginIndex, endIndex);
+  }
+  if (beginIndex >= _s.size()) {
+    return String();
+  }
+  endIndex = std::min((size_t)endIndex, _s.size());
+  return String(_s.substr(beginIndex, endIndex - beginIndex));
+}
+
+void String::replace(char find, char replace){
+  std::replace(_s.begin(), _s.end(), find, replace);
+}
+
+void String::replace(const String& find, const String& replace){
+  if (find._s.empty()) {
+    return;
+  }
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+    _s.replace(pos, find._s.size(), replace._s);
+    pos += replace._s.size();
+  }
+}
+
+void String::toLowerCase(){
+  for (char& c : _s) {
+    c = tolower((unsigned char)c);
+  }
+}
+
+void String::toUpperCase(){
+  for (char& c : _s) {
+    c = toupper((unsigned char)c);
+  }
+}
+
+void String::trim(){
+  size_t begin = _s.find_first_not_of(" \t\r\n\v\f");
+  if (begin == std::string::npos) {
+    _s.clear();
+    return;
+  }
+  size_t end = _s.find_last_not_of(" \t\r\n\v\f");
+  _s = _s.substr(begin, end - begin + 1);
+}
+
+long String::toInt() const{
+  return atol(_s.c_str());
+}
+
+float String::toFloat() const{
+  return (float)atof(_s.c_str());
+}
+
+double String::toDouble() const{
+  return atof(_s.c_str());
+}
+
+// ---- Print / Stream --------------------------------------------------------
+
+size_t Print::write(const uint8_t* buffer, size_t size){
+  size_t n = 0;
+  while (size--) {
+    if (write(*buffer++) == 0) {
+      break;
+    }
+    n++;
+  }
+  return n;
+}
+
+size_t Print::printf(const char* format, ...){
+  char small[128];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (len < 0) {
+    return 0;
+  }
+  if ((size_t)len < sizeof(small)) {
+    return write((const uint8_t*)small, len);
+  }
+  std::string big(len + 1, '\0');
+  va_start(args, format);
+  vsnprintf(&big[0], big.size(), format, args);
+  va_end(args);
+  return write((const uint8_t*)big.data(), len);
+}
+
+size_t Print::print(long value, int base){
+  return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long value, int base){
+  return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(long long value, int base){
+  return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long long value, int base){
+  return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(double value, int digits){
+  return print(String(value, (unsigned char)digits));
+}
+
+int Stream::timedRead(){
+  unsigned long start = millis();
+  do {
+    int c = read();
+    if (c >= 0) {
+      return c;
+    }
+    if (available() == 0 && _timeout == 0) {
+      break;
+    }
+    yield();
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length){
+  size_t count = 0;
+  while (count < length) {
+    int c = timedRead();
+    if (c < 0) {
+      break;
+    }
+    *buffer++ = (char)c;
+    count++;
+  }
+  return count;
+}
+
+String Stream::readString(){
+  String ret;
+  int c;
+  while ((c = timedRead()) >= 0) {
+    ret += (char)c;
+  }
+  return ret;
+}
+
+String Stream::readStringUntil(char terminator){
+  String ret;
+  int c;
+  while ((c = timedRead()) >= 0 && c != terminator) {
+    ret += (char)c;
+  }
+  return ret;
+}
+
+// ---- Timing ----------------------------------------------------------------
+
+namespace hostsim {
+
+static std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+static std::atomic<uint64_t> skippedUs{0};
+static std::atomic<bool> serialOutput{false};
+
+void resetClock(){
+  bootTime = std::chrono::steady_clock::now();
+  skippedUs = 0;
+}
+
+void advanceMillis(uint32_t ms){
+  skippedUs += (uint64_t)ms * 1000;
+}
+
+void setSerialOutput(bool enable){
+  serialOutput = enable;
+}
+
+} // namespace hostsim
+
+static uint64_t uptimeUs(){
+  auto elapsed = std::chrono::steady_clock::now() - hostsim::bootTime;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + hostsim::skippedUs;
+}
+
+unsigned long millis(){
+  return (unsigned long)(uint32_t)(uptimeUs() / 1000);
+}
+
+unsigned long micros(){
+  return (unsigned long)(uint32_t)uptimeUs();
+}
+
+void delay(uint32_t ms){
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us){
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield(){
+  std::this_thread::yield();
+}
+
+static std::mt19937& generator(){
+  static std::mt19937 gen(0x5eed);
+  return gen;
+}
+
+static std::mutex randomLock;
+
+long random(long howbig){
+  return howbig <= 0 ? 0 : random(0, howbig);
+}
+
+long random(long howsmall, long howbig){
+  if (howsmall >= howbig) {
+    return howsmall;
+  }
+  std::lock_guard<std::mutex> guard(randomLock);
+  return howsmall + (long)(generator()() % (unsigned long)(howbig - howsmall));
+}
+
+void randomSeed(unsigned long seed){
+  std::lock_guard<std::mutex> guard(randomLock);
+  generator().seed(seed);
+}
+
+uint32_t esp_random(){
+  std::lock_guard<std::mutex> guard(randomLock);
+  return generator()();
+}
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+extern "C" size_t strlcpy(char* dst, const char* src, size_t size){
+  size_t len = strlen(src);
+  if (size > 0) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+// ---- Serial ----------------------------------------------------------------
+
+size_t HardwareSerial::write(uint8_t c){
+  return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size){
+  if (hostsim::serialOutput) {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
+
+HardwareSerial Serial;
@@ -0,0 +1,287 @@
+// mbedTLS, MD5Builder and the ROM's tinfl/crc32 on OpenSSL and zlib
+#include <Arduino.h>
+#include <MD5Builder.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/pk.h>
+#include <rom/miniz.h>
+#include <rom/crc.h>
+#include <openssl/sha.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/bio.h>
+#include <zlib.h>
+#include <new>
+#include "host_sim.h"
+
+// ---- SHA-256 ---------------------------------------------------------------
+
+// The context is embedded in mbedtls_sha256_context as on the chip, so
+// hashing allocates nothing
+static_assert(sizeof(SHA256_CTX) <= sizeof(mbedtls_sha256_context::state), "SHA256_CTX does not fit");
+
+static SHA256_CTX* sha(mbedtls_sha256_context* ctx){
+  return reinterpret_cast<SHA256_CTX*>(ctx->state);
+}
+
+void mbedtls_sha256_init(mbedtls_sha256_context* ctx){
+  memset(ctx, 0, sizeof(*ctx));
+}
+
+void mbedtls_sha256_free(mbedtls_sha256_context* ctx){
+  if (ctx) {
+    memset(ctx, 0, sizeof(*ctx));
+  }
+}
+
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context* ctx, int is224){
+  return (is224 ? SHA224_Init(sha(ctx)) : SHA256_Init(sha(ctx))) == 1 ? 0 : -1;
+}
+
+int mbedtls_sha256_update_ret(mbedtls_sha256_context* ctx, const unsigned char* input, size_t ilen){
+  return SHA256_Update(sha(ctx), input, ilen) == 1 ? 0 : -1;
+}
+
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context* ctx, unsigned char output[32]){
+  return SHA256_Final(output, sha(ctx)) == 1 ? 0 : -1;
+}
+
+// ---- Public keys -----------------------------------------------------------
+
+void mbedtls_pk_init(mbedtls_pk_context* ctx){
+  ctx->pk_ctx = nullptr;
+}
+
+void mbedtls_pk_free(mbedtls_pk_context* ctx){
+  if (ctx && ctx->pk_ctx) {
+    EVP_PKEY_free((EVP_PKEY*)ctx->pk_ctx);
+    ctx->pk_ctx = nullptr;
+  }
+}
+
+int mbedtls_pk_parse_public_key(mbedtls_pk_context* ctx, const unsigned char* key, size_t keylen){
+  // PEM must come with its terminating NUL counted, as mbedTLS requires
+  if (keylen == 0 || key[keylen - 1] != '\0') {
+    return MBEDTLS_ERR_PK_KEY_INVALID_FORMAT;
+  }
+  BIO* bio = BIO_new_mem_buf(key, (int)keylen - 1);
+  EVP_PKEY* pkey = PEM_read_bio_PUBKEY(bio, nullptr, nullptr, nullptr);
+  BIO_free(bio);
+  if (!pkey) {
+    return MBEDTLS_ERR_PK_KEY_INVALID_FORMAT;
+  }
+  mbedtls_pk_free(ctx);
+  ctx->pk_ctx = pkey;
+  return 0;
+}
+
+int mbedtls_pk_can_do(const mbedtls_pk_context* ctx, mbedtls_pk_type_t type){
+  if (!ctx->pk_ctx) {
+    return 0;
+  }
+  int id = EVP_PKEY_base_id((EVP_PKEY*)ctx->pk_ctx);
+  switch (type) {
+    case MBEDTLS_PK_RSA:
+      return id == EVP_PKEY_RSA;
+    case MBEDTLS_PK_ECKEY:
+    case MBEDTLS_PK_ECDSA:
+      return id == EVP_PKEY_EC;
+    default:
+      return 0;
+  }
+}
+
+int mbedtls_pk_verify(mbedtls_pk_context* ctx, mbedtls_md_type_t md_alg, const unsigned char* hash, size_t hash_len,
+                      const unsigned char* sig, size_t sig_len){
+  if (!ctx->pk_ctx || md_alg != MBEDTLS_MD_SHA256 || hash_len != 32) {
+    return MBEDTLS_ERR_PK_BAD_INPUT_DATA;
+  }
+  EVP_PKEY_CTX* verify = EVP_PKEY_CTX_new((EVP_PKEY*)ctx->pk_ctx, nullptr);
+  int ok = verify && EVP_PKEY_verify_init(verify) == 1 &&
+           EVP_PKEY_CTX_set_signature_md(verify, EVP_sha256()) == 1 &&
+           EVP_PKEY_verify(verify, sig, sig_len, hash, hash_len) == 1;
+  EVP_PKEY_CTX_free(verify);
+  return ok ? 0 : MBEDTLS_ERR_ECP_VERIFY_FAILED;
+}
+
+// ---- MD5Builder ------------------------------------------------------------
+
+MD5Builder::MD5Builder(){
+  _ctx = EVP_MD_CTX_new();
+}
+
+MD5Builder::~MD5Builder(){
+  EVP_MD_CTX_free((EVP_MD_CTX*)_ctx);
+}
+
+void MD5Builder::begin(){
+  memset(_digest, 0, sizeof(_digest));
+  EVP_DigestInit_ex((EVP_MD_CTX*)_ctx, EVP_md5(), nullptr);
+}
+
+void MD5Builder::add(const uint8_t* data, size_t len){
+  EVP_DigestUpdate((EVP_MD_CTX*)_ctx, data, len);
+}
+
+void MD5Builder::calculate(){
+  unsigned int len = sizeof(_digest);
+  EVP_DigestFinal_ex((EVP_MD_CTX*)_ctx, _digest, &len);
+}
+
+void MD5Builder::getBytes(uint8_t* output){
+  memcpy(output, _digest, sizeof(_digest));
+}
+
+void MD5Builder::getChars(char* output){
+  for (size_t i = 0; i < sizeof(_digest); i++) {
+    sprintf(output + i * 2, "%02x", _digest[i]);
+  }
+}
+
+String MD5Builder::toString(){
+  char out[33];
+  getChars(out);
+  return String(out);
+}
+
+// ---- tinfl / crc32 ---------------------------------------------------------
+
+static_assert(sizeof(z_stream) <= sizeof(tinfl_decompressor::m_stream), "z_stream does not fit");
+
+enum { STREAM_IDLE = 0, STREAM_OPEN, STREAM_ENDED };
+
+static z_stream* stream(tinfl_decompressor* r){
+  return reinterpret_cast<z_stream*>(r->m_stream);
+}
+
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* pIn_buf_next, size_t* pIn_buf_size,
+                              mz_uint8* pOut_buf_start, mz_uint8* pOut_buf_next, size_t* pOut_buf_size,
+                              const mz_uint32 decomp_flags){
+  if (!pIn_buf_size || !pOut_buf_size || pOut_buf_next < pOut_buf_start) {
+    return TINFL_STATUS_BAD_PARAM;
+  }
+  z_stream* zs = stream(r);
+  if (r->m_state == STREAM_ENDED) {
+    *pIn_buf_size = 0;
+    *pOut_buf_size = 0;
+    return TINFL_STATUS_DONE;
+  }
+  if (r->m_state == STREAM_IDLE) {
+    new (zs) z_stream();
+    int windowBits = (decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15;
+    if (inflateInit2(zs, windowBits) != Z_OK) {
+      return TINFL_STATUS_FAILED;
+    }
+    r->m_state = STREAM_OPEN;
+  }
+  zs->next_in = const_cast<Bytef*>(pIn_buf_next);
+  zs->avail_in = (uInt)*pIn_buf_size;
+  zs->next_out = pOut_buf_next;
+  zs->avail_out = (uInt)*pOut_buf_size;
+  int ret = inflate(zs, Z_NO_FLUSH);
+  *pIn_buf_size -= zs->avail_in;
+  *pOut_buf_size -= zs->avail_out;
+  if (ret == Z_STREAM_END) {
+    inflateEnd(zs);
+    r->m_state = STREAM_ENDED;
+    return TINFL_STATUS_DONE;
+  }
+  if (ret != Z_OK && ret != Z_BUF_ERROR) {
+    inflateEnd(zs);
+    r->m_state = STREAM_ENDED;
+    return ret == Z_DATA_ERROR && zs->msg && strstr(zs->msg, "check") ? TINFL_STATUS_ADLER32_MISMATCH : TINFL_STATUS_FAILED;
+  }
+  if (zs->avail_out == 0) {
+    return TINFL_STATUS_HAS_MORE_OUTPUT;
+  }
+  return (decomp_flags & TINFL_FLAG_HAS_MORE_INPUT) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+}
+
+uint32_t crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len){
+  return (uint32_t)crc32(crc, buf, len);
+}
+
+// ---- Helpers for tests -----------------------------------------------------
+
+namespace hostsim {
+
+static std::string hex(const unsigned char* data, size_t len){
+  static const char digits[] = "0123456789abcdef";
+  std::string out;
+  for (size_t i = 0; i < len; i++) {
+    out += digits[data[i] >> 4];
+    out += digits[data[i] & 15];
+  }
+  return out;
+}
+
+std::string sha256Hex(const std::string& data){
+  unsigned char digest[SHA256_DIGEST_LENGTH];
+  SHA256((const unsigned char*)data.data(), data.size(), digest);
+  return hex(digest, sizeof(digest));
+}
+
+std::string md5Hex(const std::string& data){
+  unsigned char digest[16];
+  unsigned int len = sizeof(digest);
+  EVP_Digest(data.data(), data.size(), digest, &len, EVP_md5(), nullptr);
+  return hex(digest, len);
+}
+
+static std::string pem(EVP_PKEY* key, bool isPrivate){
+  BIO* bio = BIO_new(BIO_s_mem());
+  if (isPrivate) {
+    PEM_write_bio_PrivateKey(bio, key, nullptr, nullptr, 0, nullptr, nullptr);
+  } else {
+    PEM_write_bio_PUBKEY(bio, key);
+  }
+  char* data;
+  long len = BIO_get_mem_data(bio, &data);
+  std::string out(data, len);
+  BIO_free(bio);
+  return out;
+}
+
+SigningKey makeSigningKey(){
+  EVP_PKEY* key = EVP_EC_gen("P-256");
+  SigningKey pair;
+  pair.publicPem = pem(key, false);
+  pair.privatePem = pem(key, true);
+  EVP_PKEY_free(key);
+  return pair;
+}
+
+std::string signImage(const std::string& image, const SigningKey& key){
+  BIO* bio = BIO_new_mem_buf(key.privatePem.data(), key.privatePem.size());
+  EVP_PKEY* pkey = PEM_read_bio_PrivateKey(bio, nullptr, nullptr, nullptr);
+  BIO_free(bio);
+  EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+  size_t len = 0;
+  EVP_DigestSignInit(ctx, nullptr, EVP_sha256(), nullptr, pkey);
+  EVP_DigestSign(ctx, nullptr, &len, (const unsigned char*)image.data(), image.size());
+  std::string signature(len, '\0');
+  EVP_DigestSign(ctx, (unsigned char*)&signature[0], &len, (const unsigned char*)image.data(), image.size());
+  signature.resize(len);
+  EVP_MD_CTX_free(ctx);
+  EVP_PKEY_free(pkey);
+  std::string out = image + signature;
+  for (int i = 0; i < 4; i++) {
+    out += (char)(len >> (8 * i));
+  }
+  return out;
+}
+
+std::string gzip(const std::string& data){
+  z_stream zs = {};
+  deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY);
+  std::string out(deflateBound(&zs, data.size()) + 32, '\0');
+  zs.next_in = (Bytef*)data.data();
+  zs.avail_in = data.size();
+  zs.next_out = (Bytef*)&out[0];
+  zs.avail_out = out.size();
+  deflate(&zs, Z_FINISH);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+  return out;
+}
+
+} // namespace hostsim
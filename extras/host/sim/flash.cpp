@@ -0,0 +1,300 @@
+// Flash chip, partition table, OTA data and the ESP object
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_ota_ops.h>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "host_sim.h"
+#include "sim_internal.h"
+
+#define FLASH_SIZE 0x400000
+#define SECTOR_SIZE 4096
+#define PAGE_SIZE 256
+
+namespace hostsim {
+
+// arduino-esp32's default.csv
+static esp_partition_t partitions[] = {
+  {nullptr, ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_NVS, 0x9000, 0x5000, "nvs", false},
+  {nullptr, ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_OTA, 0xE000, 0x2000, "otadata", false},
+  {nullptr, ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_APP_OTA_0, 0x10000, 0x140000, "app0", false},
+  {nullptr, ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_APP_OTA_1, 0x150000, 0x140000, "app1", false},
+  {nullptr, ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, 0x290000, 0x160000, "spiffs", false},
+};
+
+static std::mutex flashLock;
+static std::vector<uint8_t> flash(FLASH_SIZE, 0xFF);
+static FlashStats stats;
+static uint32_t eraseUs = 0;
+static uint32_t writeUs = 0;
+static const esp_partition_t* running = &partitions[2];
+static const esp_partition_t* boot = &partitions[2];
+static size_t runningSize = 0;
+static std::atomic<uint32_t> updateWrites{0};
+static uint32_t failWritesFrom = FLASH_SIZE;
+
+static void spend(uint64_t us){
+  if (us > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+  }
+}
+
+bool flashRead(uint32_t address, void* data, size_t len){
+  if ((uint64_t)address + len > FLASH_SIZE) {
+    return false;
+  }
+  std::lock_guard<std::mutex> guard(flashLock);
+  memcpy(data, flash.data() + address, len);
+  stats.readCalls++;
+  stats.bytesRead += len;
+  return true;
+}
+
+bool flashWrite(uint32_t address, const void* data, size_t len){
+  if ((uint64_t)address + len > FLASH_SIZE) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> guard(flashLock);
+    if ((uint64_t)address + len > failWritesFrom) {
+      return false;
+    }
+  }
+  {
+    // NOR flash only clears bits: writing over data that was not erased
+    // leaves a mix of both, as on the chip
+    std::lock_guard<std::mutex> guard(flashLock);
+    const uint8_t* in = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+      flash[address + i] &= in[i];
+    }
+    stats.writeCalls++;
+    stats.bytesWritten += len;
+  }
+  spend((uint64_t)writeUs * ((len + PAGE_SIZE - 1) / PAGE_SIZE));
+  return true;
+}
+
+bool flashErase(uint32_t address, size_t len){
+  if (address % SECTOR_SIZE || len % SECTOR_SIZE || (uint64_t)address + len > FLASH_SIZE) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> guard(flashLock);
+    memset(flash.data() + address, 0xFF, len);
+    stats.sectorErases += len / SECTOR_SIZE;
+  }
+  spend((uint64_t)eraseUs * (len / SECTOR_SIZE));
+  return true;
+}
+
+uint32_t flashSize(){
+  return FLASH_SIZE;
+}
+
+size_t runningImageSize(){
+  return runningSize;
+}
+
+void countUpdateWrite(){
+  updateWrites++;
+}
+
+uint32_t updateWriteCalls(){
+  return updateWrites;
+}
+
+void resetFlash(){
+  {
+    std::lock_guard<std::mutex> guard(flashLock);
+    std::fill(flash.begin(), flash.end(), 0xFF);
+    stats = FlashStats();
+    failWritesFrom = FLASH_SIZE;
+  }
+  running = &partitions[2];
+  boot = &partitions[2];
+  runningSize = 0;
+  updateWrites = 0;
+  installRunning(makeFirmwareImage(0x40000, 7, "0.9.0"));
+  std::lock_guard<std::mutex> guard(flashLock);
+  stats = FlashStats();
+}
+
+const esp_partition_t* partition(const char* label){
+  for (const esp_partition_t& p : partitions) {
+    if (strcmp(p.label, label) == 0) {
+      return &p;
+    }
+  }
+  return nullptr;
+}
+
+const esp_partition_t* bootPartition(){
+  return boot;
+}
+
+const esp_partition_t* runningPartition(){
+  return running;
+}
+
+void installRunning(const std::string& image){
+  std::lock_guard<std::mutex> guard(flashLock);
+  uint8_t* base = flash.data() + running->address;
+  memset(base, 0xFF, running->size);
+  memcpy(base, image.data(), std::min(image.size(), (size_t)running->size));
+  runningSize = image.size();
+}
+
+std::string readFlash(const esp_partition_t* partition, size_t offset, size_t len){
+  std::lock_guard<std::mutex> guard(flashLock);
+  if (offset >= partition->size) {
+    return std::string();
+  }
+  len = std::min(len, partition->size - offset);
+  return std::string((const char*)flash.data() + partition->address + offset, len);
+}
+
+void failFlashWrites(const esp_partition_t* partition, size_t offset){
+  std::lock_guard<std::mutex> guard(flashLock);
+  failWritesFrom = partition->address + offset;
+}
+
+void setFlashTiming(uint32_t eraseUsPerSector, uint32_t writeUsPerPage){
+  eraseUs = eraseUsPerSector;
+  writeUs = writeUsPerPage;
+}
+
+FlashStats flashStats(){
+  std::lock_guard<std::mutex> guard(flashLock);
+  return stats;
+}
+
+void reset(){
+  clearFaults();
+  resetClock();
+  resetFlash();
+  resetUpdate();
+  resetFileSystem();
+  resetNetwork();
+  resetTasks();
+  resetAllocBaseline();
+}
+
+} // namespace hostsim
+
+// ---- esp_partition / esp_ota -----------------------------------------------
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label){
+  for (const esp_partition_t& p : hostsim::partitions) {
+    if (p.type == type && (subtype == ESP_PARTITION_SUBTYPE_ANY || p.subtype == subtype) &&
+        (!label || strcmp(p.label, label) == 0)) {
+      return &p;
+    }
+  }
+  return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size){
+  if (!partition || src_offset + size > partition->size) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  return hostsim::flashRead(partition->address + src_offset, dst, size) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size){
+  if (!partition || dst_offset + size > partition->size) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  return hostsim::flashWrite(partition->address + dst_offset, src, size) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size){
+  if (!partition || offset + size > partition->size || offset % SECTOR_SIZE || size % SECTOR_SIZE) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  return hostsim::flashErase(partition->address + offset, size) ? ESP_OK : ESP_FAIL;
+}
+
+const esp_partition_t* esp_ota_get_running_partition(){
+  return hostsim::running;
+}
+
+const esp_partition_t* esp_ota_get_boot_partition(){
+  return hostsim::boot;
+}
+
+const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t* start_from){
+  const esp_partition_t* from = start_from ? start_from : hostsim::running;
+  return from == &hostsim::partitions[2] ? &hostsim::partitions[3] : &hostsim::partitions[2];
+}
+
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* partition){
+  if (!partition || partition->type != ESP_PARTITION_TYPE_APP) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  uint8_t magic = 0;
+  hostsim::flashRead(partition->address, &magic, 1);
+  if (magic != 0xE9) {
+    return ESP_ERR_OTA_VALIDATE_FAILED;
+  }
+  hostsim::boot = partition;
+  return ESP_OK;
+}
+
+// ---- ESP -------------------------------------------------------------------
+
+#define HEAP_SIZE 327680
+
+uint32_t EspClass::getHeapSize(){
+  return HEAP_SIZE;
+}
+
+uint32_t EspClass::getFreeHeap(){
+  int64_t live = hostsim::allocStats().liveBytes;
+  return (uint32_t)std::max<int64_t>(HEAP_SIZE / 4, HEAP_SIZE - std::max<int64_t>(live, 0));
+}
+
+uint32_t EspClass::getMinFreeHeap(){
+  return getFreeHeap();
+}
+
+uint32_t EspClass::getMaxAllocHeap(){
+  return getFreeHeap() / 2;
+}
+
+uint32_t EspClass::getSketchSize(){
+  return hostsim::runningImageSize();
+}
+
+uint32_t EspClass::getFreeSketchSpace(){
+  return esp_ota_get_next_update_partition(nullptr)->size;
+}
+
+uint32_t EspClass::getFlashChipSize(){
+  return FLASH_SIZE;
+}
+
+uint32_t EspClass::magicFlashChipSize(uint8_t byte){
+  return byte <= 4 ? 0x100000u << byte : 0;
+}
+
+bool EspClass::flashEraseSector(uint32_t sector){
+  return hostsim::flashErase(sector * SECTOR_SIZE, SECTOR_SIZE);
+}
+
+bool EspClass::flashWrite(uint32_t offset, const uint32_t* data, size_t size){
+  return hostsim::flashWrite(offset, data, size);
+}
+
+bool EspClass::flashRead(uint32_t offset, uint32_t* data, size_t size){
+  return hostsim::flashRead(offset, data, size);
+}
+
+void EspClass::restart(){
+  throw hostsim::Restart();
+}
+
+EspClass ESP;
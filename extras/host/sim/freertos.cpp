@@ -0,0 +1,238 @@
+// FreeRTOS tasks, queues and mutexes on std::thread
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <string.h>
+#include "sim_internal.h"
+
+using Clock = std::chrono::steady_clock;
+
+static Clock::time_point deadline(TickType_t ticks){
+  return ticks == portMAX_DELAY ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds(ticks);
+}
+
+// ---- Queues and semaphores -------------------------------------------------
+
+struct QueueDefinition {
+  enum Kind { QUEUE, MUTEX, RECURSIVE_MUTEX } kind = QUEUE;
+  std::mutex lock;
+  std::condition_variable changed;
+  UBaseType_t length = 0;
+  UBaseType_t itemSize = 0;
+  std::deque<std::string> items;
+  // Mutexes: holder and how often it took a recursive one
+  std::thread::id holder;
+  unsigned depth = 0;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize){
+  QueueDefinition* q = new QueueDefinition();
+  q->length = uxQueueLength;
+  q->itemSize = uxItemSize;
+  return q;
+}
+
+void vQueueDelete(QueueHandle_t xQueue){
+  delete xQueue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void* pvItemToQueue, TickType_t xTicksToWait){
+  std::unique_lock<std::mutex> guard(q->lock);
+  if (!q->changed.wait_until(guard, deadline(xTicksToWait), [q](){ return q->items.size() < q->length; })) {
+    return pdFALSE;
+  }
+  q->items.emplace_back((const char*)pvItemToQueue, q->itemSize);
+  q->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void* pvBuffer, TickType_t xTicksToWait){
+  std::unique_lock<std::mutex> guard(q->lock);
+  if (!q->changed.wait_until(guard, deadline(xTicksToWait), [q](){ return !q->items.empty(); })) {
+    return pdFALSE;
+  }
+  memcpy(pvBuffer, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  q->changed.notify_all();
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q){
+  std::lock_guard<std::mutex> guard(q->lock);
+  return q->items.size();
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(){
+  QueueDefinition* q = new QueueDefinition();
+  q->kind = QueueDefinition::MUTEX;
+  return q;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(){
+  QueueDefinition* q = new QueueDefinition();
+  q->kind = QueueDefinition::RECURSIVE_MUTEX;
+  return q;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t xSemaphore){
+  delete xSemaphore;
+}
+
+static BaseType_t take(SemaphoreHandle_t q, TickType_t ticks, bool recursive){
+  std::unique_lock<std::mutex> guard(q->lock);
+  std::thread::id self = std::this_thread::get_id();
+  if (recursive && q->depth > 0 && q->holder == self) {
+    q->depth++;
+    return pdTRUE;
+  }
+  if (!q->changed.wait_until(guard, deadline(ticks), [q](){ return q->depth == 0; })) {
+    return pdFALSE;
+  }
+  q->holder = self;
+  q->depth = 1;
+  return pdTRUE;
+}
+
+static BaseType_t give(SemaphoreHandle_t q){
+  std::lock_guard<std::mutex> guard(q->lock);
+  if (q->depth == 0 || q->holder != std::this_thread::get_id()) {
+    return pdFALSE;
+  }
+  if (--q->depth == 0) {
+    q->changed.notify_all();
+  }
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime){
+  return take(xSemaphore, xBlockTime, false);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore){
+  return give(xSemaphore);
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t xMutex, TickType_t xBlockTime){
+  return take(xMutex, xBlockTime, true);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t xMutex){
+  return give(xMutex);
+}
+
+// ---- Tasks -----------------------------------------------------------------
+
+struct tskTaskControlBlock {
+  std::thread thread;
+  std::mutex lock;
+  std::condition_variable changed;
+  bool suspended = false;
+  bool deleted = false;
+  UBaseType_t priority = 1;
+  BaseType_t core = 1;
+};
+
+// Unwinds a task that deleted itself or was deleted while suspended
+struct TaskDeleted {};
+
+// Arduino's loop task runs on core 1
+static tskTaskControlBlock mainTask;
+static thread_local tskTaskControlBlock* currentTask = &mainTask;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth,
+                                   void* pvParameters, UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask,
+                                   BaseType_t xCoreID){
+  tskTaskControlBlock* task = new tskTaskControlBlock();
+  task->priority = uxPriority;
+  task->core = xCoreID == tskNO_AFFINITY ? 0 : xCoreID;
+  task->thread = std::thread([task, pvTaskCode, pvParameters](){
+    currentTask = task;
+    try {
+      pvTaskCode(pvParameters);
+    } catch (const TaskDeleted&) {
+    }
+  });
+  if (pvCreatedTask) {
+    *pvCreatedTask = task;
+  }
+  return pdPASS;
+}
+
+void vTaskSuspend(TaskHandle_t xTaskToSuspend){
+  tskTaskControlBlock* task = xTaskToSuspend ? xTaskToSuspend : currentTask;
+  std::unique_lock<std::mutex> guard(task->lock);
+  task->suspended = true;
+  task->changed.notify_all();
+  if (task == currentTask) {
+    task->changed.wait(guard, [task](){ return task->deleted || !task->suspended; });
+    if (task->deleted) {
+      throw TaskDeleted();
+    }
+  }
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete){
+  tskTaskControlBlock* task = xTaskToDelete ? xTaskToDelete : currentTask;
+  if (task == currentTask) {
+    throw TaskDeleted();
+  }
+  {
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->deleted = true;
+    task->changed.notify_all();
+  }
+  // A thread cannot be stopped from outside; a task deleted while it runs
+  // is left to finish on its own
+  bool parked;
+  {
+    std::lock_guard<std::mutex> guard(task->lock);
+    parked = task->suspended;
+  }
+  if (parked) {
+    task->thread.join();
+    delete task;
+  } else {
+    task->thread.detach();
+  }
+}
+
+eTaskState eTaskGetState(TaskHandle_t xTask){
+  std::lock_guard<std::mutex> guard(xTask->lock);
+  if (xTask->deleted) {
+    return eDeleted;
+  }
+  if (xTask->suspended) {
+    return eSuspended;
+  }
+  return xTask == currentTask ? eRunning : eReady;
+}
+
+void vTaskDelay(TickType_t xTicksToDelay){
+  std::this_thread::sleep_for(std::chrono::milliseconds(xTicksToDelay));
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask){
+  return (xTask ? xTask : currentTask)->priority;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(){
+  return currentTask;
+}
+
+BaseType_t xPortGetCoreID(){
+  return currentTask->core;
+}
+
+namespace hostsim {
+
+void resetTasks(){}
+
+} // namespace hostsim
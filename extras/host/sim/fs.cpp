@@ -0,0 +1,312 @@
+// In-memory file system behind SPIFFS
+#include <FS.h>
+#include <SPIFFS.h>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+#include "host_sim.h"
+#include "sim_internal.h"
+
+namespace hostsim {
+
+static bool renameReplaces = true;
+static std::string renameFailsFrom;
+
+} // namespace hostsim
+
+namespace fs {
+
+class FSImpl{
+  public:
+    std::mutex lock;
+    std::map<std::string, std::shared_ptr<std::string>> files;
+    std::set<std::string> dirs;
+
+    static std::string normalize(const char* path){
+      std::string p = path ? path : "";
+      if (p.empty() || p[0] != '/') {
+        p.insert(p.begin(), '/');
+      }
+      while (p.size() > 1 && p.back() == '/') {
+        p.pop_back();
+      }
+      return p;
+    }
+
+    bool isDir(const std::string& path){
+      if (path == "/" || dirs.count(path)) {
+        return true;
+      }
+      std::string prefix = path + "/";
+      auto it = files.lower_bound(prefix);
+      return it != files.end() && it->first.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    // Names directly under dir, directories first marked with a flag
+    std::vector<std::pair<std::string, bool>> list(const std::string& dir){
+      std::string prefix = dir == "/" ? "/" : dir + "/";
+      std::set<std::string> seenDirs;
+      std::vector<std::pair<std::string, bool>> entries;
+      auto add = [&](const std::string& path){
+        if (path.size() <= prefix.size() || path.compare(0, prefix.size(), prefix) != 0) {
+          return;
+        }
+        size_t slash = path.find('/', prefix.size());
+        if (slash == std::string::npos) {
+          if (files.count(path)) {
+            entries.push_back(std::make_pair(path, false));
+          } else if (seenDirs.insert(path).second) {
+            entries.push_back(std::make_pair(path, true));
+          }
+        } else if (seenDirs.insert(path.substr(0, slash)).second) {
+          entries.push_back(std::make_pair(path.substr(0, slash), true));
+        }
+      };
+      for (auto& f : files) {
+        add(f.first);
+      }
+      for (auto& d : dirs) {
+        add(d);
+      }
+      return entries;
+    }
+};
+
+class FileImpl{
+  public:
+    std::shared_ptr<FSImpl> fs;
+    std::string path;
+    std::shared_ptr<std::string> data;    // null for a directory
+    size_t pos = 0;
+    bool writable = false;
+    bool open = true;
+    std::vector<std::pair<std::string, bool>> entries;
+    size_t nextEntry = 0;
+};
+
+size_t File::write(const uint8_t* buf, size_t size){
+  if (!_p || !_p->open || !_p->writable || !_p->data) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> guard(_p->fs->lock);
+  std::string& d = *_p->data;
+  if (_p->pos > d.size()) {
+    d.resize(_p->pos);
+  }
+  d.replace(_p->pos, std::min(size, d.size() - _p->pos), (const char*)buf, size);
+  _p->pos += size;
+  return size;
+}
+
+int File::available(){
+  if (!_p || !_p->open || !_p->data) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> guard(_p->fs->lock);
+  return _p->pos < _p->data->size() ? (int)(_p->data->size() - _p->pos) : 0;
+}
+
+int File::read(){
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek(){
+  if (!available()) {
+    return -1;
+  }
+  std::lock_guard<std::mutex> guard(_p->fs->lock);
+  return (uint8_t)(*_p->data)[_p->pos];
+}
+
+size_t File::read(uint8_t* buf, size_t size){
+  if (!_p || !_p->open || !_p->data) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> guard(_p->fs->lock);
+  const std::string& d = *_p->data;
+  if (_p->pos >= d.size()) {
+    return 0;
+  }
+  size_t n = std::min(size, d.size() - _p->pos);
+  memcpy(buf, d.data() + _p->pos, n);
+  _p->pos += n;
+  return n;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode){
+  if (!_p || !_p->data) {
+    return false;
+  }
+  size_t base = mode == SeekSet ? 0 : mode == SeekCur ? _p->pos : _p->data->size();
+  _p->pos = base + pos;
+  return true;
+}
+
+size_t File::position() const{
+  return _p ? _p->pos : 0;
+}
+
+size_t File::size() const{
+  return _p && _p->data ? _p->data->size() : 0;
+}
+
+void File::close(){
+  if (_p) {
+    _p->open = false;
+  }
+}
+
+File::operator bool() const{
+  return _p && _p->open;
+}
+
+const char* File::path() const{
+  return _p ? _p->path.c_str() : nullptr;
+}
+
+const char* File::name() const{
+  if (!_p) {
+    return nullptr;
+  }
+  size_t slash = _p->path.rfind('/');
+  return _p->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+bool File::isDirectory(){
+  return _p && _p->open && !_p->data;
+}
+
+File File::openNextFile(const char* mode){
+  if (!isDirectory() || _p->nextEntry >= _p->entries.size()) {
+    return File();
+  }
+  const std::pair<std::string, bool>& entry = _p->entries[_p->nextEntry++];
+  FS fs(_p->fs);
+  return fs.open(entry.first.c_str(), mode);
+}
+
+void File::rewindDirectory(){
+  if (isDirectory()) {
+    std::lock_guard<std::mutex> guard(_p->fs->lock);
+    _p->entries = _p->fs->list(_p->path);
+    _p->nextEntry = 0;
+  }
+}
+
+File FS::open(const char* path, const char* mode, const bool create){
+  std::string p = FSImpl::normalize(path);
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  auto impl = std::make_shared<FileImpl>();
+  impl->fs = _impl;
+  impl->path = p;
+  auto it = _impl->files.find(p);
+  if (mode[0] == 'r') {
+    if (it != _impl->files.end()) {
+      impl->data = it->second;
+      impl->writable = mode[1] == '+';
+    } else if (_impl->isDir(p)) {
+      impl->entries = _impl->list(p);
+    } else {
+      return File();
+    }
+    return File(impl);
+  }
+  if (_impl->isDir(p) && it == _impl->files.end()) {
+    return File();
+  }
+  if (it == _impl->files.end() || mode[0] == 'w') {
+    auto data = std::make_shared<std::string>();
+    _impl->files[p] = data;
+    impl->data = data;
+  } else {
+    impl->data = it->second;
+    impl->pos = impl->data->size();
+  }
+  impl->writable = true;
+  return File(impl);
+}
+
+bool FS::exists(const char* path){
+  std::string p = FSImpl::normalize(path);
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  return _impl->files.count(p) || _impl->isDir(p);
+}
+
+bool FS::remove(const char* path){
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  return _impl->files.erase(FSImpl::normalize(path)) > 0;
+}
+
+bool FS::rename(const char* pathFrom, const char* pathTo){
+  std::string from = FSImpl::normalize(pathFrom);
+  std::string to = FSImpl::normalize(pathTo);
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  auto it = _impl->files.find(from);
+  if (it == _impl->files.end() || from == hostsim::renameFailsFrom) {
+    return false;
+  }
+  if (!hostsim::renameReplaces && _impl->files.count(to)) {
+    return false;
+  }
+  std::shared_ptr<std::string> data = it->second;
+  _impl->files.erase(it);
+  _impl->files[to] = data;
+  return true;
+}
+
+bool FS::mkdir(const char* path){
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  _impl->dirs.insert(FSImpl::normalize(path));
+  return true;
+}
+
+bool FS::rmdir(const char* path){
+  std::string p = FSImpl::normalize(path);
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  if (!_impl->list(p).empty()) {
+    return false;
+  }
+  return _impl->dirs.erase(p) > 0;
+}
+
+SPIFFSFS::SPIFFSFS() : FS(std::make_shared<FSImpl>()) {}
+
+bool SPIFFSFS::format(){
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  _impl->files.clear();
+  _impl->dirs.clear();
+  return true;
+}
+
+size_t SPIFFSFS::usedBytes(){
+  std::lock_guard<std::mutex> guard(_impl->lock);
+  size_t used = 0;
+  for (auto& f : _impl->files) {
+    used += f.second->size();
+  }
+  return used;
+}
+
+} // namespace fs
+
+fs::SPIFFSFS SPIFFS;
+
+namespace hostsim {
+
+void resetFileSystem(){
+  SPIFFS.format();
+  renameReplaces = true;
+  renameFailsFrom.clear();
+}
+
+void setRenameReplaces(bool replaces){
+  renameReplaces = replaces;
+}
+
+void failRenamesFrom(const char* path){
+  renameFailsFrom = fs::FSImpl::normalize(path);
+}
+
+} // namespace hostsim
@@ -0,0 +1,107 @@
+#ifndef host_http_h
+#define host_http_h
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+
+namespace hostsim {
+
+struct Connection;
+
+// A request as a client sends it to one of the fake web servers
+struct HttpRequest {
+  String method = "GET";
+  String uri;                                     // path and query
+  std::vector<std::pair<String, String>> headers;
+  std::string body;
+  // Body bytes the client sends before it goes away; the rest never arrives
+  size_t disconnectAfter = (size_t)-1;
+
+  static HttpRequest get(const String& uri);
+  static HttpRequest post(const String& uri, const std::string& body = std::string(),
+                          const char* contentType = "application/x-www-form-urlencoded");
+  // multipart/form-data with a single file part, as the web UI sends it
+  static HttpRequest multipart(const String& method, const String& uri, const std::string& data,
+                               const char* filename = "firmware.bin");
+  // application/octet-stream body
+  static HttpRequest raw(const String& method, const String& uri, const std::string& data);
+
+  HttpRequest& header(const String& name, const String& value);
+  HttpRequest& basicAuth(const String& username, const String& password);
+  String headerValue(const String& name) const;
+};
+
+struct HttpResponse {
+  int code = 0;
+  String contentType;
+  std::string body;
+  std::vector<std::pair<String, String>> headers;
+  String header(const String& name) const;
+};
+
+// What one request got back. More than one response is a fault of the
+// handler (see faults()); the test decides whether that is expected.
+struct HttpExchange {
+  std::vector<HttpResponse> responses;
+  // The request handler ran (after the whole body was read)
+  bool handled = false;
+  // Body bytes the server read before the request ended
+  size_t bodyRead = 0;
+  // The request's connection, which stays open while the device holds it
+  // (event streams)
+  std::shared_ptr<Connection> connection;
+  int code() const { return responses.empty() ? 0 : responses.front().code; }
+  const std::string& body() const;
+  const HttpResponse& response() const;
+};
+
+// Reads a request body the way a socket delivers it: in segments of at
+// most the MSS, no faster than the simulated link allows (setLink()), and
+// never more than the client has sent before it disconnected
+class BodyReader{
+  public:
+    BodyReader(const std::string& body, size_t disconnectAfter);
+    // Bytes of the current segment not read yet; waits for the next
+    // segment when it is used up. 0 once the body ends or the client left.
+    size_t available();
+    // Up to len bytes of what has arrived; waits for the first byte
+    size_t read(uint8_t* out, size_t len);
+    int read();
+    size_t consumed() const { return _pos; }
+    bool finished() const { return _pos >= _end; }
+    bool disconnected() const { return _pos >= _end && _end < _body.size(); }
+    void stop() { _stopped = true; }
+    bool stopped() const { return _stopped; }
+
+  private:
+    const std::string& _body;
+    size_t _pos = 0;
+    size_t _end;
+    size_t _segmentEnd;
+    bool _stopped = false;
+    double _sent = 0;          // bytes the sender has put on the link
+    uint64_t _lastUs = 0;
+
+    bool nextSegment();
+};
+
+// Link model for the fake servers: bytesPerSecond 0 delivers at once.
+// The sender can be at most window bytes ahead of the reader (TCP window).
+void setLink(uint32_t bytesPerSecond, size_t mss = 1436, size_t window = 5744);
+uint32_t linkRate();
+size_t linkMss();
+
+// Misuse the fakes detect: a second response to one request, a request used
+// after it was freed, a connection closed from inside its own callback
+void fault(const String& message);
+std::vector<String> faults();
+void clearFaults();
+
+String base64(const String& text);
+
+} // namespace hostsim
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef host_sim_h
+#define host_sim_h
+
+// Controls for the simulated device behind the host stand-ins in ../sdk:
+// flash and partitions, the clock, the network and the allocation counters.
+// Tests and benchmarks include this next to the library.
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "host_http.h"
+
+namespace hostsim {
+
+// Thrown by ESP.restart()
+struct Restart {};
+
+// Back to a freshly booted device: erased flash with the running firmware
+// installed, empty file system, no faults, no network state
+void reset();
+
+// ---- Flash -----------------------------------------------------------------
+
+// 4 MB flash laid out as the default partition table with two OTA slots:
+// nvs, otadata, app0 (ota_0, running), app1 (ota_1), spiffs
+void resetFlash();
+const esp_partition_t* partition(const char* label);
+const esp_partition_t* bootPartition();
+const esp_partition_t* runningPartition();
+// Installs image as the running firmware in app0
+void installRunning(const std::string& image);
+std::string readFlash(const esp_partition_t* partition, size_t offset, size_t len);
+
+// Flash writes reaching offset of partition or beyond fail from now on, as
+// in a worn or write-protected region; reset() clears it
+void failFlashWrites(const esp_partition_t* partition, size_t offset);
+
+// Time the flash takes, spent as real time so it overlaps with the link
+// and with other tasks as on the chip; 0 is instant
+void setFlashTiming(uint32_t eraseUsPerSector, uint32_t writeUsPerPage);
+
+struct FlashStats {
+  uint32_t sectorErases = 0;
+  uint32_t writeCalls = 0;
+  uint64_t bytesWritten = 0;
+  uint32_t readCalls = 0;
+  uint64_t bytesRead = 0;
+};
+FlashStats flashStats();
+
+// Calls the core's Update.write() got since reset()
+uint32_t updateWriteCalls();
+
+// ---- File system -----------------------------------------------------------
+
+// SPIFFS refuses to rename onto an existing file where LittleFS replaces it;
+// false makes the fake behave like SPIFFS until reset()
+void setRenameReplaces(bool replaces);
+
+// Renames of the file at path fail from now on; reset() clears it
+void failRenamesFrom(const char* path);
+
+// ---- Clock -----------------------------------------------------------------
+
+// millis() is real time since reset() plus whatever was skipped here
+void advanceMillis(uint32_t ms);
+
+// ---- Serial ----------------------------------------------------------------
+
+void setSerialOutput(bool enable);
+
+// ---- Network ---------------------------------------------------------------
+
+// Simulated TCP connection. The device side is a WiFiClient; rx is what
+// the peer sent, tx what the device wrote. writeLimit caps what the peer
+// accepts before writes fail (a listener that stopped reading).
+struct Connection {
+  std::string rx;
+  size_t rxPos = 0;
+  std::string tx;
+  bool open = true;               // the device has not stopped it
+  bool peerOpen = true;           // the peer has not closed its side
+  size_t writeLimit = (size_t)-1;
+  IPAddress remoteIP;
+  uint16_t remotePort = 0;
+  int fd = -1;                    // assigned by WiFiClient::fd()
+};
+
+// Makes url answer GET with content (Range requests included)
+void serveUrl(const String& url, const std::string& content);
+// Answers a TCP connection to port with data, as espota.py does
+void listenTcp(uint16_t port, const std::string& data);
+std::shared_ptr<Connection> acceptedConnection(uint16_t port);
+// Delivers a UDP packet to the device; udpReplies() are the packets it sent
+// to fromPort
+void sendUdp(uint16_t port, const std::string& data, IPAddress from = IPAddress(192, 168, 4, 2), uint16_t fromPort = 40000);
+std::vector<std::string> udpReplies(uint16_t fromPort = 40000);
+
+// ---- Allocations -----------------------------------------------------------
+
+// Heap calls of the whole process since reset(); all zero when the
+// counters are compiled out (sanitizer builds)
+struct AllocStats {
+  uint64_t allocations = 0;
+  uint64_t frees = 0;
+  int64_t liveBytes = 0;
+};
+AllocStats allocStats();
+bool allocCounting();
+
+// ---- Images ----------------------------------------------------------------
+
+// A valid ESP32 application image of exactly size bytes (a multiple of 16
+// plus the appended SHA-256), contents derived from seed
+std::string makeFirmwareImage(size_t size, uint32_t seed = 1, const char* version = "1.0.0");
+// A LittleFS-looking file system image
+std::string makeFileSystemImage(size_t size, uint32_t seed = 1);
+
+// ECDSA P-256 key pair in PEM, and an image signed with it the way
+// tools/sign_firmware.py signs: image | DER signature | length (u32 LE)
+struct SigningKey {
+  std::string publicPem;
+  std::string privatePem;
+};
+SigningKey makeSigningKey();
+std::string signImage(const std::string& image, const SigningKey& key);
+
+std::string sha256Hex(const std::string& data);
+std::string md5Hex(const std::string& data);
+std::string gzip(const std::string& data);
+
+} // namespace hostsim
+
+#endif
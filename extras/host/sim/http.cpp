@@ -0,0 +1,220 @@
+// Requests, body pacing and fault log shared by both fake web servers
+#include <Arduino.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "host_http.h"
+
+namespace hostsim {
+
+#define MULTIPART_BOUNDARY "----esp32fwhostboundary"
+
+HttpRequest HttpRequest::get(const String& uri){
+  HttpRequest request;
+  request.method = "GET";
+  request.uri = uri;
+  return request;
+}
+
+HttpRequest HttpRequest::post(const String& uri, const std::string& body, const char* contentType){
+  HttpRequest request;
+  request.method = "POST";
+  request.uri = uri;
+  request.body = body;
+  if (contentType && !body.empty()) {
+    request.header("Content-Type", contentType);
+  }
+  return request;
+}
+
+HttpRequest HttpRequest::multipart(const String& method, const String& uri, const std::string& data, const char* filename){
+  HttpRequest request;
+  request.method = method;
+  request.uri = uri;
+  request.body = "--" MULTIPART_BOUNDARY "\r\n"
+                 "Content-Disposition: form-data; name=\"firmware\"; filename=\"";
+  request.body += filename;
+  request.body += "\"\r\n"
+                  "Content-Type: application/octet-stream\r\n\r\n";
+  request.body += data;
+  request.body += "\r\n--" MULTIPART_BOUNDARY "--\r\n";
+  request.header("Content-Type", "multipart/form-data; boundary=" MULTIPART_BOUNDARY);
+  return request;
+}
+
+HttpRequest HttpRequest::raw(const String& method, const String& uri, const std::string& data){
+  HttpRequest request;
+  request.method = method;
+  request.uri = uri;
+  request.body = data;
+  request.header("Content-Type", "application/octet-stream");
+  return request;
+}
+
+HttpRequest& HttpRequest::header(const String& name, const String& value){
+  headers.push_back(std::make_pair(name, value));
+  return *this;
+}
+
+HttpRequest& HttpRequest::basicAuth(const String& username, const String& password){
+  return header("Authorization", "Basic " + base64(username + ":" + password));
+}
+
+String HttpRequest::headerValue(const String& name) const{
+  for (auto& h : headers) {
+    if (h.first.equalsIgnoreCase(name)) {
+      return h.second;
+    }
+  }
+  return String();
+}
+
+String HttpResponse::header(const String& name) const{
+  for (auto& h : headers) {
+    if (h.first.equalsIgnoreCase(name)) {
+      return h.second;
+    }
+  }
+  return String();
+}
+
+static const HttpResponse noResponse;
+
+const std::string& HttpExchange::body() const{
+  return response().body;
+}
+
+const HttpResponse& HttpExchange::response() const{
+  return responses.empty() ? noResponse : responses.front();
+}
+
+// ---- Link ------------------------------------------------------------------
+
+static uint32_t rate = 0;
+static size_t mss = 1436;
+static size_t window = 5744;
+
+void setLink(uint32_t bytesPerSecond, size_t segment, size_t windowBytes){
+  rate = bytesPerSecond;
+  mss = segment;
+  window = std::max(windowBytes, segment);
+}
+
+uint32_t linkRate(){
+  return rate;
+}
+
+size_t linkMss(){
+  return mss;
+}
+
+static uint64_t nowUs(){
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+BodyReader::BodyReader(const std::string& body, size_t disconnectAfter)
+  : _body(body), _end(std::min(body.size(), disconnectAfter)), _segmentEnd(0), _lastUs(nowUs()) {
+  if (rate == 0) {
+    _sent = _end;
+  }
+}
+
+// Waits until the sender has put target bytes on the link. It never gets
+// more than a window ahead of what has been read.
+static void waitFor(double& sent, uint64_t& lastUs, size_t pos, size_t end, size_t target){
+  for (;;) {
+    double cap = (double)std::min(pos + window, end);
+    if (rate > 0) {
+      uint64_t now = nowUs();
+      sent = std::min(cap, sent + (double)rate * (now - lastUs) / 1e6);
+      lastUs = now;
+    } else {
+      sent = cap;
+    }
+    if (sent >= target || sent >= cap) {
+      return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds((uint64_t)((target - sent) * 1e6 / rate) + 1));
+  }
+}
+
+size_t BodyReader::available(){
+  if (_stopped) {
+    return 0;
+  }
+  if (_pos < _segmentEnd) {
+    return _segmentEnd - _pos;
+  }
+  return nextSegment() ? _segmentEnd - _pos : 0;
+}
+
+bool BodyReader::nextSegment(){
+  if (_pos >= _end) {
+    return false;
+  }
+  size_t segment = std::min(mss, _end - _pos);
+  waitFor(_sent, _lastUs, _pos, _end, _pos + segment);
+  _segmentEnd = _pos + segment;
+  return true;
+}
+
+size_t BodyReader::read(uint8_t* out, size_t len){
+  if (_stopped || _pos >= _end || len == 0) {
+    return 0;
+  }
+  if ((size_t)_sent <= _pos) {
+    waitFor(_sent, _lastUs, _pos, _end, _pos + 1);
+  }
+  size_t n = std::min(len, (size_t)_sent - _pos);
+  memcpy(out, _body.data() + _pos, n);
+  _pos += n;
+  return n;
+}
+
+int BodyReader::read(){
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+// ---- Faults ----------------------------------------------------------------
+
+static std::mutex faultLock;
+static std::vector<String> faultLog;
+
+void fault(const String& message){
+  std::lock_guard<std::mutex> guard(faultLock);
+  faultLog.push_back(message);
+}
+
+std::vector<String> faults(){
+  std::lock_guard<std::mutex> guard(faultLock);
+  return faultLog;
+}
+
+void clearFaults(){
+  std::lock_guard<std::mutex> guard(faultLock);
+  faultLog.clear();
+}
+
+String base64(const String& text){
+  static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  const std::string& in = text.str();
+  std::string out;
+  for (size_t i = 0; i < in.size(); i += 3) {
+    uint32_t n = (uint8_t)in[i] << 16;
+    if (i + 1 < in.size()) {
+      n |= (uint8_t)in[i + 1] << 8;
+    }
+    if (i + 2 < in.size()) {
+      n |= (uint8_t)in[i + 2];
+    }
+    out += table[(n >> 18) & 63];
+    out += table[(n >> 12) & 63];
+    out += i + 1 < in.size() ? table[(n >> 6) & 63] : '=';
+    out += i + 2 < in.size() ? table[n & 63] : '=';
+  }
+  return String(out);
+}
+
+} // namespace hostsim
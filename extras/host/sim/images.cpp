@@ -0,0 +1,74 @@
+// Firmware and file system images for tests
+#include <Arduino.h>
+#include <openssl/sha.h>
+#include "host_sim.h"
+
+#define IMAGE_HEADER_SIZE 24
+#define SEGMENT_HEADER_SIZE 8
+#define APP_DESC_SIZE 256
+#define APP_DESC_MAGIC 0xABCD5432
+#define CHECKSUM_SEED 0xEF
+
+namespace hostsim {
+
+static void put32(std::string& s, size_t pos, uint32_t v){
+  for (int i = 0; i < 4; i++) {
+    s[pos + i] = (char)(v >> (8 * i));
+  }
+}
+
+static void fill(std::string& s, size_t from, size_t to, uint32_t seed){
+  // xorshift so images of different seeds differ everywhere
+  uint32_t x = seed * 2654435761u + 1;
+  for (size_t i = from; i < to; i++) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s[i] = (char)x;
+  }
+}
+
+std::string makeFirmwareImage(size_t size, uint32_t seed, const char* version){
+  // header, one segment, checksum padded to 16, SHA-256
+  size_t minimum = IMAGE_HEADER_SIZE + SEGMENT_HEADER_SIZE + APP_DESC_SIZE + 16 + 32;
+  size = std::max(size, minimum);
+  size_t body = ((size - 32) & ~(size_t)15);
+  size_t segmentLen = body - 1 - IMAGE_HEADER_SIZE - SEGMENT_HEADER_SIZE;
+  // The checksum byte sits at the end of the 16-byte padding
+  segmentLen &= ~(size_t)3;
+  std::string image(body + 32, '\0');
+  image[0] = (char)0xE9;
+  image[1] = 1;                 // segments
+  image[2] = 2;                 // DIO
+  image[3] = 0x20;              // 4 MB, 40 MHz
+  put32(image, 4, 0x40080000);  // entry
+  image[12] = 0;                // chip id ESP32
+  image[23] = 1;                // hash appended
+  put32(image, IMAGE_HEADER_SIZE, 0x3F400020);
+  put32(image, IMAGE_HEADER_SIZE + 4, segmentLen);
+  size_t data = IMAGE_HEADER_SIZE + SEGMENT_HEADER_SIZE;
+  fill(image, data, data + segmentLen, seed);
+  // esp_app_desc_t opens the first segment
+  memset(&image[data], 0, APP_DESC_SIZE);
+  put32(image, data, APP_DESC_MAGIC);
+  strncpy(&image[data + 16], version, 31);
+  strncpy(&image[data + 48], "host-app", 31);
+  uint8_t checksum = CHECKSUM_SEED;
+  for (size_t i = data; i < data + segmentLen; i++) {
+    checksum ^= (uint8_t)image[i];
+  }
+  image[body - 1] = (char)checksum;
+  unsigned char digest[32];
+  SHA256((const unsigned char*)image.data(), body, digest);
+  memcpy(&image[body], digest, 32);
+  return image;
+}
+
+std::string makeFileSystemImage(size_t size, uint32_t seed){
+  std::string image(std::max(size, (size_t)4096), '\0');
+  fill(image, 0, image.size(), seed);
+  memcpy(&image[8], "littlefs", 8);
+  return image;
+}
+
+} // namespace hostsim
@@ -0,0 +1,329 @@
+// WiFiClient, WiFiUDP, HTTPClient and IPAddress on the simulated network
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <HTTPClient.h>
+#include <lwip/sockets.h>
+#include <deque>
+#include <map>
+#include "host_sim.h"
+#include "sim_internal.h"
+
+namespace hostsim {
+
+struct UdpPacket {
+  std::string data;
+  IPAddress from;
+  uint16_t fromPort;
+};
+
+static std::map<String, std::string> urls;
+static std::map<uint16_t, std::string> tcpListeners;
+static std::map<uint16_t, std::shared_ptr<Connection>> accepted;
+static std::map<uint16_t, WiFiUDP*> udpSockets;
+static std::map<uint16_t, std::deque<UdpPacket>> udpInbox;
+static std::map<uint16_t, std::vector<std::string>> udpSent;
+static std::map<int, std::weak_ptr<Connection>> sockets;
+static int nextFd = 3;
+
+void resetNetwork(){
+  urls.clear();
+  tcpListeners.clear();
+  accepted.clear();
+  udpInbox.clear();
+  udpSent.clear();
+  sockets.clear();
+  nextFd = 3;
+}
+
+void serveUrl(const String& url, const std::string& content){
+  urls[url] = content;
+}
+
+void listenTcp(uint16_t port, const std::string& data){
+  tcpListeners[port] = data;
+}
+
+std::shared_ptr<Connection> acceptedConnection(uint16_t port){
+  auto it = accepted.find(port);
+  return it == accepted.end() ? nullptr : it->second;
+}
+
+void sendUdp(uint16_t port, const std::string& data, IPAddress from, uint16_t fromPort){
+  udpInbox[port].push_back(UdpPacket{data, from, fromPort});
+}
+
+std::vector<std::string> udpReplies(uint16_t fromPort){
+  return udpSent[fromPort];
+}
+
+} // namespace hostsim
+
+// ---- WiFiClient ------------------------------------------------------------
+
+int WiFiClient::connect(IPAddress ip, uint16_t port){
+  auto it = hostsim::tcpListeners.find(port);
+  if (it == hostsim::tcpListeners.end()) {
+    return 0;
+  }
+  _connection = std::make_shared<hostsim::Connection>();
+  _connection->rx = it->second;
+  _connection->remoteIP = ip;
+  _connection->remotePort = port;
+  hostsim::accepted[port] = _connection;
+  return 1;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port){
+  IPAddress ip;
+  ip.fromString(host);
+  return connect(ip, port);
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size){
+  if (!_connection || !_connection->open || !_connection->peerOpen) {
+    return 0;
+  }
+  size_t room = _connection->writeLimit > _connection->tx.size() ? _connection->writeLimit - _connection->tx.size() : 0;
+  size = std::min(size, room);
+  _connection->tx.append((const char*)buffer, size);
+  return size;
+}
+
+int WiFiClient::availableForWrite(){
+  if (!_connection || !_connection->open) {
+    return 0;
+  }
+  return (int)std::min<size_t>(5744, _connection->writeLimit - std::min(_connection->writeLimit, _connection->tx.size()));
+}
+
+int WiFiClient::available(){
+  if (!_connection || !_connection->open) {
+    return 0;
+  }
+  return (int)(_connection->rx.size() - _connection->rxPos);
+}
+
+int WiFiClient::read(){
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size){
+  int n = std::min<int>(available(), (int)size);
+  if (n <= 0) {
+    return -1;
+  }
+  memcpy(buffer, _connection->rx.data() + _connection->rxPos, n);
+  _connection->rxPos += n;
+  return n;
+}
+
+int WiFiClient::peek(){
+  return available() > 0 ? (uint8_t)_connection->rx[_connection->rxPos] : -1;
+}
+
+uint8_t WiFiClient::connected(){
+  return _connection && _connection->open && (_connection->peerOpen || available() > 0);
+}
+
+void WiFiClient::stop(){
+  if (_connection) {
+    _connection->open = false;
+  }
+}
+
+int WiFiClient::fd() const{
+  if (!_connection) {
+    return -1;
+  }
+  if (_connection->fd < 0) {
+    _connection->fd = hostsim::nextFd++;
+    hostsim::sockets[_connection->fd] = _connection;
+  }
+  return _connection->fd;
+}
+
+// ---- lwIP sockets ----------------------------------------------------------
+
+int lwip_send(int s, const void* data, size_t size, int flags){
+  auto it = hostsim::sockets.find(s);
+  std::shared_ptr<hostsim::Connection> connection = it == hostsim::sockets.end() ? nullptr : it->second.lock();
+  if (!connection) {
+    errno = EBADF;
+    return -1;
+  }
+  if (!connection->open || !connection->peerOpen) {
+    errno = ENOTCONN;
+    return -1;
+  }
+  size_t room = connection->writeLimit > connection->tx.size() ? connection->writeLimit - connection->tx.size() : 0;
+  if (room == 0) {
+    errno = EAGAIN;
+    return -1;
+  }
+  size = std::min(size, room);
+  connection->tx.append((const char*)data, size);
+  return (int)size;
+}
+
+IPAddress WiFiClient::remoteIP() const{
+  return _connection ? _connection->remoteIP : IPAddress();
+}
+
+uint16_t WiFiClient::remotePort() const{
+  return _connection ? _connection->remotePort : 0;
+}
+
+// ---- WiFiUDP ---------------------------------------------------------------
+
+WiFiUDP::~WiFiUDP(){
+  stop();
+}
+
+uint8_t WiFiUDP::begin(uint16_t port){
+  if (hostsim::udpSockets.count(port)) {
+    return 0;
+  }
+  hostsim::udpSockets[port] = this;
+  _port = port;
+  return 1;
+}
+
+void WiFiUDP::stop(){
+  auto it = hostsim::udpSockets.find(_port);
+  if (_port && it != hostsim::udpSockets.end() && it->second == this) {
+    hostsim::udpSockets.erase(it);
+  }
+  _port = 0;
+}
+
+int WiFiUDP::parsePacket(){
+  if (!_port) {
+    return 0;
+  }
+  std::deque<hostsim::UdpPacket>& inbox = hostsim::udpInbox[_port];
+  if (inbox.empty()) {
+    return 0;
+  }
+  _packet = inbox.front().data;
+  _remoteIP = inbox.front().from;
+  _remotePort = inbox.front().fromPort;
+  _readPos = 0;
+  inbox.pop_front();
+  return (int)_packet.size();
+}
+
+int WiFiUDP::available(){
+  return (int)(_packet.size() - _readPos);
+}
+
+int WiFiUDP::read(){
+  return _readPos < _packet.size() ? (uint8_t)_packet[_readPos++] : -1;
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t len){
+  size_t n = std::min(len, _packet.size() - _readPos);
+  memcpy(buffer, _packet.data() + _readPos, n);
+  _readPos += n;
+  return (int)n;
+}
+
+int WiFiUDP::peek(){
+  return _readPos < _packet.size() ? (uint8_t)_packet[_readPos] : -1;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port){
+  _out.clear();
+  _outIP = ip;
+  _outPort = port;
+  return 1;
+}
+
+int WiFiUDP::endPacket(){
+  hostsim::udpSent[_outPort].push_back(_out);
+  _out.clear();
+  return 1;
+}
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size){
+  _out.append((const char*)buffer, size);
+  return size;
+}
+
+// ---- HTTPClient ------------------------------------------------------------
+
+bool HTTPClient::begin(WiFiClient& client, const String& url){
+  _client = &client;
+  _url = url;
+  _range = String();
+  _size = -1;
+  return url.startsWith("http://") || url.startsWith("https://");
+}
+
+void HTTPClient::end(){
+  if (_client) {
+    _client->stop();
+  }
+}
+
+void HTTPClient::addHeader(const String& name, const String& value){
+  if (name.equalsIgnoreCase("Range")) {
+    _range = value;
+  }
+}
+
+int HTTPClient::GET(){
+  auto it = hostsim::urls.find(_url);
+  if (it == hostsim::urls.end()) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  size_t start = 0;
+  if (_range.startsWith("bytes=")) {
+    start = (size_t)_range.substring(6).toInt();
+  }
+  if (start > 0 && start >= it->second.size()) {
+    return HTTP_CODE_RANGE_NOT_SATISFIABLE;
+  }
+  auto connection = std::make_shared<hostsim::Connection>();
+  connection->rx = it->second.substr(start);
+  // The server closes once the body is sent
+  connection->peerOpen = false;
+  *_client = WiFiClient(connection);
+  _size = (int)connection->rx.size();
+  return start > 0 ? HTTP_CODE_PARTIAL_CONTENT : HTTP_CODE_OK;
+}
+
+bool HTTPClient::connected(){
+  return _client && _client->connected();
+}
+
+String HTTPClient::errorToString(int error){
+  switch (error) {
+    case HTTPC_ERROR_CONNECTION_REFUSED:
+      return "connection refused";
+    case HTTPC_ERROR_CONNECTION_LOST:
+      return "connection lost";
+    case HTTPC_ERROR_READ_TIMEOUT:
+      return "read Timeout";
+    default:
+      return String();
+  }
+}
+
+// ---- IPAddress -------------------------------------------------------------
+
+bool IPAddress::fromString(const char* address){
+  unsigned a, b, c, d;
+  char extra;
+  if (!address || sscanf(address, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+    return false;
+  }
+  *this = IPAddress(a, b, c, d);
+  return true;
+}
+
+String IPAddress::toString() const{
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+  return String(buf);
+}
@@ -0,0 +1,27 @@
+#ifndef sim_internal_h
+#define sim_internal_h
+
+// Hooks between the parts of the simulation; not for tests
+#include <stdint.h>
+#include <stddef.h>
+
+namespace hostsim {
+
+void resetClock();
+void resetNetwork();
+void resetFileSystem();
+void resetUpdate();
+void resetAllocBaseline();
+void resetTasks();
+
+// Absolute flash access shared by ESP, esp_partition and Update
+bool flashRead(uint32_t address, void* data, size_t len);
+bool flashWrite(uint32_t address, const void* data, size_t len);
+bool flashErase(uint32_t address, size_t len);
+uint32_t flashSize();
+size_t runningImageSize();
+void countUpdateWrite();
+
+} // namespace hostsim
+
+#endif
@@ -0,0 +1,206 @@
+// The core's UpdateClass (arduino-esp32 2.x Updater.cpp) on the simulated flash
+#include <Update.h>
+#include <esp_ota_ops.h>
+#include "host_sim.h"
+#include "sim_internal.h"
+
+#define IMAGE_MAGIC 0xE9
+#define SKIP_SIZE 16
+
+static const char* const errorTexts[] = {
+  "No Error",
+  "Flash Write Failed",
+  "Flash Erase Failed",
+  "Flash Read Failed",
+  "Not Enough Space",
+  "Bad Size Given",
+  "Stream Read Timeout",
+  "MD5 Check Failed",
+  "Wrong Magic Byte",
+  "Could Not Activate The Firmware",
+  "Partition Could Not be Found",
+  "Bad Argument",
+  "Aborted"
+};
+
+UpdateClass::UpdateClass(){}
+
+UpdateClass::~UpdateClass(){
+  reset();
+}
+
+void UpdateClass::reset(){
+  free(_buffer);
+  _buffer = nullptr;
+  _bufferLen = 0;
+  _progress = 0;
+  _size = 0;
+  _command = U_FLASH;
+  _partition = nullptr;
+  _target_md5 = String();
+}
+
+bool UpdateClass::begin(size_t size, int command, int ledPin, uint8_t ledOn, const char* label){
+  if (_size > 0) {
+    // already running
+    return false;
+  }
+  reset();
+  _error = UPDATE_ERROR_OK;
+  if (size == 0) {
+    _error = UPDATE_ERROR_SIZE;
+    return false;
+  }
+  if (command == U_FLASH) {
+    _partition = esp_ota_get_next_update_partition(nullptr);
+  } else if (command == U_SPIFFS) {
+    _partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, label);
+  } else {
+    _error = UPDATE_ERROR_BAD_ARGUMENT;
+    return false;
+  }
+  if (!_partition) {
+    _error = UPDATE_ERROR_NO_PARTITION;
+    return false;
+  }
+  if (size == UPDATE_SIZE_UNKNOWN) {
+    size = _partition->size;
+  } else if (size > _partition->size) {
+    _error = UPDATE_ERROR_SIZE;
+    return false;
+  }
+  _buffer = (uint8_t*)malloc(SPI_FLASH_SEC_SIZE);
+  if (!_buffer) {
+    _error = UPDATE_ERROR_OK;
+    return false;
+  }
+  _size = size;
+  _command = command;
+  _md5.begin();
+  return true;
+}
+
+bool UpdateClass::writeBuffer(){
+  size_t skip = 0;
+  if (_progress == 0 && _command == U_FLASH) {
+    if (_buffer[0] != IMAGE_MAGIC) {
+      abort(UPDATE_ERROR_MAGIC_BYTE);
+      return false;
+    }
+    // The header goes in last so an unfinished image never boots
+    memcpy(_skipBuffer, _buffer, SKIP_SIZE);
+    skip = SKIP_SIZE;
+  }
+  if (_progress % SPI_FLASH_SEC_SIZE == 0 &&
+      esp_partition_erase_range(_partition, _progress, SPI_FLASH_SEC_SIZE) != ESP_OK) {
+    abort(UPDATE_ERROR_ERASE);
+    return false;
+  }
+  if (esp_partition_write(_partition, _progress + skip, _buffer + skip, _bufferLen - skip) != ESP_OK) {
+    abort(UPDATE_ERROR_WRITE);
+    return false;
+  }
+  _md5.add(_buffer, _bufferLen);
+  _progress += _bufferLen;
+  _bufferLen = 0;
+  return true;
+}
+
+size_t UpdateClass::write(uint8_t* data, size_t len){
+  hostsim::countUpdateWrite();
+  if (hasError() || !isRunning()) {
+    return 0;
+  }
+  if (len > remaining()) {
+    abort(UPDATE_ERROR_SPACE);
+    return 0;
+  }
+  size_t left = len;
+  while (_bufferLen + left > SPI_FLASH_SEC_SIZE) {
+    size_t toBuff = SPI_FLASH_SEC_SIZE - _bufferLen;
+    memcpy(_buffer + _bufferLen, data + (len - left), toBuff);
+    _bufferLen += toBuff;
+    if (!writeBuffer()) {
+      return len - left;
+    }
+    left -= toBuff;
+  }
+  memcpy(_buffer + _bufferLen, data + (len - left), left);
+  _bufferLen += left;
+  if (_bufferLen == remaining()) {
+    if (!writeBuffer()) {
+      return len - left;
+    }
+  }
+  return len;
+}
+
+bool UpdateClass::end(bool evenIfRemaining){
+  if (hasError() || _size == 0) {
+    return false;
+  }
+  if (!isFinished() && !evenIfRemaining) {
+    abort(UPDATE_ERROR_ABORT);
+    return false;
+  }
+  if (evenIfRemaining) {
+    if (_bufferLen > 0 && !writeBuffer()) {
+      return false;
+    }
+    _size = _progress;
+  }
+  _md5.calculate();
+  if (_target_md5.length() > 0 && _target_md5 != _md5.toString()) {
+    abort(UPDATE_ERROR_MD5);
+    return false;
+  }
+  if (_command == U_FLASH) {
+    if (esp_partition_write(_partition, 0, _skipBuffer, SKIP_SIZE) != ESP_OK) {
+      abort(UPDATE_ERROR_WRITE);
+      return false;
+    }
+    if (esp_ota_set_boot_partition(_partition) != ESP_OK) {
+      abort(UPDATE_ERROR_ACTIVATE);
+      return false;
+    }
+  }
+  reset();
+  return true;
+}
+
+void UpdateClass::abort(){
+  abort(UPDATE_ERROR_ABORT);
+}
+
+void UpdateClass::abort(uint8_t err){
+  reset();
+  _error = err;
+}
+
+void UpdateClass::printError(Print& out){
+  out.printf("ERROR[%u]: %s\n", _error, errorString());
+}
+
+const char* UpdateClass::errorString(){
+  return _error < sizeof(errorTexts) / sizeof(errorTexts[0]) ? errorTexts[_error] : "UNKNOWN";
+}
+
+bool UpdateClass::setMD5(const char* expected_md5){
+  if (strlen(expected_md5) != 32) {
+    return false;
+  }
+  _target_md5 = expected_md5;
+  _target_md5.toLowerCase();
+  return true;
+}
+
+UpdateClass Update;
+
+namespace hostsim {
+
+void resetUpdate(){
+  Update.abort();
+  Update.clearError();
+}
+
+} // namespace hostsim
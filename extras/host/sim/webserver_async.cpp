@@ -0,0 +1,630 @@
+// ESPAsyncWebServer: request life cycle, body and multipart delivery and
+// event sources as in ESPAsyncWebServer 1.2.x, driven by AsyncHostConnection
+#include <ESPAsyncWebServer.h>
+#include "host_sim.h"
+
+// Size of the buffer multipart file data is collected in before
+// handleUpload() (WebRequest.cpp's _itemBuffer)
+#define ITEM_BUFFER_SIZE 1460
+
+enum {
+  MULTIPART_PREAMBLE = 0,
+  MULTIPART_HEADERS,
+  MULTIPART_DATA,
+  MULTIPART_AFTER_DELIMITER,
+  MULTIPART_AFTER_DELIMITER_2,
+  MULTIPART_DONE,
+  MULTIPART_FAILED
+};
+
+static WebRequestMethodComposite toMethod(const String& method){
+  if (method == "GET") {
+    return HTTP_GET;
+  } else if (method == "POST") {
+    return HTTP_POST;
+  } else if (method == "PUT") {
+    return HTTP_PUT;
+  } else if (method == "DELETE") {
+    return HTTP_DELETE;
+  } else if (method == "PATCH") {
+    return HTTP_PATCH;
+  } else if (method == "HEAD") {
+    return HTTP_HEAD;
+  }
+  return HTTP_OPTIONS;
+}
+
+static String urlDecode(const String& text){
+  String out;
+  for (unsigned i = 0; i < text.length(); i++) {
+    char c = text[i];
+    if (c == '+') {
+      out += ' ';
+    } else if (c == '%' && i + 2 < text.length()) {
+      out += (char)strtol(text.substring(i + 1, i + 3).c_str(), nullptr, 16);
+      i += 2;
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+// Counts the callbacks of a request on the stack, so a close() from inside
+// one is told apart from one made afterwards
+struct CallbackScope {
+  int& depth;
+  explicit CallbackScope(int& d) : depth(d) { depth++; }
+  ~CallbackScope() { depth--; }
+};
+
+// ---- AsyncClient -----------------------------------------------------------
+
+void AsyncClient::close(bool now){
+  if (!_request->live("client()->close()")) {
+    return;
+  }
+  if (_request->_callbackDepth > 0) {
+    // AsyncTCP runs the disconnect handlers and deletes the request inside
+    // close(); everything the callback and the parser do afterwards is a
+    // use after free
+    hostsim::fault("client()->close() inside a callback of " + _request->_url + " frees the request under its caller");
+    _request->_closeRequested = true;
+    return;
+  }
+  _request->_connection->close();
+}
+
+bool AsyncClient::connected() const{
+  return !_request->_deleted && !_request->_connection->closed();
+}
+
+// ---- AsyncWebServerRequest -------------------------------------------------
+
+AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* server, const hostsim::HttpRequest& request, hostsim::HttpExchange* exchange)
+  : _server(server), _client(this), _exchange(exchange) {
+  _method = toMethod(request.method);
+  int q = request.uri.indexOf('?');
+  _url = q < 0 ? request.uri : request.uri.substring(0, q);
+  if (q >= 0) {
+    addParams(request.uri.substring(q + 1), false);
+  }
+  for (auto& h : request.headers) {
+    _headers.emplace_back(new AsyncWebHeader(h.first, h.second));
+  }
+  _contentType = request.headerValue("Content-Type");
+  String length = request.headerValue("Content-Length");
+  _contentLength = length.length() > 0 ? (size_t)length.toInt() : request.body.size();
+  if (_contentType.startsWith("multipart/")) {
+    int b = _contentType.indexOf("boundary=");
+    _isMultipart = b >= 0;
+    _delimiter = "\r\n--" + (b >= 0 ? _contentType.substring(b + 9) : String()).str();
+  }
+}
+
+AsyncWebServerRequest::~AsyncWebServerRequest(){
+  free(_tempObject);
+}
+
+bool AsyncWebServerRequest::live(const char* what) const{
+  if (_deleted) {
+    hostsim::fault(String(what) + " on " + _url + " after the request was freed");
+    return false;
+  }
+  return true;
+}
+
+void AsyncWebServerRequest::addParams(const String& query, bool post){
+  int pos = 0;
+  while (pos < (int)query.length()) {
+    int amp = query.indexOf('&', pos);
+    if (amp < 0) {
+      amp = query.length();
+    }
+    String pair = query.substring(pos, amp);
+    int eq = pair.indexOf('=');
+    if (pair.length() > 0) {
+      String name = urlDecode(eq < 0 ? pair : pair.substring(0, eq));
+      String value = eq < 0 ? String() : urlDecode(pair.substring(eq + 1));
+      _params.emplace_back(new AsyncWebParameter(name, value, post));
+    }
+    pos = amp + 1;
+  }
+}
+
+AsyncClient* AsyncWebServerRequest::client(){
+  live("client()");
+  return &_client;
+}
+
+size_t AsyncWebServerRequest::contentLength() const{
+  live("contentLength()");
+  return _contentLength;
+}
+
+bool AsyncWebServerRequest::hasParam(const String& name, bool post, bool file) const{
+  return getParam(name, post, file) != nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post, bool file) const{
+  live("getParam()");
+  for (auto& p : _params) {
+    if (p->name() == name && p->isPost() == post && p->isFile() == file) {
+      return p.get();
+    }
+  }
+  return nullptr;
+}
+
+bool AsyncWebServerRequest::hasArg(const char* name) const{
+  live("hasArg()");
+  for (auto& p : _params) {
+    if (p->name() == name && !p->isFile()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const String& AsyncWebServerRequest::arg(const char* name) const{
+  static const String empty;
+  live("arg()");
+  for (auto& p : _params) {
+    if (p->name() == name && !p->isFile()) {
+      return p->value();
+    }
+  }
+  return empty;
+}
+
+bool AsyncWebServerRequest::hasHeader(const String& name) const{
+  return getHeader(name) != nullptr;
+}
+
+AsyncWebHeader* AsyncWebServerRequest::getHeader(const char* name) const{
+  live("getHeader()");
+  for (auto& h : _headers) {
+    if (h->name().equalsIgnoreCase(name)) {
+      return h.get();
+    }
+  }
+  return nullptr;
+}
+
+bool AsyncWebServerRequest::authenticate(const char* username, const char* password, const char* realm, bool passwordIsHash){
+  AsyncWebHeader* header = getHeader("Authorization");
+  return header && header->value() == "Basic " + hostsim::base64(String(username) + ":" + password);
+}
+
+void AsyncWebServerRequest::requestAuthentication(const char* realm, bool isDigest){
+  AsyncWebServerResponse* response = beginResponse(401);
+  response->addHeader("WWW-Authenticate", String("Basic realm=\"") + (realm ? realm : "Login Required") + "\"");
+  send(response);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const String& contentType, const String& content){
+  return new AsyncWebServerResponse(code, contentType, content.str());
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t len, void* callback){
+  return new AsyncWebServerResponse(code, contentType, std::string((const char*)content, len));
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response){
+  std::unique_ptr<AsyncWebServerResponse> owned(response);
+  if (!live("send()")) {
+    return;
+  }
+  if (_sent) {
+    hostsim::fault("second response to " + _url + ": " + String(response->code()) + " after " + String(_exchange->code()));
+    return;
+  }
+  _sent = true;
+  hostsim::HttpResponse out;
+  out.code = response->_code;
+  out.contentType = response->_contentType;
+  out.body = response->_content;
+  out.headers = response->_headers;
+  _exchange->responses.push_back(out);
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content){
+  send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::onDisconnect(ArDisconnectHandler fn){
+  if (live("onDisconnect()")) {
+    _onDisconnect.push_back(fn);
+  }
+}
+
+void AsyncWebServerRequest::parseMultipart(const uint8_t* data, size_t len){
+  for (size_t i = 0; i < len && _multipartState != MULTIPART_FAILED && !_closeRequested; i++) {
+    multipartByte(data[i]);
+  }
+}
+
+void AsyncWebServerRequest::multipartByte(uint8_t c){
+  switch (_multipartState) {
+    case MULTIPART_PREAMBLE:
+    case MULTIPART_HEADERS:
+      if (c != '\n') {
+        _multipartLine += (char)c;
+        return;
+      }
+      if (!_multipartLine.empty() && _multipartLine.back() == '\r') {
+        _multipartLine.pop_back();
+      }
+      if (_multipartState == MULTIPART_PREAMBLE) {
+        if (_delimiter.compare(2, std::string::npos, _multipartLine) == 0) {
+          _multipartState = MULTIPART_HEADERS;
+          _itemName = String();
+          _itemFilename = String();
+        }
+      } else if (_multipartLine.empty()) {
+        _multipartState = MULTIPART_DATA;
+        _itemValue = String();
+        _itemBuffer.clear();
+        _itemSize = 0;
+        _pending.clear();
+      } else {
+        String header(_multipartLine);
+        String lower(_multipartLine);
+        lower.toLowerCase();
+        if (lower.startsWith("content-disposition:")) {
+          int n = header.indexOf("name=\"");
+          if (n >= 0) {
+            _itemName = header.substring(n + 6, header.indexOf('"', n + 6));
+          }
+          int f = header.indexOf("filename=\"");
+          if (f >= 0) {
+            _itemFilename = header.substring(f + 10, header.indexOf('"', f + 10));
+          }
+        }
+      }
+      _multipartLine.clear();
+      return;
+    case MULTIPART_DATA: {
+      _pending += (char)c;
+      while (!_pending.empty() && _delimiter.compare(0, _pending.size(), _pending) != 0) {
+        uploadByte((uint8_t)_pending[0]);
+        _pending.erase(0, 1);
+      }
+      if (_pending == _delimiter) {
+        _pending.clear();
+        finishItem();
+        _multipartState = MULTIPART_AFTER_DELIMITER;
+      }
+      return;
+    }
+    case MULTIPART_AFTER_DELIMITER:
+      _multipartLine = std::string(1, (char)c);
+      _multipartState = MULTIPART_AFTER_DELIMITER_2;
+      return;
+    case MULTIPART_AFTER_DELIMITER_2:
+      _multipartLine += (char)c;
+      if (_multipartLine == "--") {
+        _multipartState = MULTIPART_DONE;
+      } else {
+        _multipartState = MULTIPART_HEADERS;
+        _itemName = String();
+        _itemFilename = String();
+      }
+      _multipartLine.clear();
+      return;
+    default:
+      return;
+  }
+}
+
+void AsyncWebServerRequest::uploadByte(uint8_t c){
+  if (_itemFilename.length() == 0) {
+    _itemValue += (char)c;
+    return;
+  }
+  _itemBuffer += (char)c;
+  _itemSize++;
+  if (_itemBuffer.size() == ITEM_BUFFER_SIZE) {
+    if (_handler) {
+      CallbackScope scope(_callbackDepth);
+      _handler->handleUpload(this, _itemFilename, _itemSize - ITEM_BUFFER_SIZE, (uint8_t*)&_itemBuffer[0], ITEM_BUFFER_SIZE, false);
+    }
+    _itemBuffer.clear();
+  }
+}
+
+void AsyncWebServerRequest::finishItem(){
+  if (_itemFilename.length() == 0) {
+    _params.emplace_back(new AsyncWebParameter(_itemName, _itemValue, true));
+    return;
+  }
+  _params.emplace_back(new AsyncWebParameter(_itemName, _itemFilename, true, true));
+  if (_handler) {
+    CallbackScope scope(_callbackDepth);
+    _handler->handleUpload(this, _itemFilename, _itemSize - _itemBuffer.size(),
+                           (uint8_t*)_itemBuffer.data(), _itemBuffer.size(), true);
+  }
+  _itemBuffer.clear();
+}
+
+// ---- Handlers --------------------------------------------------------------
+
+AsyncWebHandler& AsyncWebHandler::setAuthentication(const char* username, const char* password){
+  _username = username ? username : "";
+  _password = password ? password : "";
+  return *this;
+}
+
+bool AsyncCallbackWebHandler::canHandle(AsyncWebServerRequest* request){
+  return _onRequest && (_method & request->method()) && request->url() == _uri;
+}
+
+void AsyncCallbackWebHandler::handleRequest(AsyncWebServerRequest* request){
+  if (_username.length() && _password.length() && !request->authenticate(_username.c_str(), _password.c_str())) {
+    return request->requestAuthentication();
+  }
+  if (_onRequest) {
+    _onRequest(request);
+  } else {
+    request->send(500);
+  }
+}
+
+void AsyncCallbackWebHandler::handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final){
+  if (_onUpload) {
+    _onUpload(request, filename, index, data, len, final);
+  }
+}
+
+void AsyncCallbackWebHandler::handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total){
+  if (_onBody) {
+    _onBody(request, data, len, index, total);
+  }
+}
+
+void AsyncEventSource::send(const char* message, const char* event, uint32_t id, uint32_t reconnect){
+  std::string frame;
+  if (reconnect) {
+    frame += "retry: " + std::to_string(reconnect) + "\r\n";
+  }
+  if (id) {
+    frame += "id: " + std::to_string(id) + "\r\n";
+  }
+  if (event) {
+    frame += std::string("event: ") + event + "\r\n";
+  }
+  frame += std::string("data: ") + message + "\r\n\r\n";
+  for (auto& client : _clients) {
+    if (client->_connected) {
+      client->_received += frame;
+      client->_lastId = id;
+    }
+  }
+}
+
+size_t AsyncEventSource::count() const{
+  size_t n = 0;
+  for (auto& client : _clients) {
+    n += client->_connected ? 1 : 0;
+  }
+  return n;
+}
+
+void AsyncEventSource::close(){
+  for (auto& client : _clients) {
+    client->close();
+  }
+}
+
+bool AsyncEventSource::canHandle(AsyncWebServerRequest* request){
+  return request->method() == HTTP_GET && request->url() == _url;
+}
+
+void AsyncEventSource::handleRequest(AsyncWebServerRequest* request){
+  if (_username.length() && _password.length() && !request->authenticate(_username.c_str(), _password.c_str())) {
+    return request->requestAuthentication();
+  }
+  // The connection now belongs to the event source
+  request->_kept = true;
+  hostConnect();
+}
+
+AsyncEventSourceClient* AsyncEventSource::hostConnect(){
+  _clients.emplace_back(new AsyncEventSourceClient());
+  AsyncEventSourceClient* client = _clients.back().get();
+  if (_connect) {
+    _connect(client);
+  }
+  return client;
+}
+
+// ---- Connections -----------------------------------------------------------
+
+AsyncHostConnection::~AsyncHostConnection(){
+  close();
+}
+
+size_t AsyncHostConnection::remaining() const{
+  size_t end = std::min(_source.body.size(), _source.disconnectAfter);
+  return _delivered < end ? end - _delivered : 0;
+}
+
+bool AsyncHostConnection::sendSegment(size_t len){
+  if (_closed || remaining() == 0 || len == 0) {
+    return false;
+  }
+  _segment.resize(len);
+  size_t got = 0;
+  while (got < len) {
+    size_t n = _reader->read(_segment.data() + got, len - got);
+    if (n == 0) {
+      break;
+    }
+    got += n;
+  }
+  if (got == 0) {
+    return false;
+  }
+  deliver(_segment.data(), got);
+  return true;
+}
+
+void AsyncHostConnection::sendAll(size_t segment){
+  while (!_closed && remaining() > 0) {
+    size_t len = segment > 0 ? segment : _reader->available();
+    if (!sendSegment(len)) {
+      break;
+    }
+  }
+  if (!_closed && remaining() == 0 && _delivered < _request->_contentLength) {
+    // The client sent what it was going to and left
+    disconnect();
+  }
+}
+
+void AsyncHostConnection::disconnect(){
+  close();
+}
+
+void AsyncHostConnection::deliver(uint8_t* data, size_t len){
+  AsyncWebServerRequest* request = _request.get();
+  size_t index = _delivered;
+  _delivered += len;
+  _exchange.bodyRead = _delivered;
+  if (request->_isMultipart) {
+    request->parseMultipart(data, len);
+  } else if (request->_contentType.startsWith("application/x-www-form-urlencoded")) {
+    request->_formBody.append((const char*)data, len);
+  } else if (request->_handler) {
+    CallbackScope scope(request->_callbackDepth);
+    request->_handler->handleBody(request, data, len, index, request->_contentLength);
+  }
+  if (request->_closeRequested) {
+    close();
+    return;
+  }
+  if (_delivered >= request->_contentLength) {
+    complete();
+  }
+}
+
+void AsyncHostConnection::complete(){
+  AsyncWebServerRequest* request = _request.get();
+  if (_closed) {
+    return;
+  }
+  if (request->_formBody.size() > 0) {
+    request->addParams(String(request->_formBody), true);
+  }
+  {
+    CallbackScope scope(request->_callbackDepth);
+    if (request->_handler) {
+      request->_handler->handleRequest(request);
+    } else if (_server->_notFound) {
+      _server->_notFound(request);
+    } else {
+      request->send(404);
+    }
+  }
+  _exchange.handled = true;
+  if (!request->_kept) {
+    close();
+  }
+}
+
+void AsyncHostConnection::close(){
+  if (_closed || !_request) {
+    return;
+  }
+  _closed = true;
+  AsyncWebServerRequest* request = _request.get();
+  {
+    CallbackScope scope(request->_callbackDepth);
+    for (auto& fn : request->_onDisconnect) {
+      fn();
+    }
+  }
+  // The request is freed here; its memory is kept so later use through a
+  // stale pointer is reported instead of corrupting the test
+  free(request->_tempObject);
+  request->_tempObject = nullptr;
+  request->_deleted = true;
+}
+
+// ---- Server ----------------------------------------------------------------
+
+AsyncWebServer::AsyncWebServer(uint16_t port){}
+
+AsyncWebServer::~AsyncWebServer(){}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, ArRequestHandlerFunction onRequest){
+  return on(uri, HTTP_ANY, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest){
+  return on(uri, method, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                            ArUploadHandlerFunction onUpload){
+  return on(uri, method, onRequest, onUpload, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                            ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody){
+  AsyncCallbackWebHandler* handler = new AsyncCallbackWebHandler(uri, method, onRequest, onUpload, onBody);
+  _ownHandlers.emplace_back(handler);
+  _handlers.push_back(handler);
+  return *handler;
+}
+
+AsyncWebHandler& AsyncWebServer::addHandler(AsyncWebHandler* handler){
+  _handlers.push_back(handler);
+  return *handler;
+}
+
+bool AsyncWebServer::removeHandler(AsyncWebHandler* handler){
+  auto it = std::find(_handlers.begin(), _handlers.end(), handler);
+  if (it == _handlers.end()) {
+    return false;
+  }
+  _handlers.erase(it);
+  return true;
+}
+
+std::unique_ptr<AsyncHostConnection> AsyncWebServer::connect(const hostsim::HttpRequest& request){
+  std::unique_ptr<AsyncHostConnection> connection(new AsyncHostConnection());
+  connection->_server = this;
+  connection->_source = request;
+  connection->_reader.reset(new hostsim::BodyReader(connection->_source.body, connection->_source.disconnectAfter));
+  connection->_request.reset(new AsyncWebServerRequest(this, connection->_source, &connection->_exchange));
+  AsyncWebServerRequest* req = connection->_request.get();
+  req->_connection = connection.get();
+  for (AsyncWebHandler* handler : _handlers) {
+    if (handler->canHandle(req)) {
+      req->_handler = handler;
+      break;
+    }
+  }
+  if (req->_contentLength == 0) {
+    connection->complete();
+  }
+  return connection;
+}
+
+hostsim::HttpExchange AsyncWebServer::serve(const hostsim::HttpRequest& request){
+  std::unique_ptr<AsyncHostConnection> connection = connect(request);
+  connection->sendAll();
+  connection->close();
+  return connection->exchange();
+}
+
+AsyncEventSource* AsyncWebServer::eventSource(const String& url){
+  for (AsyncWebHandler* handler : _handlers) {
+    AsyncEventSource* source = dynamic_cast<AsyncEventSource*>(handler);
+    if (source && url == source->url()) {
+      return source;
+    }
+  }
+  return nullptr;
+}
@@ -0,0 +1,461 @@
+// Synchronous WebServer: request parsing, multipart and raw bodies as in
+// arduino-esp32 2.x Parsing.cpp, over a BodyReader instead of a socket
+#include <WebServer.h>
+#include "host_sim.h"
+
+static HTTPMethod toMethod(const String& method){
+  if (method == "GET") {
+    return HTTP_GET;
+  } else if (method == "POST") {
+    return HTTP_POST;
+  } else if (method == "PUT") {
+    return HTTP_PUT;
+  } else if (method == "DELETE") {
+    return HTTP_DELETE;
+  } else if (method == "PATCH") {
+    return HTTP_PATCH;
+  } else if (method == "HEAD") {
+    return HTTP_HEAD;
+  }
+  return HTTP_OPTIONS;
+}
+
+static String urlDecode(const String& text){
+  String out;
+  for (unsigned i = 0; i < text.length(); i++) {
+    char c = text[i];
+    if (c == '+') {
+      out += ' ';
+    } else if (c == '%' && i + 2 < text.length()) {
+      out += (char)strtol(text.substring(i + 1, i + 3).c_str(), nullptr, 16);
+      i += 2;
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+WebServer::WebServer(int port){}
+
+WebServer::~WebServer(){}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn){
+  _routes.push_back(Route{uri, method, fn, ufn});
+}
+
+String WebServer::arg(const String& name) const{
+  for (auto& a : _args) {
+    if (a.first == name) {
+      return a.second;
+    }
+  }
+  return String();
+}
+
+String WebServer::arg(int i) const{
+  return i >= 0 && i < (int)_args.size() ? _args[i].second : String();
+}
+
+String WebServer::argName(int i) const{
+  return i >= 0 && i < (int)_args.size() ? _args[i].first : String();
+}
+
+bool WebServer::hasArg(const String& name) const{
+  for (auto& a : _args) {
+    if (a.first == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void WebServer::collectHeaders(const char* headerKeys[], const size_t headerKeysCount){
+  _headerKeys.clear();
+  for (size_t i = 0; i < headerKeysCount; i++) {
+    _headerKeys.push_back(headerKeys[i]);
+  }
+}
+
+String WebServer::header(const String& name) const{
+  for (auto& h : _headers) {
+    if (h.first.equalsIgnoreCase(name)) {
+      return h.second;
+    }
+  }
+  return String();
+}
+
+String WebServer::header(int i) const{
+  return i >= 0 && i < (int)_headers.size() ? _headers[i].second : String();
+}
+
+String WebServer::headerName(int i) const{
+  return i >= 0 && i < (int)_headers.size() ? _headers[i].first : String();
+}
+
+bool WebServer::hasHeader(const String& name) const{
+  for (auto& h : _headers) {
+    if (h.first.equalsIgnoreCase(name)) {
+      return h.second.length() > 0;
+    }
+  }
+  return false;
+}
+
+bool WebServer::authenticate(const char* username, const char* password){
+  String expected = "Basic " + hostsim::base64(String(username) + ":" + password);
+  return header("Authorization") == expected;
+}
+
+void WebServer::requestAuthentication(HTTPAuthMethod mode, const char* realm, const String& authFailMsg){
+  sendHeader("WWW-Authenticate", String("Basic realm=\"") + (realm ? realm : "Login Required") + "\"");
+  send(401, "text/html", authFailMsg);
+}
+
+void WebServer::send(int code, const char* content_type, const String& content){
+  if (!_exchange) {
+    hostsim::fault("WebServer::send() outside a request");
+    return;
+  }
+  if (!_exchange->responses.empty()) {
+    hostsim::fault("second response to " + _uri + ": " + String(code) + " after " + String(_exchange->responses.front().code));
+  }
+  // Nothing reaches a client that has been stopped
+  if (!_client.connected()) {
+    _responseHeaders.clear();
+    return;
+  }
+  hostsim::HttpResponse response;
+  response.code = code;
+  response.contentType = content_type ? content_type : "text/html";
+  response.body = content.str();
+  response.headers = _responseHeaders;
+  _responseHeaders.clear();
+  _exchange->responses.push_back(response);
+}
+
+void WebServer::send_P(int code, PGM_P content_type, PGM_P content){
+  send(code, content_type, String(content));
+}
+
+void WebServer::send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength){
+  send(code, content_type, String(content, contentLength));
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first){
+  if (first) {
+    _responseHeaders.insert(_responseHeaders.begin(), std::make_pair(name, value));
+  } else {
+    _responseHeaders.push_back(std::make_pair(name, value));
+  }
+}
+
+void WebServer::sendContent(const char* content, size_t contentLength){
+  if (_exchange && !_exchange->responses.empty()) {
+    _exchange->responses.back().body.append(content, contentLength);
+  }
+}
+
+HTTPUpload& WebServer::upload(){
+  if (!_currentUpload) {
+    // The core dereferences a null pointer here
+    hostsim::fault("upload() without a multipart upload on " + _uri);
+    static HTTPUpload dummy;
+    return dummy;
+  }
+  return *_currentUpload;
+}
+
+HTTPRaw& WebServer::raw(){
+  if (!_currentRaw) {
+    hostsim::fault("raw() without a raw body on " + _uri);
+    static HTTPRaw dummy;
+    return dummy;
+  }
+  return *_currentRaw;
+}
+
+void WebServer::reset(){
+  _uri = String();
+  _args.clear();
+  _headers.clear();
+  _contentLength = 0;
+  _body.reset();
+  _currentUpload.reset();
+  _currentRaw.reset();
+  _currentRoute = nullptr;
+  _exchange = nullptr;
+  _responseHeaders.clear();
+  _client = WiFiClient();
+}
+
+void WebServer::parseQuery(const String& query){
+  int pos = 0;
+  while (pos < (int)query.length()) {
+    int amp = query.indexOf('&', pos);
+    if (amp < 0) {
+      amp = query.length();
+    }
+    String pair = query.substring(pos, amp);
+    int eq = pair.indexOf('=');
+    if (pair.length() > 0) {
+      if (eq < 0) {
+        _args.push_back(std::make_pair(urlDecode(pair), String()));
+      } else {
+        _args.push_back(std::make_pair(urlDecode(pair.substring(0, eq)), urlDecode(pair.substring(eq + 1))));
+      }
+    }
+    pos = amp + 1;
+  }
+}
+
+int WebServer::uploadReadByte(){
+  if (!_client.connected()) {
+    return -1;
+  }
+  return _body->read();
+}
+
+void WebServer::uploadWriteByte(uint8_t b){
+  if (_currentUpload->currentSize == HTTP_UPLOAD_BUFLEN) {
+    callUpload();
+    _currentUpload->totalSize += _currentUpload->currentSize;
+    _currentUpload->currentSize = 0;
+  }
+  _currentUpload->buf[_currentUpload->currentSize++] = b;
+}
+
+void WebServer::callUpload(){
+  if (_currentRoute && _currentRoute->ufn) {
+    _currentRoute->ufn();
+  }
+}
+
+bool WebServer::uploadAborted(){
+  if (_currentUpload) {
+    _currentUpload->status = UPLOAD_FILE_ABORTED;
+    callUpload();
+  }
+  return false;
+}
+
+bool WebServer::parseForm(const String& boundary){
+  const std::string delimiter = "\r\n--" + boundary.str();
+  std::string line;
+  // Preamble up to the first boundary line
+  auto readLine = [this](std::string& out) -> bool {
+    out.clear();
+    for (;;) {
+      int c = uploadReadByte();
+      if (c < 0) {
+        return false;
+      }
+      if (c == '\n') {
+        if (!out.empty() && out.back() == '\r') {
+          out.pop_back();
+        }
+        return true;
+      }
+      out += (char)c;
+    }
+  };
+  if (!readLine(line) || line != "--" + boundary.str()) {
+    return false;
+  }
+  for (;;) {
+    String name;
+    String filename;
+    String type;
+    for (;;) {
+      if (!readLine(line)) {
+        return false;
+      }
+      if (line.empty()) {
+        break;
+      }
+      String header(line);
+      String lower(line);
+      lower.toLowerCase();
+      if (lower.startsWith("content-disposition:")) {
+        int n = header.indexOf("name=\"");
+        if (n >= 0) {
+          name = header.substring(n + 6, header.indexOf('"', n + 6));
+        }
+        int f = header.indexOf("filename=\"");
+        if (f >= 0) {
+          filename = header.substring(f + 10, header.indexOf('"', f + 10));
+        }
+      } else if (lower.startsWith("content-type:")) {
+        type = header.substring(13);
+        type.trim();
+      }
+    }
+    bool isFile = filename.length() > 0;
+    if (isFile) {
+      _currentUpload.reset(new HTTPUpload());
+      _currentUpload->status = UPLOAD_FILE_START;
+      _currentUpload->name = name;
+      _currentUpload->filename = filename;
+      _currentUpload->type = type;
+      _currentUpload->totalSize = 0;
+      _currentUpload->currentSize = 0;
+      callUpload();
+      _currentUpload->status = UPLOAD_FILE_WRITE;
+    }
+    // Bytes that may be the start of the delimiter are held back
+    std::string value;
+    std::string pending;
+    for (;;) {
+      int c = uploadReadByte();
+      if (c < 0) {
+        return isFile ? uploadAborted() : false;
+      }
+      pending += (char)c;
+      while (!pending.empty() && delimiter.compare(0, pending.size(), pending) != 0) {
+        if (isFile) {
+          uploadWriteByte((uint8_t)pending[0]);
+        } else {
+          value += pending[0];
+        }
+        pending.erase(0, 1);
+      }
+      if (pending == delimiter) {
+        break;
+      }
+    }
+    if (isFile) {
+      if (_currentUpload->currentSize > 0) {
+        callUpload();
+        _currentUpload->totalSize += _currentUpload->currentSize;
+        _currentUpload->currentSize = 0;
+      }
+      _currentUpload->status = UPLOAD_FILE_END;
+      callUpload();
+    } else {
+      _args.push_back(std::make_pair(name, String(value)));
+    }
+    int a = uploadReadByte();
+    int b = uploadReadByte();
+    if (a < 0 || b < 0) {
+      return false;
+    }
+    if (a == '-' && b == '-') {
+      return true;
+    }
+  }
+}
+
+bool WebServer::parseRaw(){
+  _currentRaw.reset(new HTTPRaw());
+  _currentRaw->status = RAW_START;
+  _currentRaw->totalSize = 0;
+  _currentRaw->currentSize = 0;
+  callUpload();
+  _currentRaw->status = RAW_WRITE;
+  while (_currentRaw->totalSize < _contentLength) {
+    // readBytes() fills the whole buffer unless the client goes away
+    size_t want = std::min(_contentLength - _currentRaw->totalSize, (size_t)HTTP_RAW_BUFLEN);
+    size_t got = 0;
+    while (got < want && _client.connected()) {
+      size_t n = _body->read(_currentRaw->buf + got, want - got);
+      if (n == 0) {
+        break;
+      }
+      got += n;
+    }
+    _currentRaw->currentSize = got;
+    _currentRaw->totalSize += got;
+    if (got == 0) {
+      _currentRaw->status = RAW_ABORTED;
+      callUpload();
+      return false;
+    }
+    callUpload();
+  }
+  _currentRaw->status = RAW_END;
+  callUpload();
+  return true;
+}
+
+hostsim::HttpExchange WebServer::serve(const hostsim::HttpRequest& request){
+  hostsim::HttpExchange exchange;
+  reset();
+  _exchange = &exchange;
+  _method = toMethod(request.method);
+  int q = request.uri.indexOf('?');
+  _uri = q < 0 ? request.uri : request.uri.substring(0, q);
+  if (q >= 0) {
+    parseQuery(request.uri.substring(q + 1));
+  }
+  for (auto& h : request.headers) {
+    bool collected = h.first.equalsIgnoreCase("Authorization");
+    for (auto& key : _headerKeys) {
+      collected = collected || h.first.equalsIgnoreCase(key);
+    }
+    if (collected) {
+      _headers.push_back(h);
+    }
+  }
+  String length = request.headerValue("Content-Length");
+  _contentLength = length.length() > 0 ? (size_t)length.toInt() : request.body.size();
+  _body.reset(new hostsim::BodyReader(request.body, request.disconnectAfter));
+  auto connection = std::make_shared<hostsim::Connection>();
+  connection->remoteIP = IPAddress(192, 168, 4, 2);
+  connection->remotePort = 50000;
+  _client = WiFiClient(connection);
+  exchange.connection = connection;
+
+  for (const Route& route : _routes) {
+    if (route.uri == _uri && (route.method == HTTP_ANY || route.method == _method)) {
+      _currentRoute = &route;
+      break;
+    }
+  }
+
+  bool parsed = true;
+  if (_method != HTTP_GET && _method != HTTP_HEAD && _contentLength > 0) {
+    String contentType = request.headerValue("Content-Type");
+    if (contentType.startsWith("multipart/")) {
+      int b = contentType.indexOf("boundary=");
+      parsed = b >= 0 && parseForm(contentType.substring(b + 9));
+    } else if (_currentRoute && _currentRoute->ufn) {
+      parsed = parseRaw();
+    } else {
+      std::string plain(_contentLength, '\0');
+      size_t got = 0;
+      while (got < _contentLength) {
+        size_t n = _body->read((uint8_t*)&plain[got], _contentLength - got);
+        if (n == 0) {
+          break;
+        }
+        got += n;
+      }
+      plain.resize(got);
+      if (contentType.startsWith("application/x-www-form-urlencoded")) {
+        parseQuery(String(plain));
+      } else {
+        _args.push_back(std::make_pair(String("plain"), String(plain)));
+      }
+      parsed = got == _contentLength;
+    }
+  }
+
+  if (parsed) {
+    if (_currentRoute) {
+      _currentRoute->fn();
+    } else if (_notFound) {
+      _notFound();
+    } else {
+      send(404, "text/plain", String("Not found: ") + _uri);
+    }
+    exchange.handled = true;
+  }
+  exchange.bodyRead = _body->consumed();
+  // The request's connection closes unless a handler kept a copy of it
+  _client = WiFiClient();
+  _exchange = nullptr;
+  _currentUpload.reset();
+  _currentRaw.reset();
+  return exchange;
+}
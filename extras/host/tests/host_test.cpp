@@ -0,0 +1,56 @@
+#include "host_test.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace hosttest {
+
+struct Entry {
+  const char* name;
+  void (*fn)();
+};
+
+static std::vector<Entry>& tests(){
+  static std::vector<Entry> all;
+  return all;
+}
+
+static int failures = 0;
+
+void registerTest(const char* name, void (*fn)()){
+  tests().push_back(Entry{name, fn});
+}
+
+void fail(const char* file, int line, const std::string& message){
+  printf("  %s:%d: %s\n", file, line, message.c_str());
+  failures++;
+}
+
+} // namespace hosttest
+
+// Runs every test, or those whose name contains the first argument
+int main(int argc, char** argv){
+  int failed = 0;
+  int run = 0;
+  for (const hosttest::Entry& test : hosttest::tests()) {
+    if (argc > 1 && !strstr(test.name, argv[1])) {
+      continue;
+    }
+    int before = hosttest::failures;
+    run++;
+    try {
+      test.fn();
+    } catch (const hosttest::Failure&) {
+    } catch (const hostsim::Restart&) {
+      hosttest::fail(__FILE__, __LINE__, "unexpected ESP.restart()");
+    }
+    for (const String& fault : hostsim::faults()) {
+      hosttest::fail(test.name, 0, "fault: " + fault.str());
+    }
+    hostsim::clearFaults();
+    bool ok = hosttest::failures == before;
+    failed += ok ? 0 : 1;
+    printf("%s %s\n", ok ? "PASS" : "FAIL", test.name);
+  }
+  printf("%d of %d tests passed\n", run - failed, run);
+  return failed == 0 ? 0 : 1;
+}
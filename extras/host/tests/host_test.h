@@ -0,0 +1,82 @@
+#ifndef host_test_h
+#define host_test_h
+
+// A few macros in place of a test framework: TEST() registers a function,
+// CHECK*() record a failure and carry on, REQUIRE() stops the test
+#include <ESP32FwUploader.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include "host_sim.h"
+
+namespace hosttest {
+
+struct Failure {};
+
+void registerTest(const char* name, void (*fn)());
+void fail(const char* file, int line, const std::string& message);
+
+struct Registration {
+  Registration(const char* name, void (*fn)()) { registerTest(name, fn); }
+};
+
+template<typename T>
+std::string show(const T& value) { return std::to_string(value); }
+inline std::string show(const String& value) { return "\"" + value.str() + "\""; }
+inline std::string show(const std::string& value) { return "\"" + value.substr(0, 120) + (value.size() > 120 ? "...\"" : "\""); }
+inline std::string show(const char* value) { return value ? "\"" + std::string(value) + "\"" : "null"; }
+inline std::string show(bool value) { return value ? "true" : "false"; }
+
+// A freshly booted device with the uploader serving on the backend under
+// test. Auto reboot is off so a finished update can be inspected.
+class Device{
+  public:
+    ESP32FW_WEBSERVER server;
+    ESP32FwUploaderClass* uploader;
+
+    Device() : server(80) {
+      hostsim::reset();
+      uploader = new ESP32FwUploaderClass();
+      uploader->setAutoReboot(false);
+      uploader->begin(&server);
+    }
+    ~Device() { delete uploader; }
+
+    hostsim::HttpExchange serve(const hostsim::HttpRequest& request) { return server.serve(request); }
+
+    // Runs loop() n times; true if it asked for a restart
+    bool loop(int n = 1) {
+      try {
+        for (int i = 0; i < n; i++) {
+          uploader->loop();
+        }
+      } catch (const hostsim::Restart&) {
+        return true;
+      }
+      return false;
+    }
+
+    std::string installed(size_t len) {
+      return hostsim::readFlash(hostsim::partition("app1"), 0, len);
+    }
+};
+
+} // namespace hosttest
+
+#define TEST(name) \
+  static void test_##name(); \
+  static hosttest::Registration registration_##name(#name, test_##name); \
+  static void test_##name()
+
+#define CHECK(cond) \
+  do { if (!(cond)) hosttest::fail(__FILE__, __LINE__, "CHECK(" #cond ")"); } while (0)
+
+#define CHECK_EQ(a, b) \
+  do { auto _a = (a); auto _b = (b); \
+    if (!(_a == _b)) hosttest::fail(__FILE__, __LINE__, "CHECK_EQ(" #a ", " #b "): " + hosttest::show(_a) + " != " + hosttest::show(_b)); \
+  } while (0)
+
+#define REQUIRE(cond) \
+  do { if (!(cond)) { hosttest::fail(__FILE__, __LINE__, "REQUIRE(" #cond ")"); throw hosttest::Failure(); } } while (0)
+
+#endif
@@ -0,0 +1,21 @@
+// The library with every optional feature compiled out still builds, links,
+// installs an update and refuses what it was built without
+#include <ESP32FwUploader.h>
+#include "host_sim.h"
+
+int main(){
+  hostsim::reset();
+  ESP32FW_WEBSERVER server(80);
+  ESP32FwUploaderClass uploader;
+  uploader.setAutoReboot(false);
+  uploader.begin(&server);
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 3);
+  hostsim::HttpExchange exchange = server.serve(hostsim::HttpRequest::multipart("POST", "/ota/upload", image));
+  bool installed = exchange.code() == 200 && hostsim::readFlash(hostsim::partition("app1"), 0, image.size()) == image;
+  printf("%s\n", installed ? "minimal build installs updates" : "minimal build failed to install");
+  // Compressed images are refused, not written as they are
+  exchange = server.serve(hostsim::HttpRequest::multipart("POST", "/ota/upload", hostsim::gzip(image)));
+  bool refused = exchange.body() == "FAIL" && uploader.getLastError() == ESP32FW_ERROR_INVALID_FILE;
+  printf("%s\n", refused ? "minimal build refuses compressed images" : "minimal build accepted a compressed image");
+  return installed && refused ? 0 : 1;
+}
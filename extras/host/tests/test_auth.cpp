@@ -0,0 +1,50 @@
+// Uploads refused by setAuth() before any of their body is used
+#include "host_test.h"
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+TEST(rejected_upload_writes_nothing){
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 81);
+  HttpRequest requests[] = {
+    HttpRequest::multipart("POST", "/ota/upload", image),
+    HttpRequest::raw("POST", "/ota/raw", image),
+    HttpRequest::raw("POST", "/ota/raw", image).basicAuth("admin", "wrong"),
+  };
+  for (const HttpRequest& request : requests) {
+    Device device;
+    device.uploader->setAuth("admin", "secret");
+    hostsim::HttpExchange exchange = device.serve(request);
+    CHECK_EQ(exchange.code(), 401);
+    CHECK_EQ(exchange.responses.size(), (size_t)1);
+    CHECK_EQ(hostsim::updateWriteCalls(), 0u);
+    CHECK_EQ(device.uploader->getLastError(), ESP32FW_ERROR_AUTH_FAILED);
+    CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+  }
+}
+
+TEST(upload_after_a_rejected_one_is_taken){
+  Device device;
+  device.uploader->setAuth("admin", "secret");
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 82);
+  CHECK_EQ(device.serve(HttpRequest::raw("POST", "/ota/raw", image)).code(), 401);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", image).basicAuth("admin", "secret"));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+}
+
+#if defined(ESP32FW_ASYNC_WEBSERVER)
+// The body keeps arriving after the 401 has been sent: none of it may reach
+// the uploader, and the connection must not be closed under the server
+TEST(async_rejected_upload_ignores_the_rest_of_its_body){
+  Device device;
+  device.uploader->setAuth("admin", "secret");
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 83);
+  std::unique_ptr<AsyncHostConnection> connection = device.server.connect(HttpRequest::raw("POST", "/ota/raw", image));
+  CHECK(connection->sendSegment(1436));
+  CHECK_EQ(connection->exchange().code(), 401);
+  connection->sendAll(1436);
+  CHECK_EQ(connection->exchange().responses.size(), (size_t)1);
+  CHECK_EQ(hostsim::updateWriteCalls(), 0u);
+}
+#endif
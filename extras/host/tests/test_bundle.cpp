@@ -0,0 +1,95 @@
+// Bundles: firmware and file system in one upload, firmware first
+#include "host_test.h"
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+struct BundleSection {
+  uint32_t type;
+  std::string data;
+  std::string sha256Hex;  // hash written to the manifest; empty for the real one
+};
+
+static void putLE32(std::string& out, uint32_t value){
+  for (int i = 0; i < 4; i++) {
+    out += (char)((value >> (8 * i)) & 0xFF);
+  }
+}
+
+// The layout tools/make_bundle.py writes
+static std::string makeBundle(const std::vector<BundleSection>& sections){
+  std::string out = ESP32FW_BUNDLE_MAGIC;
+  putLE32(out, ESP32FW_BUNDLE_VERSION);
+  putLE32(out, sections.size());
+  for (const BundleSection& section : sections) {
+    putLE32(out, section.type);
+    putLE32(out, section.data.size());
+    std::string hex = section.sha256Hex.empty() ? hostsim::sha256Hex(section.data) : section.sha256Hex;
+    for (size_t i = 0; i < hex.size(); i += 2) {
+      out += (char)strtoul(hex.substr(i, 2).c_str(), nullptr, 16);
+    }
+  }
+  for (const BundleSection& section : sections) {
+    out += section.data;
+  }
+  return out;
+}
+
+static bool erased(const esp_partition_t* partition, size_t len){
+  return hostsim::readFlash(partition, 0, len) == std::string(len, '\xFF');
+}
+
+TEST(bundle_installs_firmware_and_filesystem){
+  Device device;
+  std::string firmware = hostsim::makeFirmwareImage(96 * 1024, 71);
+  std::string filesystem = hostsim::makeFileSystemImage(64 * 1024, 72);
+  std::string bundle = makeBundle({{ESP32FW_BUNDLE_FIRMWARE, firmware, ""}, {ESP32FW_BUNDLE_FILESYSTEM, filesystem, ""}});
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", bundle));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(firmware.size()) == firmware);
+  CHECK(hostsim::readFlash(hostsim::partition("spiffs"), 0, filesystem.size()) == filesystem);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app1"));
+}
+
+TEST(bundle_with_filesystem_before_firmware_is_refused){
+  Device device;
+  std::string firmware = hostsim::makeFirmwareImage(64 * 1024, 73);
+  std::string filesystem = hostsim::makeFileSystemImage(64 * 1024, 74);
+  std::string bundle = makeBundle({{ESP32FW_BUNDLE_FILESYSTEM, filesystem, ""}, {ESP32FW_BUNDLE_FIRMWARE, firmware, ""}});
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", bundle));
+  CHECK_EQ(exchange.body(), std::string("FAIL"));
+  CHECK(erased(hostsim::partition("spiffs"), filesystem.size()));
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
+
+TEST(bundle_with_bad_firmware_leaves_filesystem_untouched){
+  Device device;
+  std::string firmware = hostsim::makeFirmwareImage(64 * 1024, 75);
+  std::string filesystem = hostsim::makeFileSystemImage(64 * 1024, 76);
+  std::string wrong(64, '0');
+  std::string bundle = makeBundle({{ESP32FW_BUNDLE_FIRMWARE, firmware, wrong}, {ESP32FW_BUNDLE_FILESYSTEM, filesystem, ""}});
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", bundle));
+  CHECK_EQ(exchange.body(), std::string("FAIL"));
+  CHECK(erased(hostsim::partition("spiffs"), filesystem.size()));
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
+
+TEST(bundle_failing_after_firmware_keeps_running_firmware){
+  std::string firmware = hostsim::makeFirmwareImage(64 * 1024, 77);
+  std::string filesystem = hostsim::makeFileSystemImage(64 * 1024, 78);
+  std::string wrong(64, '0');
+  std::string good = makeBundle({{ESP32FW_BUNDLE_FIRMWARE, firmware, ""}, {ESP32FW_BUNDLE_FILESYSTEM, filesystem, ""}});
+  // A bad file system section, and a good bundle that misses the digest
+  // given for the whole upload
+  HttpRequest requests[] = {
+    HttpRequest::raw("POST", "/ota/raw", makeBundle({{ESP32FW_BUNDLE_FIRMWARE, firmware, ""}, {ESP32FW_BUNDLE_FILESYSTEM, filesystem, wrong}})),
+    HttpRequest::raw("POST", "/ota/raw?sha256=" + String(wrong.c_str()), good),
+  };
+  for (const HttpRequest& request : requests) {
+    Device device;
+    hostsim::HttpExchange exchange = device.serve(request);
+    CHECK_EQ(exchange.body(), std::string("FAIL"));
+    CHECK(device.installed(firmware.size()) == firmware);
+    CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+  }
+}
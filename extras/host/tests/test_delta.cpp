@@ -0,0 +1,110 @@
+// Delta patches against the running firmware
+#include "host_test.h"
+#include <delta_patch.h>
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+static void putLE32(std::string& out, uint32_t v){
+  for (int i = 0; i < 4; i++) {
+    out += (char)(v >> (8 * i));
+  }
+}
+
+static std::string unhex(const std::string& hex){
+  std::string out;
+  for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+    out += (char)strtol(hex.substr(i, 2).c_str(), nullptr, 16);
+  }
+  return out;
+}
+
+// One diff run over the common length and the rest of the target as extra
+// bytes; bigger than what make_delta.py writes but in the same format
+static std::string makePatch(const std::string& source, const std::string& target){
+  std::string patch = ESP32FW_DELTA_MAGIC;
+  putLE32(patch, ESP32FW_DELTA_VERSION);
+  putLE32(patch, source.size());
+  putLE32(patch, target.size());
+  patch += unhex(hostsim::sha256Hex(source));
+  patch += unhex(hostsim::sha256Hex(target));
+  size_t common = std::min(source.size(), target.size());
+  putLE32(patch, common);
+  putLE32(patch, target.size() - common);
+  putLE32(patch, 0);
+  for (size_t i = 0; i < common; i++) {
+    patch += (char)(uint8_t)(target[i] - source[i]);
+  }
+  patch.append(target, common, std::string::npos);
+  return patch;
+}
+
+static std::string runningImage(){
+  return hostsim::readFlash(hostsim::partition("app0"), 0, 0x40000);
+}
+
+TEST(delta_patch_installs_target){
+  Device device;
+  std::string target = hostsim::makeFirmwareImage(0x40000 + 4096, 7, "1.0.0");
+  std::string patch = makePatch(runningImage(), target);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", hostsim::gzip(patch), "update.patch.gz"));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(target.size()) == target);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app1"));
+}
+
+TEST(delta_patch_for_other_firmware_is_refused){
+  Device device;
+  std::string target = hostsim::makeFirmwareImage(0x40000, 7, "1.0.0");
+  std::string patch = makePatch(runningImage(), target);
+  hostsim::installRunning(hostsim::makeFirmwareImage(0x40000, 8, "0.9.1"));
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", patch));
+  CHECK_EQ(exchange.body(), std::string("FAIL"));
+  CHECK(strstr(device.uploader->getLastErrorMessage().c_str(), "different firmware") != nullptr);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
+
+// The source used to be hashed in full when the header arrived; now each
+// write() reads about as much of it as it produces
+TEST(delta_source_is_hashed_in_step_with_output){
+  hostsim::reset();
+  std::string source = runningImage();
+  std::string target = hostsim::makeFirmwareImage(0x40000, 7, "1.0.0");
+  std::string patch = makePatch(source, target);
+  std::string out;
+  ESP32FwDeltaPatcher patcher;
+  patcher.begin([&](uint8_t* data, size_t len){ out.append((const char*)data, len); return true; });
+  uint64_t readBefore = hostsim::flashStats().bytesRead;
+  REQUIRE(patcher.write((uint8_t*)&patch[0], ESP32FW_DELTA_HEADER_SIZE));
+  CHECK(hostsim::flashStats().bytesRead - readBefore < 1024);
+  uint64_t worst = 0;
+  for (size_t pos = ESP32FW_DELTA_HEADER_SIZE; pos < patch.size(); pos += 1436) {
+    uint64_t before = hostsim::flashStats().bytesRead;
+    REQUIRE(patcher.write((uint8_t*)&patch[pos], std::min((size_t)1436, patch.size() - pos)));
+    worst = std::max(worst, hostsim::flashStats().bytesRead - before);
+  }
+  // Diff reads plus the source hash slice, each about one chunk
+  CHECK(worst < 4 * 1436);
+  uint64_t beforeFinish = hostsim::flashStats().bytesRead;
+  CHECK(patcher.finish());
+  CHECK(hostsim::flashStats().bytesRead - beforeFinish < 1024);
+  CHECK(out == target);
+}
+
+TEST(delta_patch_uses_known_running_digest){
+  Device device;
+  device.uploader->setSkipUpToDate(true);
+  for (int i = 0; i < 10000 && device.uploader->getRunningSHA256() == ""; i++) {
+    device.loop();
+  }
+  REQUIRE(device.uploader->getRunningSHA256() != "");
+  std::string target = hostsim::makeFirmwareImage(0x40000, 7, "1.0.0");
+  std::string other = makePatch(hostsim::makeFirmwareImage(0x40000, 8, "0.9.1"), target);
+  // Refused at the header, before anything reaches Update
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", other));
+  CHECK_EQ(exchange.body(), std::string("FAIL"));
+  CHECK_EQ(hostsim::updateWriteCalls(), 0u);
+  exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", makePatch(runningImage(), target)));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(target.size()) == target);
+}
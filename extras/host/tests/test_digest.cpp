@@ -0,0 +1,38 @@
+// Expected digests sent with an upload
+#include "host_test.h"
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+TEST(matching_digests_are_accepted){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(200 * 1024, 20);
+  HttpRequest request = HttpRequest::multipart("POST", "/ota/upload", image);
+  request.header("X-Firmware-SHA256", hostsim::sha256Hex(image).c_str());
+  request.header("X-Firmware-MD5", hostsim::md5Hex(image).c_str());
+  CHECK_EQ(device.serve(request).body(), std::string("OK"));
+  CHECK_EQ(device.uploader->getLastSHA256(), String(hostsim::sha256Hex(image).c_str()));
+  CHECK_EQ(device.uploader->getLastMD5(), String(hostsim::md5Hex(image).c_str()));
+}
+
+TEST(sha256_mismatch_is_refused_before_commit){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(200 * 1024, 21);
+  HttpRequest request = HttpRequest::raw("POST", "/ota/raw", image);
+  request.header("X-Firmware-SHA256", hostsim::sha256Hex("something else").c_str());
+  hostsim::HttpExchange exchange = device.serve(request);
+  CHECK(exchange.code() != 200 || exchange.body() != "OK");
+  CHECK(strstr(device.uploader->getLastErrorMessage().c_str(), "SHA-256 mismatch") != nullptr);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+  // The measured digest is still reported
+  CHECK_EQ(device.uploader->getLastSHA256(), String(hostsim::sha256Hex(image).c_str()));
+}
+
+TEST(md5_mismatch_is_refused_before_commit){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(200 * 1024, 22);
+  HttpRequest request = HttpRequest::multipart("POST", "/ota/upload", image);
+  request.header("X-Firmware-MD5", hostsim::md5Hex("something else").c_str());
+  CHECK_EQ(device.serve(request).body(), std::string("FAIL"));
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
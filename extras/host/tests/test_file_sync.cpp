@@ -0,0 +1,153 @@
+// Per-file sync through /ota/fs/begin, /ota/fs/file and /ota/fs/finish
+#include "host_test.h"
+#include <SPIFFS.h>
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+static void writeFile(const char* path, const std::string& content){
+  fs::File file = SPIFFS.open(path, FILE_WRITE);
+  file.write((const uint8_t*)content.data(), content.size());
+  file.close();
+}
+
+static std::string readFile(const char* path){
+  fs::File file = SPIFFS.open(path, FILE_READ);
+  std::string content(file.size(), '\0');
+  file.read((uint8_t*)&content[0], content.size());
+  return content;
+}
+
+static String syncId(const std::string& json){
+  size_t at = json.find("\"sync\":");
+  return at == std::string::npos ? String() : String(atol(json.c_str() + at + 7));
+}
+
+// Sends the manifest for /index.html and /app.js, then the files the
+// device asks for, and finishes
+static hostsim::HttpExchange syncFiles(Device& device, const char* query, std::string* begin = nullptr){
+  std::string index = "<html>new</html>";
+  std::string app = "console.log(1)";
+  std::string manifest = hostsim::sha256Hex(index) + " /index.html\n" + hostsim::sha256Hex(app) + " /app.js\n";
+  hostsim::HttpExchange started = device.serve(HttpRequest::multipart("POST", String("/ota/fs/begin") + query, manifest, "manifest.txt"));
+  if (begin) {
+    *begin = started.body();
+  }
+  String sync = syncId(started.body());
+  device.serve(HttpRequest::multipart("PUT", "/ota/fs/file?sync=" + sync + "&path=/index.html", index));
+  device.serve(HttpRequest::multipart("PUT", "/ota/fs/file?sync=" + sync + "&path=/app.js", app));
+  return device.serve(HttpRequest::post("/ota/fs/finish?sync=" + sync));
+}
+
+TEST(file_sync_keeps_unlisted_files_by_default){
+  Device device;
+  SPIFFS.format();
+  writeFile("/index.html", "<html>old</html>");
+  writeFile("/settings.json", "{\"ssid\":\"home\"}");
+  device.uploader->setFileSystem(SPIFFS);
+  std::string begin;
+  hostsim::HttpExchange finish = syncFiles(device, "", &begin);
+  CHECK_EQ(finish.body(), std::string("OK"));
+  CHECK(begin.find("\"deleted\":[]") != std::string::npos);
+  CHECK_EQ(readFile("/index.html"), std::string("<html>new</html>"));
+  CHECK_EQ(readFile("/app.js"), std::string("console.log(1)"));
+  CHECK(SPIFFS.exists("/settings.json"));
+}
+
+TEST(file_sync_deletes_unlisted_files_when_asked){
+  Device device;
+  SPIFFS.format();
+  writeFile("/index.html", "<html>old</html>");
+  writeFile("/settings.json", "{\"ssid\":\"home\"}");
+  device.uploader->setFileSystem(SPIFFS);
+  std::string begin;
+  hostsim::HttpExchange finish = syncFiles(device, "?delete=1", &begin);
+  CHECK_EQ(finish.body(), std::string("OK"));
+  CHECK(begin.find("\"deleted\":[\"/settings.json\"]") != std::string::npos);
+  CHECK_EQ(readFile("/index.html"), std::string("<html>new</html>"));
+  CHECK(!SPIFFS.exists("/settings.json"));
+}
+
+// Files carry no signature: a signing key, even one that failed to load,
+// keeps them off the device
+TEST(file_sync_is_refused_while_signatures_are_required){
+  hostsim::SigningKey key = hostsim::makeSigningKey();
+  for (const char* pem : {key.publicPem.c_str(), "-----BEGIN PUBLIC KEY-----\nbad\n-----END PUBLIC KEY-----\n"}) {
+    Device device;
+    SPIFFS.format();
+    writeFile("/index.html", "<html>old</html>");
+    device.uploader->setFileSystem(SPIFFS);
+    device.uploader->setSigningKey(pem);
+    std::string begin;
+    hostsim::HttpExchange finish = syncFiles(device, "", &begin);
+    CHECK(begin.find("not available") != std::string::npos);
+    CHECK(finish.code() != 200);
+    CHECK_EQ(readFile("/index.html"), std::string("<html>old</html>"));
+    CHECK(!SPIFFS.exists("/app.js"));
+  }
+}
+
+TEST(file_sync_replaces_files_where_rename_cannot){
+  Device device;
+  SPIFFS.format();
+  hostsim::setRenameReplaces(false);
+  writeFile("/index.html", "<html>old</html>");
+  device.uploader->setFileSystem(SPIFFS);
+  CHECK_EQ(syncFiles(device, "").body(), std::string("OK"));
+  CHECK_EQ(readFile("/index.html"), std::string("<html>new</html>"));
+  CHECK(!SPIFFS.exists(ESP32FW_FILE_SYNC_OLD));
+}
+
+TEST(file_that_cannot_be_moved_into_place_keeps_the_old_one){
+  for (bool replaces : {true, false}) {
+    Device device;
+    SPIFFS.format();
+    hostsim::setRenameReplaces(replaces);
+    hostsim::failRenamesFrom(ESP32FW_FILE_SYNC_TEMP);
+    writeFile("/index.html", "<html>old</html>");
+    device.uploader->setFileSystem(SPIFFS);
+    std::string manifest = hostsim::sha256Hex("<html>new</html>") + " /index.html\n";
+    String sync = syncId(device.serve(HttpRequest::multipart("POST", "/ota/fs/begin", manifest, "manifest.txt")).body());
+    hostsim::HttpExchange file = device.serve(HttpRequest::multipart("PUT", "/ota/fs/file?sync=" + sync + "&path=/index.html", "<html>new</html>"));
+    CHECK_EQ(file.code(), 400);
+    CHECK_EQ(readFile("/index.html"), std::string("<html>old</html>"));
+    CHECK_EQ(readFile(ESP32FW_FILE_SYNC_TEMP), std::string("<html>new</html>"));
+  }
+}
+
+TEST(failed_file_can_be_sent_again){
+  Device device;
+  SPIFFS.format();
+  writeFile("/index.html", "<html>old</html>");
+  device.uploader->setFileSystem(SPIFFS);
+  std::string index = "<html>new</html>";
+  std::string manifest = hostsim::sha256Hex(index) + " /index.html\n";
+  String sync = syncId(device.serve(HttpRequest::multipart("POST", "/ota/fs/begin", manifest, "manifest.txt")).body());
+  String url = "/ota/fs/file?sync=" + sync + "&path=/index.html";
+  hostsim::HttpExchange bad = device.serve(HttpRequest::multipart("PUT", url, "<html>bad</html>"));
+  CHECK_EQ(bad.code(), 400);
+  CHECK_EQ(readFile("/index.html"), std::string("<html>old</html>"));
+  CHECK_EQ(device.serve(HttpRequest::post("/ota/fs/finish?sync=" + sync)).code(), 409);
+  // A file the sync does not expect fails on its own too
+  CHECK_EQ(device.serve(HttpRequest::multipart("PUT", "/ota/fs/file?sync=" + sync + "&path=/other.js", "x")).code(), 400);
+  CHECK_EQ(device.serve(HttpRequest::multipart("PUT", url, index)).code(), 200);
+  CHECK_EQ(device.serve(HttpRequest::post("/ota/fs/finish?sync=" + sync)).body(), std::string("OK"));
+  CHECK_EQ(readFile("/index.html"), index);
+}
+
+TEST(aborted_file_can_be_sent_again){
+  Device device;
+  SPIFFS.format();
+  device.uploader->setFileSystem(SPIFFS);
+  std::string index(8 * 1024, 'i');
+  std::string manifest = hostsim::sha256Hex(index) + " /index.html\n";
+  String sync = syncId(device.serve(HttpRequest::multipart("POST", "/ota/fs/begin", manifest, "manifest.txt")).body());
+  String url = "/ota/fs/file?sync=" + sync + "&path=/index.html";
+  HttpRequest dropped = HttpRequest::multipart("PUT", url, index);
+  dropped.disconnectAfter = 4000;
+  device.serve(dropped);
+  CHECK(!SPIFFS.exists("/index.html"));
+  CHECK_EQ(device.serve(HttpRequest::multipart("PUT", url, index)).code(), 200);
+  CHECK_EQ(device.serve(HttpRequest::post("/ota/fs/finish?sync=" + sync)).body(), std::string("OK"));
+  CHECK_EQ(readFile("/index.html"), index);
+}
@@ -0,0 +1,82 @@
+// The pipelined writer: ESP32FwPipeline on its own and whole uploads with
+// setPipelined(true)
+#include "host_test.h"
+#include <upload_pipeline.h>
+#include <thread>
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+TEST(pipeline_delivers_in_order_under_backpressure){
+  std::string in = hostsim::makeFileSystemImage(40000, 3);
+  std::string out;
+  ESP32FwPipeline pipeline;
+  // A slow output keeps the two slots full, so write() has to wait
+  REQUIRE(pipeline.begin([&](uint8_t* data, size_t len){
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    out.append((const char*)data, len);
+    return true;
+  }, nullptr, 2, 1024));
+  for (size_t pos = 0; pos < in.size(); pos += 777) {
+    CHECK(pipeline.write((const uint8_t*)in.data() + pos, std::min((size_t)777, in.size() - pos)));
+  }
+  CHECK(pipeline.flush());
+  pipeline.end();
+  CHECK(out == in);
+}
+
+TEST(pipeline_reports_output_failure){
+  int calls = 0;
+  ESP32FwPipeline pipeline;
+  REQUIRE(pipeline.begin([&](uint8_t*, size_t){ return ++calls < 3; }, nullptr, 2, 512));
+  uint8_t block[512] = {0};
+  bool ok = true;
+  for (int i = 0; i < 20 && ok; i++) {
+    ok = pipeline.write(block, sizeof(block));
+  }
+  // The failure surfaces on a later write or at the latest on flush()
+  CHECK(!ok || !pipeline.flush());
+  CHECK(pipeline.hasFailed());
+  CHECK_EQ(calls, 3);
+  pipeline.end();
+  CHECK(!pipeline.isRunning());
+}
+
+TEST(pipelined_multipart_upload_installs_image){
+  Device device;
+  device.uploader->setPipelined(true);
+  std::string image = hostsim::makeFirmwareImage(300 * 1024, 8);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app1"));
+}
+
+TEST(pipelined_raw_upload_installs_image){
+  Device device;
+  device.uploader->setPipelined(true);
+  std::string image = hostsim::makeFirmwareImage(300 * 1024, 9);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("PUT", "/ota/raw", image));
+  CHECK_EQ(exchange.code(), 200);
+  CHECK(device.installed(image.size()) == image);
+}
+
+TEST(pipelined_flash_failure_fails_upload){
+  Device device;
+  device.uploader->setPipelined(true);
+  hostsim::failFlashWrites(hostsim::partition("app1"), 64 * 1024);
+  std::string image = hostsim::makeFirmwareImage(300 * 1024, 10);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("FAIL"));
+  CHECK(device.uploader->getLastError() != ESP32FW_ERROR_NONE);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
+
+TEST(flash_failure_fails_upload){
+  Device device;
+  hostsim::failFlashWrites(hostsim::partition("app1"), 64 * 1024);
+  std::string image = hostsim::makeFirmwareImage(300 * 1024, 10);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("FAIL"));
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
@@ -0,0 +1,22 @@
+// Restart after a successful update
+#include "host_test.h"
+
+TEST(pulled_update_reboots_without_begin){
+  hostsim::reset();
+  // No web server: the update comes from updateFromURL() only
+  ESP32FwUploaderClass uploader;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 40);
+  hostsim::serveUrl("http://updates.local/fw.bin", image);
+  REQUIRE(uploader.updateFromURL("http://updates.local/fw.bin"));
+  hostsim::advanceMillis(5000);
+  bool restarted = false;
+  try {
+    for (int i = 0; i < 3; i++) {
+      uploader.loop();
+    }
+  } catch (const hostsim::Restart&) {
+    restarted = true;
+  }
+  CHECK(restarted);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app1"));
+}
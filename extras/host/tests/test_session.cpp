@@ -0,0 +1,136 @@
+// Resumable sessions: chunks, resends and chunks that overlap
+#include "host_test.h"
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+static long field(const std::string& json, const char* name){
+  size_t at = json.find(std::string("\"") + name + "\":");
+  return at == std::string::npos ? -1 : atol(json.c_str() + at + strlen(name) + 3);
+}
+
+static String beginSession(Device& device, size_t size){
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::post("/ota/session/begin?size=" + String((unsigned)size)));
+  return String(field(exchange.body(), "session"));
+}
+
+static HttpRequest chunk(const String& session, size_t offset, const std::string& data){
+  return HttpRequest::multipart("PUT", "/ota/session/chunk?session=" + session + "&offset=" + String((unsigned)offset), data);
+}
+
+static HttpRequest finalize(const String& session){
+  return HttpRequest::post("/ota/session/finalize?session=" + session);
+}
+
+TEST(session_chunks_install_image){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(96 * 1024, 61);
+  String session = beginSession(device, image.size());
+  size_t third = image.size() / 3;
+  CHECK_EQ(device.serve(chunk(session, 0, image.substr(0, third))).code(), 200);
+  CHECK_EQ(device.serve(chunk(session, third, image.substr(third, third))).code(), 200);
+  hostsim::HttpExchange last = device.serve(chunk(session, 2 * third, image.substr(2 * third)));
+  CHECK_EQ(last.code(), 200);
+  CHECK_EQ(field(last.body(), "offset"), (long)image.size());
+  CHECK_EQ(device.serve(finalize(session)).body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+}
+
+TEST(session_resent_chunk_is_skipped){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 62);
+  String session = beginSession(device, image.size());
+  size_t half = image.size() / 2;
+  CHECK_EQ(device.serve(chunk(session, 0, image.substr(0, half))).code(), 200);
+  // The first chunk again, and one overlapping the committed offset
+  hostsim::HttpExchange again = device.serve(chunk(session, 0, image.substr(0, half)));
+  CHECK_EQ(again.code(), 200);
+  CHECK_EQ(field(again.body(), "offset"), (long)half);
+  CHECK_EQ(device.serve(chunk(session, half - 100, image.substr(half - 100))).code(), 200);
+  CHECK_EQ(device.serve(finalize(session)).body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+}
+
+TEST(session_chunk_past_offset_is_refused){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 63);
+  String session = beginSession(device, image.size());
+  hostsim::HttpExchange gap = device.serve(chunk(session, 4096, image.substr(4096)));
+  CHECK_EQ(gap.code(), 409);
+  CHECK_EQ(field(gap.body(), "offset"), 0L);
+}
+
+TEST(session_chunk_without_data_is_not_acknowledged){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 64);
+  String session = beginSession(device, image.size());
+  CHECK_EQ(device.serve(chunk(session, 0, image.substr(0, 4096))).code(), 200);
+  // A request with no file part is not the chunk before it
+  HttpRequest empty = HttpRequest::post("/ota/session/chunk?session=" + session + "&offset=4096", "x=1");
+  empty.method = "PUT";
+  hostsim::HttpExchange exchange = device.serve(empty);
+  CHECK_EQ(exchange.code(), 409);
+  CHECK_EQ(field(exchange.body(), "offset"), 4096L);
+}
+
+TEST(session_abandoned_chunk_lets_the_next_one_in){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 65);
+  String session = beginSession(device, image.size());
+  HttpRequest dropped = chunk(session, 0, image);
+  dropped.disconnectAfter = 20000;
+  device.serve(dropped);
+  hostsim::HttpExchange status = device.serve(HttpRequest::get("/ota/session/status?session=" + session));
+  long offset = field(status.body(), "offset");
+  REQUIRE(offset >= 0);
+  CHECK_EQ(device.serve(chunk(session, offset, image.substr(offset))).code(), 200);
+  CHECK_EQ(device.serve(finalize(session)).body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+}
+
+TEST(session_second_begin_is_refused){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 66);
+  String session = beginSession(device, image.size());
+  hostsim::HttpExchange second = device.serve(HttpRequest::post("/ota/session/begin?size=4096"));
+  CHECK_EQ(second.code(), 409);
+  CHECK_EQ(device.serve(chunk(session, 0, image)).code(), 200);
+  CHECK_EQ(device.serve(finalize(session)).body(), std::string("OK"));
+}
+
+#if defined(ESP32FW_ASYNC_WEBSERVER)
+// A client retrying a chunk it thinks was lost while the first copy is
+// still arriving: the copies must not be written interleaved
+TEST(async_overlapping_chunks_are_taken_one_at_a_time){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 67);
+  String session = beginSession(device, image.size());
+  std::unique_ptr<AsyncHostConnection> first = device.server.connect(chunk(session, 0, image));
+  std::unique_ptr<AsyncHostConnection> retry = device.server.connect(chunk(session, 0, image));
+  while (first->remaining() > 0 || retry->remaining() > 0) {
+    first->sendSegment(1436);
+    retry->sendSegment(1000);
+  }
+  CHECK_EQ(first->exchange().code(), 200);
+  CHECK_EQ(retry->exchange().code(), 409);
+  CHECK_EQ(field(retry->exchange().body(), "offset"), (long)image.size());
+  CHECK_EQ(device.serve(finalize(session)).body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+}
+
+TEST(async_chunk_after_an_abandoned_one_is_taken){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 68);
+  String session = beginSession(device, image.size());
+  std::unique_ptr<AsyncHostConnection> lost = device.server.connect(chunk(session, 0, image));
+  lost->sendSegment(1436);
+  lost->sendSegment(1436);
+  lost->disconnect();
+  hostsim::HttpExchange status = device.serve(HttpRequest::get("/ota/session/status?session=" + session));
+  long offset = field(status.body(), "offset");
+  REQUIRE(offset >= 0);
+  CHECK_EQ(device.serve(chunk(session, offset, image.substr(offset))).code(), 200);
+  CHECK_EQ(device.serve(finalize(session)).body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+}
+#endif
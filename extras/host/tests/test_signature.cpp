@@ -0,0 +1,46 @@
+// Signed images with setSigningKey()
+#include "host_test.h"
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+TEST(signed_image_is_installed_without_trailer){
+  Device device;
+  hostsim::SigningKey key = hostsim::makeSigningKey();
+  REQUIRE(device.uploader->setSigningKey(key.publicPem.c_str()));
+  std::string image = hostsim::makeFirmwareImage(200 * 1024, 30);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", hostsim::signImage(image, key)));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app1"));
+}
+
+TEST(unsigned_image_is_refused){
+  Device device;
+  hostsim::SigningKey key = hostsim::makeSigningKey();
+  REQUIRE(device.uploader->setSigningKey(key.publicPem.c_str()));
+  std::string image = hostsim::makeFirmwareImage(200 * 1024, 31);
+  CHECK_EQ(device.serve(HttpRequest::multipart("POST", "/ota/upload", image)).body(), std::string("FAIL"));
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
+
+TEST(image_signed_by_other_key_is_refused){
+  Device device;
+  hostsim::SigningKey key = hostsim::makeSigningKey();
+  hostsim::SigningKey other = hostsim::makeSigningKey();
+  REQUIRE(device.uploader->setSigningKey(key.publicPem.c_str()));
+  std::string image = hostsim::makeFirmwareImage(200 * 1024, 32);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", hostsim::signImage(image, other)));
+  CHECK(exchange.code() != 200 || exchange.body() != "OK");
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
+
+TEST(tampered_signed_image_is_refused){
+  Device device;
+  hostsim::SigningKey key = hostsim::makeSigningKey();
+  REQUIRE(device.uploader->setSigningKey(key.publicPem.c_str()));
+  std::string image = hostsim::signImage(hostsim::makeFirmwareImage(200 * 1024, 33), key);
+  image[100000] ^= 1;
+  CHECK_EQ(device.serve(HttpRequest::multipart("POST", "/ota/upload", image)).body(), std::string("FAIL"));
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
@@ -0,0 +1,92 @@
+// loop() next to the request handlers, and the progress event stream
+#include "host_test.h"
+#include <atomic>
+#include <thread>
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+#if defined(ESP32FW_ASYNC_WEBSERVER)
+TEST(async_handler_waits_for_the_transport_lock){
+  hostsim::reset();
+  AsyncWebServer server(80);
+  ESP32FwAsyncTransport transport;
+  transport.setServer(&server);
+  ESP32FwUploaderClass* uploader = new ESP32FwUploaderClass();
+  uploader->setAutoReboot(false);
+  uploader->begin(&transport);
+
+  // The test stands in for loop() holding the lock
+  std::atomic<bool> done{false};
+  hostsim::HttpExchange exchange;
+  transport.lock();
+  std::thread client([&](){
+    exchange = server.serve(HttpRequest::get("/ota/metrics"));
+    done = true;
+  });
+  delay(50);
+  CHECK(!done);
+  transport.unlock();
+  client.join();
+  CHECK_EQ(exchange.code(), 200);
+  delete uploader;
+}
+
+TEST(async_upload_while_loop_runs){
+  Device device;
+  std::atomic<bool> stop{false};
+  std::thread looper([&](){
+    while (!stop) {
+      device.uploader->loop();
+    }
+  });
+  std::string image = hostsim::makeFirmwareImage(300 * 1024, 41);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", image));
+  std::string second = hostsim::makeFirmwareImage(200 * 1024, 42);
+  device.serve(HttpRequest::multipart("POST", "/ota/upload", second));
+  stop = true;
+  looper.join();
+  CHECK_EQ(exchange.code(), 200);
+  CHECK(device.installed(second.size()) == second);
+  CHECK_EQ(device.uploader->getLastError(), ESP32FW_ERROR_NONE);
+}
+
+TEST(async_listener_is_greeted_from_loop){
+  Device device;
+  AsyncEventSourceClient* listener = device.server.eventSource("/ota/progress")->hostConnect();
+  CHECK(listener->received().empty());
+  device.loop();
+  CHECK(listener->received().find("\"phase\":\"idle\"") != std::string::npos);
+}
+#else
+TEST(sync_events_wait_for_a_slow_listener){
+  Device device;
+  hostsim::HttpExchange stream = device.serve(HttpRequest::get("/ota/progress"));
+  REQUIRE(stream.connection);
+  CHECK(stream.connection->tx.find("text/event-stream") != std::string::npos);
+  // The browser stops reading; the upload goes on without it
+  size_t sent = stream.connection->tx.size();
+  stream.connection->writeLimit = sent;
+  std::string image = hostsim::makeFirmwareImage(32 * 1024, 43);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", image));
+  CHECK_EQ(exchange.code(), 200);
+  CHECK_EQ(stream.connection->tx.size(), sent);
+  CHECK(stream.connection->open);
+  // loop() sends what was held back once the browser reads again
+  stream.connection->writeLimit = (size_t)-1;
+  device.loop();
+  CHECK(stream.connection->tx.find("\"phase\":\"done\"") != std::string::npos);
+}
+
+TEST(sync_listener_that_falls_behind_is_dropped){
+  Device device;
+  hostsim::HttpExchange stream = device.serve(HttpRequest::get("/ota/progress"));
+  REQUIRE(stream.connection);
+  stream.connection->writeLimit = stream.connection->tx.size();
+  for (int i = 0; i < 8 && stream.connection->open; i++) {
+    std::string image = hostsim::makeFirmwareImage(32 * 1024, 44 + i);
+    CHECK_EQ(device.serve(HttpRequest::raw("POST", "/ota/raw", image)).code(), 200);
+  }
+  CHECK(!stream.connection->open);
+}
+#endif
@@ -0,0 +1,118 @@
+// Whole-image uploads through /ota/upload and /ota/raw
+#include "host_test.h"
+
+using hostsim::HttpRequest;
+using hosttest::Device;
+
+TEST(multipart_upload_installs_image){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(300 * 1024, 2);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.code(), 200);
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app1"));
+  CHECK_EQ(device.uploader->getLastError(), ESP32FW_ERROR_NONE);
+  CHECK_EQ(device.uploader->getLastSHA256(), String(hostsim::sha256Hex(image).c_str()));
+}
+
+TEST(raw_upload_installs_image){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(300 * 1024, 3);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", image));
+  CHECK_EQ(exchange.code(), 200);
+  CHECK(device.installed(image.size()) == image);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app1"));
+}
+
+TEST(raw_upload_too_large_gets_one_413){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(hostsim::partition("app1")->size + 64 * 1024, 11);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw?mode=firmware", image));
+  CHECK_EQ(exchange.code(), 413);
+  CHECK_EQ(exchange.responses.size(), (size_t)1);
+  CHECK_EQ(device.uploader->getLastError(), ESP32FW_ERROR_FILE_TOO_LARGE);
+  CHECK_EQ(hostsim::updateWriteCalls(), 0u);
+  CHECK_EQ(hostsim::flashStats().sectorErases, 0u);
+  // The refused upload released the device
+  std::string fits = hostsim::makeFirmwareImage(64 * 1024, 12);
+  CHECK_EQ(device.serve(HttpRequest::raw("POST", "/ota/raw?mode=firmware", fits)).body(), std::string("OK"));
+}
+
+TEST(bad_magic_is_rejected){
+  Device device;
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 4);
+  image[0] = 0x00;
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("FAIL"));
+  CHECK(device.uploader->getLastError() != ESP32FW_ERROR_NONE);
+  CHECK(hostsim::bootPartition() == hostsim::partition("app0"));
+}
+
+TEST(upload_after_failure_succeeds){
+  Device device;
+  std::string bad = hostsim::makeFirmwareImage(64 * 1024, 5);
+  bad[0] = 0x00;
+  device.serve(HttpRequest::multipart("POST", "/ota/upload", bad));
+  std::string image = hostsim::makeFirmwareImage(128 * 1024, 6);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+}
+
+TEST(auto_reboot_restarts_from_loop){
+  Device device;
+  device.uploader->setAutoReboot(true);
+  std::string image = hostsim::makeFirmwareImage(64 * 1024, 7);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  hostsim::advanceMillis(5000);
+  CHECK(device.loop(3));
+}
+
+TEST(chunks_are_coalesced_into_blocks){
+  Device device;
+  device.uploader->setWriteBlockSize(4096);
+  std::string image = hostsim::makeFirmwareImage(100 * 1024 + 48, 12);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+  // Whole blocks, then the tail at the end of the upload
+  CHECK_EQ(hostsim::updateWriteCalls(), (uint32_t)((image.size() + 4095) / 4096));
+}
+
+TEST(odd_block_size_still_installs_image){
+  Device device;
+  device.uploader->setWriteBlockSize(3000);
+  std::string image = hostsim::makeFirmwareImage(100 * 1024 + 48, 13);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw", image));
+  CHECK_EQ(exchange.code(), 200);
+  CHECK(device.installed(image.size()) == image);
+  CHECK_EQ(hostsim::updateWriteCalls(), (uint32_t)((image.size() + 2999) / 3000));
+}
+
+TEST(block_size_zero_writes_chunks_as_received){
+  Device device;
+  device.uploader->setWriteBlockSize(0);
+  std::string image = hostsim::makeFirmwareImage(100 * 1024 + 48, 14);
+  hostsim::HttpExchange exchange = device.serve(HttpRequest::multipart("POST", "/ota/upload", image));
+  CHECK_EQ(exchange.body(), std::string("OK"));
+  CHECK(device.installed(image.size()) == image);
+  CHECK(hostsim::updateWriteCalls() > (uint32_t)(image.size() / 1460));
+}
+
+// There is no second file system partition to stage into: the image is
+// written over the live one and its digest checked after the last byte
+TEST(filesystem_is_written_in_place_before_its_digest_is_checked){
+  for (bool skipUnchanged : {false, true}) {
+    Device device;
+    device.uploader->setSkipUnchanged(skipUnchanged);
+    std::string image = hostsim::makeFileSystemImage(64 * 1024, 10);
+    String wrong(std::string(64, '0').c_str());
+    hostsim::HttpExchange exchange = device.serve(HttpRequest::raw("POST", "/ota/raw?mode=filesystem&sha256=" + wrong, image));
+    CHECK_EQ(exchange.body(), std::string("FAIL"));
+    CHECK(device.uploader->getLastError() != ESP32FW_ERROR_NONE);
+    // Whatever reached flash before the check stays there
+    CHECK(hostsim::readFlash(hostsim::partition("spiffs"), 0, 32 * 1024) == image.substr(0, 32 * 1024));
+  }
+}
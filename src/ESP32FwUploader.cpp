@@ -1,227 +1,1855 @@
 #include "ESP32FwUploader.h"
 
+#if defined(ESP32)
+  #include <esp_ota_ops.h>
+#elif defined(ESP8266)
+  #include <eboot_command.h>
+#endif
+
 ESP32FwUploaderClass::ESP32FwUploaderClass(){}
 
 void ESP32FwUploaderClass::begin(ESP32FW_WEBSERVER *server){
-  _server = server;
-  logMessage("ESP32FwUploader library initialized");
+  _serverTransport.setServer(server);
+  begin(&_serverTransport);
+}
+
+void ESP32FwUploaderClass::begin(ESP32FwTransport *transport){
+  _transport = transport;
+  #if ESP32FW_FEATURE_AUTH
+    _transport->setCredentials(_authenticate ? _username.c_str() : "", _authenticate ? _password.c_str() : "");
+  #endif
+  _progress.begin(_transport);
+  _events.record(ESP32FW_EVENT_INIT);
+
+  // Request headers needed by the handlers below
+  static const char* headerKeys[] = { "If-None-Match", "X-Firmware-SHA256", "X-Firmware-MD5", "X-Upload-Token" };
+  _transport->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
 
   // Web UI endpoint
-  _server->on("/update", HTTP_GET, [&](){
-    if (_authenticate && !checkAuth()) {
-      setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
-      return _server->requestAuthentication();
-    }
-    logMessage("Serving OTA web interface");
-    _server->send(200, "text/html", getWebUIHTML());
-  });
+  #if ESP32FW_FEATURE_WEB_UI
+    _transport->on("/update", ESP32FW_HTTP_GET, [&](ESP32FwRequest& request){ handleWebUI(request); });
+  #endif
 
   // OTA upload endpoint
-  _server->on("/ota/upload", HTTP_POST, [&](){
-    if (_authenticate && !checkAuth()) {
-      setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed during upload");
-      return _server->requestAuthentication();
+  _transport->on("/ota/upload", ESP32FW_HTTP_POST, [&](ESP32FwRequest& request){ handleUploadComplete(request); },
+                 [&](ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){ handleUpload(request, status, data, len); });
+
+  // Raw image body (application/octet-stream), read without multipart parsing
+  _transport->onRaw("/ota/raw", ESP32FW_HTTP_POST, [&](ESP32FwRequest& request){ handleUploadComplete(request); },
+                    [&](ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){ handleRawUpload(request, status, data, len); });
+  _transport->onRaw("/ota/raw", ESP32FW_HTTP_PUT, [&](ESP32FwRequest& request){ handleUploadComplete(request); },
+                    [&](ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){ handleRawUpload(request, status, data, len); });
+  
+  // Resumable chunked upload endpoints
+  _transport->on("/ota/session/begin", ESP32FW_HTTP_POST, [&](ESP32FwRequest& request){ handleSessionBegin(request); });
+  _transport->on("/ota/session/chunk", ESP32FW_HTTP_PUT, [&](ESP32FwRequest& request){ handleSessionChunkComplete(request); },
+                 [&](ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){ handleSessionChunk(request, status, data, len); });
+  _transport->on("/ota/session/status", ESP32FW_HTTP_GET, [&](ESP32FwRequest& request){ handleSessionStatus(request); });
+  _transport->on("/ota/session/finalize", ESP32FW_HTTP_POST, [&](ESP32FwRequest& request){ handleSessionFinalize(request); });
+  
+  // Per-file file system sync: manifest, changed files, then finish
+  #if ESP32FW_FEATURE_FILESYSTEM
+    _transport->on("/ota/fs/begin", ESP32FW_HTTP_POST, [&](ESP32FwRequest& request){ handleFilesBegin(request); },
+                   [&](ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){ handleManifest(request, status, data, len); });
+    _transport->on("/ota/fs/file", ESP32FW_HTTP_PUT, [&](ESP32FwRequest& request){ handleFileComplete(request); },
+                   [&](ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){ handleFile(request, status, data, len); });
+    _transport->on("/ota/fs/finish", ESP32FW_HTTP_POST, [&](ESP32FwRequest& request){ handleFilesFinish(request); });
+  #endif
+  
+  // Digests measured over the last upload
+  _transport->on("/ota/digest", ESP32FW_HTTP_GET, [&](ESP32FwRequest& request){ handleDigest(request); });
+  
+  // Digests of the running firmware and file system
+  _transport->on("/ota/running", ESP32FW_HTTP_GET, [&](ESP32FwRequest& request){ handleRunning(request); });
+  
+  // Pull an update from an HTTP server
+  #if ESP32FW_FEATURE_PULL
+    _transport->on("/ota/pull", ESP32FW_HTTP_POST, [&](ESP32FwRequest& request){ handlePull(request); });
+  #endif
+  
+  // Upload timing and memory statistics
+  _transport->on("/ota/metrics", ESP32FW_HTTP_GET, [&](ESP32FwRequest& request){ handleMetrics(request); });
+  
+  // Live device-side progress as Server-Sent Events; a new listener gets
+  // the current state at once
+  _transport->onEventStream("/ota/progress", [&](){ _progress.publish(); });
+  
+  // Recent events from the log ring buffer
+  #if ESP32FW_FEATURE_EVENT_LOG
+    _transport->on("/ota/events", ESP32FW_HTTP_GET, [&](ESP32FwRequest& request){ handleEvents(request); });
+  #endif
+}
+
+#if ESP32FW_FEATURE_WEB_UI
+void ESP32FwUploaderClass::handleWebUI(ESP32FwRequest& request){
+  if (_authenticate && !checkAuth(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  // The page is pre-built and gzip-compressed in flash; let the browser
+  // revalidate its cached copy instead of downloading it again
+  const WebUIAsset& page = getWebUIAsset();
+  request.sendHeader("ETag", page.etag);
+  request.sendHeader("Cache-Control", "no-cache");
+  if (request.header("If-None-Match") == page.etag) {
+    request.send(304);
+    return;
+  }
+  _events.record(ESP32FW_EVENT_WEB_UI);
+  request.sendHeader("Content-Encoding", "gzip");
+  request.send_P(200, "text/html", page.data, page.length);
+}
+#endif
+
+void ESP32FwUploaderClass::handleUploadComplete(ESP32FwRequest& request){
+  // Already reported when the body started
+  if (_authenticate && !checkAuth(request)) {
+    return request.requestAuthentication();
+  }
+  // The body of a rejected upload was discarded without touching flash
+  if (!ownsUpload(request)) {
+    request.send(409, "text/plain", "Update in progress");
+    return;
+  }
+  if (_session.tooLarge) {
+    request.send(413, "text/plain", _lastErrorMessage);
+    finishUpload(false);
+    return;
+  }
+  
+  // Errors caught before Update ran (e.g. a digest mismatch) fail the upload too
+  bool success = (_sectorWrites || !Update.hasError()) && _lastError == ESP32FW_ERROR_NONE;
+  String response = success ? "OK" : "FAIL";
+  
+  if (!success && _lastError == ESP32FW_ERROR_NONE) {
+    String errorMsg = "Update failed: ";
+    errorMsg += updateErrorString();
+    setError(ESP32FW_ERROR_UPDATE_END_FAILED, errorMsg);
+  } else if (success) {
+    _events.record(ESP32FW_EVENT_UPDATE_SUCCESS);
+  }
+  
+  request.send(200, "text/plain", response);
+  finishUpload(success);
+}
+
+void ESP32FwUploaderClass::finishUpload(bool success){
+  _session = ESP32FwUploadSession();
+  _fsHashStale = true;
+  #if ESP32FW_FEATURE_FILESYSTEM
+    _fileSync.end();
+    _bundle.end();
+    // A bundle that fails after its firmware section must not boot the new
+    // firmware next to a file system it did not finish writing
+    if (_bundleFirmwareCommitted && !success) {
+      keepRunningFirmware();
+    }
+    _bundleFirmwareCommitted = false;
+  #endif
+  _metrics.uploadFinished(success);
+  _progress.setPhase(success ? ESP32FW_PHASE_DONE : ESP32FW_PHASE_ERROR, success ? nullptr : _lastErrorMessage);
+  
+  // Call end callback
+  if (_onEnd) {
+    _onEnd(success);
+  }
+  
+  // Auto reboot after successful update
+  if (success && _autoReboot) {
+    _events.record(ESP32FW_EVENT_REBOOT_SCHEDULED, 2000);
+    _progress.setPhase(ESP32FW_PHASE_REBOOT);
+    _rebootRequested = true;
+    _rebootTime = millis() + 2000; // Reboot after 2 seconds
+  }
+}
+
+void ESP32FwUploaderClass::handleUpload(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){
+  if(status == ESP32FW_UPLOAD_START){
+    // Refuse to interleave with another update before anything is erased
+    if (!admitUpload(request, ESP32FW_SOURCE_UPLOAD, false) || !acquireUpload(ESP32FW_SOURCE_UPLOAD, request.id())) {
+      return;
     }
     
-    bool success = !Update.hasError();
-    String response = success ? "OK" : "FAIL";
+    // Call start callback
+    if (_onStart) {
+      _onStart();
+    }
     
-    if (!success) {
-      String errorMsg = "Update failed: ";
-      #if defined(ESP8266) || defined(ESP32)
-        errorMsg += Update.errorString();
-      #else
-        errorMsg += "Unknown error";
-      #endif
-      setError(ESP32FW_ERROR_UPDATE_END_FAILED, errorMsg);
-      logError(errorMsg);
-    } else {
-      logMessage("Update completed successfully");
+    // Get mode parameter
+    ESP32Fw_Mode otaMode = parseMode(request.arg("mode"));
+    
+    // The multipart body is larger than the image, so the size is validated
+    // while writing instead
+    if (readExpectedDigests(request)) {
+      beginUpdate(otaMode, 0);
+      startPayload(request.arg("compression"));
+    }
+    return;
+  }
+  
+  // Parts of a rejected upload, and the rest of one that already failed,
+  // are dropped
+  if (!ownsUpload(request)) {
+    return;
+  }
+  if(status == ESP32FW_UPLOAD_WRITE){
+    if (_lastError != ESP32FW_ERROR_NONE) {
+      return;
+    }
+    // First write - validate we have actual data
+    if (_session.firstChunk) {
+      _session.firstChunk = false;
+      if (len == 0) {
+        setError(ESP32FW_ERROR_INVALID_FILE, "No data received in upload");
+        abortUpdate();
+        return;
+      }
+      _events.record(ESP32FW_EVENT_FIRST_CHUNK, len);
     }
     
-    _server->send(200, "text/plain", response);
+    if (!writePayload(data, len)) {
+      return;
+    }
+    _session.received += len;
+    reportProgress(_session.received, request.contentLength());
+  } else if(status == ESP32FW_UPLOAD_END){
+    if (_lastError == ESP32FW_ERROR_NONE && endUpdate()) {
+      _events.record(ESP32FW_EVENT_UPLOAD_WRITTEN, _session.received);
+    }
+  } else if(status == ESP32FW_UPLOAD_ABORTED) {
+    // The completion handler does not run for an aborted upload
+    abortUpdate();
+    _events.record(ESP32FW_EVENT_UPLOAD_ABORTED);
+    setError(ESP32FW_ERROR_NETWORK_ERROR, "Upload was aborted");
+    finishUpload(false);
+  }
+}
+
+// The body is the image itself, so unlike a multipart upload its length is
+// known up front: it is checked against the partition and lets the erase
+// run ahead, as for a session. The rest of the upload is handled like a
+// multipart one.
+void ESP32FwUploaderClass::handleRawUpload(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){
+  if(status != ESP32FW_UPLOAD_START){
+    return handleUpload(request, status, data, len);
+  }
+  if (!admitUpload(request, ESP32FW_SOURCE_UPLOAD, false) || !acquireUpload(ESP32FW_SOURCE_UPLOAD, request.id())) {
+    return;
+  }
+  if (_onStart) {
+    _onStart();
+  }
+  
+  size_t size = request.contentLength();
+  bool bundle = request.arg("mode") == "bundle";
+  ESP32Fw_Mode otaMode = parseMode(request.arg("mode"));
+  // Nothing is erased; the body is dropped as it arrives and the completion
+  // handler answers, so the request gets one response
+  if (!bundle && otaMode != ESP32FW_MODE_AUTO && !checkPartitionSize(otaMode, size)) {
+    _session.tooLarge = true;
+    return;
+  }
+  if (readExpectedDigests(request)) {
+    beginUpdate(otaMode, bundle ? 0 : size, _preErase && !bundle);
+    startPayload(request.arg("compression"));
+  }
+}
+
+void ESP32FwUploaderClass::handleSessionBegin(ESP32FwRequest& request){
+  if (_authenticate && !checkAuth(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  
+  size_t size = request.arg("size").toInt();
+  if (size == 0) {
+    request.send(400, "text/plain", "Missing size");
+    return;
+  }
+  
+  // An image the device already runs is answered before the lock is taken:
+  // nothing is sent, erased or rebooted
+  String sha256 = request.hasArg("sha256") ? request.arg("sha256") : request.header("X-Firmware-SHA256");
+  if (isUpToDate(sha256, parseMode(request.arg("mode")))) {
+    request.send(200, "application/json", "{\"up_to_date\":true}");
+    return;
+  }
+  
+  // An unfinished session holds the lock until it is finalized or times out
+  if (!acquireUpload(ESP32FW_SOURCE_SESSION, nullptr)) {
+    request.send(409, "text/plain", "Update in progress");
+    return;
+  }
+  if (_onStart) {
+    _onStart();
+  }
+  
+  if (!readExpectedDigests(request)) {
+    request.send(400, "text/plain", _lastErrorMessage);
+    finishUpload(false);
+    return;
+  }
+  
+  // The announced size is checked against the partition before anything
+  // is erased and lets the erase run ahead of the data. A bundle spans
+  // several partitions; its sections are checked as they begin.
+  bool bundle = request.arg("mode") == "bundle";
+  ESP32Fw_Mode otaMode = parseMode(request.arg("mode"));
+  if (!bundle && otaMode != ESP32FW_MODE_AUTO && !checkPartitionSize(otaMode, size)) {
+    request.send(413, "text/plain", _lastErrorMessage);
+    finishUpload(false);
+    return;
+  }
+  
+  beginUpdate(otaMode, bundle ? 0 : size, _preErase && !bundle);
+  startPayload(request.arg("compression"));
+  
+  _session.id = (uint32_t)random(1, 0x7FFFFFFF);
+  randomHex(_session.token, ESP32FW_TOKEN_LENGTH);
+  _session.size = size;
+  _session.offset = 0;
+  _session.activity = millis();
+  _events.record(ESP32FW_EVENT_SESSION_START, _session.id, size);
+  request.sendHeader("X-Upload-Token", _session.token);
+  sendSessionStatus(request, 200);
+}
+
+void ESP32FwUploaderClass::handleSessionChunk(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){
+  if(status == ESP32FW_UPLOAD_START){
+    // Only accept data that continues the committed stream; an offset before
+    // it resends bytes we already have, which are skipped. Chunks are taken
+    // one at a time: one sent while another is still being read would be
+    // interleaved with it, so it is refused and resent from the offset its
+    // 409 reports.
+    if (!admitUpload(request, ESP32FW_SOURCE_SESSION, true)) {
+      return;
+    }
+    size_t offset = request.arg("offset").toInt();
+    if (!isSessionRequest(request) || offset > _session.offset || _session.chunkOwner) {
+      return;
+    }
+    _session.chunkOwner = request.id();
+    _session.chunkSkip = _session.offset - offset;
+    _session.activity = millis();
+    
+  } else if(status == ESP32FW_UPLOAD_ABORTED && _session.chunkOwner == request.id()){
+    // The session stays open for the client to resume
+    _session.chunkOwner = nullptr;
     
-    // Call end callback
-    if (_onEnd) {
-      _onEnd(success);
+  } else if(status == ESP32FW_UPLOAD_WRITE && _session.chunkOwner == request.id()){
+    size_t skip = min(_session.chunkSkip, len);
+    _session.chunkSkip -= skip;
+    data += skip;
+    len -= skip;
+    if (len == 0) {
+      return;
+    }
+    if (_session.offset + len > _session.size) {
+      setError(ESP32FW_ERROR_FILE_TOO_LARGE, "Chunk exceeds announced upload size");
+      abortUpdate();
+      finishUpload(false);
+      return;
     }
     
-    // Auto reboot after successful update
-    if (success && _autoReboot) {
-      logMessage("Scheduling reboot in 2 seconds");
-      _rebootRequested = true;
-      _rebootTime = millis() + 2000; // Reboot after 2 seconds
-    }
-  }, [&](){
-    HTTPUpload& upload = _server->upload();
-    static size_t totalReceived = 0;
+    if (!writePayload(data, len)) {
+      finishUpload(false);
+      return;
+    }
+    _session.offset += len;
+    _session.activity = millis();
     
-    if(upload.status == UPLOAD_FILE_START){
-      logMessage("Update started: " + String(upload.filename.c_str()));
-      totalReceived = 0;
-      _lastError = ESP32FW_ERROR_NONE;
-      _lastErrorMessage = "";
-      
-      // Reset static variables for new upload
-      static bool firstWrite = true;
-      firstWrite = true;
-      
-      // Call start callback
-      if (_onStart) {
-        _onStart();
+    reportProgress(_session.offset, _session.size);
+  }
+}
+
+void ESP32FwUploaderClass::handleSessionChunkComplete(ESP32FwRequest& request){
+  if (!checkToken(request)) {
+    return request.requestAuthentication();
+  }
+  if (!isSessionRequest(request)) {
+    request.send(404, "text/plain", _lastError != ESP32FW_ERROR_NONE ? String(_lastErrorMessage) : String("Unknown session"));
+    return;
+  }
+  // 409 tells the client to resume from the offset in the body
+  bool accepted = _session.chunkOwner == request.id();
+  if (accepted) {
+    _session.chunkOwner = nullptr;
+  }
+  sendSessionStatus(request, accepted ? 200 : 409);
+}
+
+void ESP32FwUploaderClass::handleSessionStatus(ESP32FwRequest& request){
+  if (!checkToken(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  if (!isSessionRequest(request)) {
+    request.send(404, "text/plain", "Unknown session");
+    return;
+  }
+  sendSessionStatus(request, 200);
+}
+
+void ESP32FwUploaderClass::handleSessionFinalize(ESP32FwRequest& request){
+  if (!checkToken(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  if (!isSessionRequest(request)) {
+    request.send(404, "text/plain", "Unknown session");
+    return;
+  }
+  if (_session.offset != _session.size) {
+    sendSessionStatus(request, 409);
+    return;
+  }
+  
+  bool success = endUpdate();
+  if (success) {
+    _events.record(ESP32FW_EVENT_UPDATE_SUCCESS);
+  }
+  request.send(200, "text/plain", success ? "OK" : "FAIL");
+  finishUpload(success);
+}
+
+#if ESP32FW_FEATURE_FILESYSTEM
+void ESP32FwUploaderClass::handleManifest(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){
+  if(status == ESP32FW_UPLOAD_START){
+    if (!_fileSync.isEnabled() || !admitUpload(request, ESP32FW_SOURCE_FILES, false)) {
+      return;
+    }
+    // Files carry no signature, so a signing key turns per-file sync off
+    #if ESP32FW_FEATURE_SIGNING
+      if (_signatureRequired) {
+        request.send(403, "text/plain", "File sync is not available while signed updates are required");
+        request.reject();
+        return;
       }
-      
-      // Get mode parameter
-      String mode = _server->arg("mode");
-      ESP32Fw_Mode otaMode = ESP32FW_MODE_FIRMWARE;
-      
-      if (mode == "filesystem") {
-        otaMode = ESP32FW_MODE_FILESYSTEM;
-        logMessage("OTA Mode: Filesystem");
-      } else {
-        logMessage("OTA Mode: Firmware");
+    #endif
+    if (!acquireUpload(ESP32FW_SOURCE_FILES, request.id())) {
+      return;
+    }
+    if (_onStart) {
+      _onStart();
+    }
+    _events.record(ESP32FW_EVENT_FILES_START);
+    _progress.setPhase(ESP32FW_PHASE_BEGIN);
+    // Files the manifest does not list are only deleted when asked for
+    _fileSync.beginManifest(request.arg("delete") == "1");
+    _session.activity = millis();
+    return;
+  }
+  
+  if (_session.source != ESP32FW_SOURCE_FILES || _session.owner != request.id()) {
+    return;
+  }
+  if(status == ESP32FW_UPLOAD_WRITE){
+    // A bad line is reported once the whole manifest has arrived
+    _fileSync.writeManifest(data, len);
+    _session.activity = millis();
+  } else if(status == ESP32FW_UPLOAD_ABORTED) {
+    _events.record(ESP32FW_EVENT_UPLOAD_ABORTED);
+    setError(ESP32FW_ERROR_NETWORK_ERROR, "Upload was aborted");
+    finishUpload(false);
+  }
+}
+
+void ESP32FwUploaderClass::handleFilesBegin(ESP32FwRequest& request){
+  // Already reported when the manifest started
+  if (_authenticate && !checkAuth(request)) {
+    return request.requestAuthentication();
+  }
+  if (!_fileSync.isEnabled()) {
+    request.send(501, "text/plain", "File sync not enabled");
+    return;
+  }
+  #if ESP32FW_FEATURE_SIGNING
+    if (_signatureRequired) {
+      request.send(403, "text/plain", "File sync is not available while signed updates are required");
+      return;
+    }
+  #endif
+  if (_session.source != ESP32FW_SOURCE_FILES || _session.owner != request.id()) {
+    request.send(409, "text/plain", "Update in progress");
+    return;
+  }
+  
+  if (!_fileSync.finishManifest()) {
+    String errorMsg = "Invalid manifest: ";
+    errorMsg += _fileSync.errorString();
+    setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+    request.send(400, "text/plain", _lastErrorMessage);
+    finishUpload(false);
+    return;
+  }
+  
+  // Files and finish are matched to the sync by id, like session chunks
+  _session.owner = nullptr;
+  _session.id = (uint32_t)random(1, 0x7FFFFFFF);
+  randomHex(_session.token, ESP32FW_TOKEN_LENGTH);
+  _session.activity = millis();
+  _events.record(ESP32FW_EVENT_FILES_COMPARED, _fileSync.pending().size(), _fileSync.deleted().size());
+  _progress.setPhase(ESP32FW_PHASE_WRITE);
+  request.sendHeader("X-Upload-Token", _session.token);
+  sendFileSyncStatus(request, 200);
+}
+
+void ESP32FwUploaderClass::handleFile(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len){
+  if(status == ESP32FW_UPLOAD_START){
+    // One file at a time; a file the sync does not expect fails in beginFile()
+    if (!admitUpload(request, ESP32FW_SOURCE_FILES, true) || !isFileSyncRequest(request) || _session.owner != nullptr) {
+      return;
+    }
+    _session.owner = request.id();
+    _session.received = 0;
+    _session.activity = millis();
+    _fileSync.beginFile(request.arg("path"));
+    return;
+  }
+  
+  if (!isFileSyncRequest(request) || _session.owner != request.id()) {
+    return;
+  }
+  if(status == ESP32FW_UPLOAD_WRITE){
+    _metrics.chunkReceived(len);
+    _fileSync.writeFile(data, len);
+    _session.received += len;
+    _session.activity = millis();
+  } else if(status == ESP32FW_UPLOAD_END){
+    _fileSync.finishFile();
+  } else if(status == ESP32FW_UPLOAD_ABORTED) {
+    // The sync stays open for the client to send the file again
+    _events.record(ESP32FW_EVENT_UPLOAD_ABORTED);
+    _fileSync.dropFile();
+    _session.owner = nullptr;
+  }
+}
+
+void ESP32FwUploaderClass::handleFileComplete(ESP32FwRequest& request){
+  if (!checkToken(request)) {
+    return request.requestAuthentication();
+  }
+  if (!isFileSyncRequest(request)) {
+    request.send(404, "text/plain", _lastError != ESP32FW_ERROR_NONE ? String(_lastErrorMessage) : String("Unknown sync"));
+    return;
+  }
+  if (_session.owner != request.id()) {
+    request.send(409, "text/plain", "Another file is being received");
+    return;
+  }
+  
+  String path = request.arg("path");
+  if (_fileSync.errorString()) {
+    // Only this file failed; it stays pending and can be sent again
+    String errorMsg = path + ": " + _fileSync.errorString();
+    _events.record(ESP32FW_EVENT_FILE_FAILED, 0, 0, errorMsg.c_str());
+    request.send(400, "text/plain", "Failed to write " + errorMsg);
+    _fileSync.dropFile();
+    _session.owner = nullptr;
+    _session.activity = millis();
+    return;
+  }
+  _session.owner = nullptr;
+  _events.record(ESP32FW_EVENT_FILE_WRITTEN, _session.received, 0, path.c_str());
+  sendFileSyncStatus(request, 200);
+}
+
+void ESP32FwUploaderClass::handleFilesFinish(ESP32FwRequest& request){
+  if (!checkToken(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  if (!isFileSyncRequest(request)) {
+    request.send(404, "text/plain", "Unknown sync");
+    return;
+  }
+  // Deletions wait until every changed file is in place
+  if (_session.owner != nullptr || !_fileSync.pending().empty()) {
+    sendFileSyncStatus(request, 409);
+    return;
+  }
+  
+  _progress.setPhase(ESP32FW_PHASE_END);
+  _fileSync.apply();
+  _events.record(ESP32FW_EVENT_FILES_DONE, _fileSync.filesWritten(), _fileSync.filesDeleted());
+  _events.record(ESP32FW_EVENT_UPDATE_SUCCESS);
+  request.send(200, "text/plain", "OK");
+  finishUpload(true);
+}
+#endif
+
+bool ESP32FwUploaderClass::isSessionRequest(ESP32FwRequest& request){
+  return _session.source == ESP32FW_SOURCE_SESSION && (uint32_t)request.arg("session").toInt() == _session.id;
+}
+
+#if ESP32FW_FEATURE_FILESYSTEM
+bool ESP32FwUploaderClass::isFileSyncRequest(ESP32FwRequest& request){
+  return _session.source == ESP32FW_SOURCE_FILES && _session.id != 0 && (uint32_t)request.arg("sync").toInt() == _session.id;
+}
+#endif
+
+bool ESP32FwUploaderClass::acquireUpload(ESP32Fw_UploadSource source, const void* owner){
+  if (_session.source != ESP32FW_SOURCE_NONE || _pullRequested) {
+    _events.record(ESP32FW_EVENT_UPLOAD_REJECTED, source, _session.source);
+    return false;
+  }
+  _session = ESP32FwUploadSession();
+  _session.source = source;
+  _session.owner = owner;
+  _lastError = ESP32FW_ERROR_NONE;
+  _lastErrorMessage[0] = '\0';
+  _metrics.uploadStarted();
+  return true;
+}
+
+bool ESP32FwUploaderClass::ownsUpload(ESP32FwRequest& request){
+  return _session.source == ESP32FW_SOURCE_UPLOAD && _session.owner == request.id();
+}
+
+void ESP32FwUploaderClass::handleDigest(ESP32FwRequest& request){
+  if (_authenticate && !checkAuth(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  String json = "{\"size\":" + String(_payloadSize) +
+                ",\"sha256\":\"" + _lastSha256 + "\"" +
+                ",\"md5\":\"" + _lastMd5 + "\"}";
+  request.send(200, "application/json", json);
+}
+
+void ESP32FwUploaderClass::handleRunning(ESP32FwRequest& request){
+  if (_authenticate && !checkAuth(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  // Asking is what starts the hashing; null until loop() has finished it
+  String firmware = getRunningSHA256(ESP32FW_MODE_FIRMWARE);
+  String filesystem = getRunningSHA256(ESP32FW_MODE_FILESYSTEM);
+  String json = "{\"firmware\":" + (firmware.length() > 0 ? "\"" + firmware + "\"" : String("null")) +
+                ",\"filesystem\":" + (filesystem.length() > 0 ? "\"" + filesystem + "\"" : String("null")) +
+                ",\"skip_up_to_date\":" + (_skipUpToDate ? "true" : "false") + "}";
+  request.send(200, "application/json", json);
+}
+
+#if ESP32FW_FEATURE_PULL
+void ESP32FwUploaderClass::handlePull(ESP32FwRequest& request){
+  if (_authenticate && !checkAuth(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  
+  String url = request.arg("url");
+  String sha256 = request.arg("sha256");
+  uint8_t digest[ESP32FW_SHA256_SIZE];
+  if (!url.startsWith("http://")) {
+    request.send(400, "text/plain", "Missing or unsupported url");
+    return;
+  }
+  if (sha256.length() > 0 && !hexToDigest(sha256, digest, sizeof(digest))) {
+    request.send(400, "text/plain", "Malformed sha256");
+    return;
+  }
+  if (_session.source != ESP32FW_SOURCE_NONE || _pullRequested) {
+    request.send(409, "text/plain", "Update in progress");
+    return;
+  }
+  if (isUpToDate(sha256, parseMode(request.arg("mode")))) {
+    request.send(200, "text/plain", "Up to date");
+    return;
+  }
+  
+  // The pull blocks until the image is written, so it runs from loop()
+  // once this request has been answered
+  _pullUrl = url;
+  _pullMode = parseMode(request.arg("mode"));
+  _pullSha256 = sha256;
+  _pullRequested = true;
+  request.send(202, "text/plain", "Accepted");
+}
+
+bool ESP32FwUploaderClass::updateFromURL(const String& url, ESP32Fw_Mode mode, const String& expectedSha256){
+  {
+    ESP32FwTransportLock lock(_transport);
+    // Nothing is downloaded when the device already runs the image
+    if (isUpToDate(expectedSha256, mode)) {
+      return true;
+    }
+    // The error of an update in progress is left alone
+    if (!acquireUpload(ESP32FW_SOURCE_PULL, nullptr)) {
+      return false;
+    }
+    if (!url.startsWith("http://")) {
+      setError(ESP32FW_ERROR_NETWORK_ERROR, "Only http:// URLs are supported");
+      finishUpload(false);
+      return false;
+    }
+    if (!setExpectedDigests(expectedSha256, "")) {
+      finishUpload(false);
+      return false;
+    }
+    
+    if (_onStart) {
+      _onStart();
+    }
+    _events.record(ESP32FW_EVENT_PULL_START, 0, 0, url.c_str());
+  }
+  bool success = pullUpdate(url, mode);
+  ESP32FwTransportLock lock(_transport);
+  success = success && endUpdate();
+  if (success) {
+    _events.record(ESP32FW_EVENT_UPDATE_SUCCESS);
+  }
+  finishUpload(success);
+  return success;
+}
+
+bool ESP32FwUploaderClass::pullUpdate(const String& url, ESP32Fw_Mode otaMode){
+  uint8_t* buffer = (uint8_t*)malloc(ESP32FW_PULL_BUFFER_SIZE);
+  if (!buffer) {
+    ESP32FwTransportLock lock(_transport);
+    setError(ESP32FW_ERROR_UPDATE_BEGIN_FAILED, "Not enough memory for pull buffer");
+    return false;
+  }
+  
+  WiFiClient client;
+  HTTPClient http;
+  http.setTimeout(ESP32FW_PULL_TIMEOUT_MS);
+  size_t total = 0;
+  size_t received = 0;
+  bool started = false;
+  int attempt = 0;
+  String errorMsg;
+  
+  for (;;) {
+    if (!http.begin(client, url)) {
+      errorMsg = "Invalid URL";
+      break;
+    }
+    // After a dropped connection, continue where the image left off
+    if (started) {
+      http.addHeader("Range", "bytes=" + String(received) + "-");
+    }
+    int code = http.GET();
+    if (code > 0) {
+      int expected = started ? HTTP_CODE_PARTIAL_CONTENT : HTTP_CODE_OK;
+      int length = http.getSize();
+      if (code != expected) {
+        errorMsg = "Server returned HTTP " + String(code);
+        if (started && code == HTTP_CODE_OK) {
+          errorMsg += "; it does not support resuming with Range requests";
+        }
+        break;
+      }
+      if (length <= 0 || (started && received + length != total)) {
+        errorMsg = "Server did not send the image length";
+        break;
+      }
+      if (!started) {
+        ESP32FwTransportLock lock(_transport);
+        total = length;
+        _events.record(ESP32FW_EVENT_PULL_SIZE, total);
+        beginUpdate(otaMode, total);
+        startPayload("");
+        started = true;
       }
       
-      // Note: upload.totalSize may be 0 in some cases, so we'll validate during write phase instead
-      
-      // Start update process
-      bool updateStarted = false;
-      #if defined(ESP8266)
-        if (otaMode == MYOTA_MODE_FILESYSTEM) {
-          size_t fsSize = ((size_t) &_FS_end - (size_t) &_FS_start);
-          if (upload.totalSize > 0 && upload.totalSize > fsSize) {
-            setError(ESP32FW_ERROR_FILE_TOO_LARGE, "File too large for filesystem partition");
-            return;
+      WiFiClient* stream = http.getStreamPtr();
+      unsigned long lastData = millis();
+      while (received < total) {
+        size_t available = stream->available();
+        if (available == 0) {
+          if (!stream->connected() || millis() - lastData > ESP32FW_PULL_TIMEOUT_MS) {
+            break;
           }
-          close_all_fs();
-          updateStarted = Update.begin(fsSize, U_FS);
-        } else {
-          uint32_t maxSketchSpace = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
-          if (upload.totalSize > 0 && upload.totalSize > maxSketchSpace) {
-            setError(ESP32FW_ERROR_FILE_TOO_LARGE, "File too large for flash partition");
-            return;
+          delay(1);
+          continue;
+        }
+        int n = stream->read(buffer, min(available, (size_t)ESP32FW_PULL_BUFFER_SIZE));
+        if (n <= 0) {
+          break;
+        }
+        {
+          ESP32FwTransportLock lock(_transport);
+          if (!writePayload(buffer, n)) {
+            http.end();
+            free(buffer);
+            return false;
           }
-          updateStarted = Update.begin(maxSketchSpace, U_FLASH);
+          received += n;
+          reportProgress(received, total);
         }
-      #elif defined(ESP32)
-        if (otaMode == ESP32FW_MODE_FILESYSTEM) {
-          updateStarted = Update.begin(UPDATE_SIZE_UNKNOWN, U_SPIFFS);
-        } else {
-          updateStarted = Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH);
+        lastData = millis();
+        attempt = 0;
+      }
+      if (received == total) {
+        break;
+      }
+    }
+    http.end();
+    
+    if (++attempt > ESP32FW_PULL_RETRIES) {
+      errorMsg = code > 0 ? String("Connection lost") : "Connection failed: " + HTTPClient::errorToString(code);
+      break;
+    }
+    {
+      ESP32FwTransportLock lock(_transport);
+      _events.record(ESP32FW_EVENT_PULL_RETRY, received, attempt);
+    }
+    delay(min(1000 * attempt, 5000));
+  }
+  http.end();
+  free(buffer);
+  
+  ESP32FwTransportLock lock(_transport);
+  if (received == total && started) {
+    _events.record(ESP32FW_EVENT_PULL_DONE, total);
+    return true;
+  }
+  errorMsg = "Pull update failed: " + errorMsg;
+  setError(ESP32FW_ERROR_NETWORK_ERROR, errorMsg);
+  if (started) {
+    abortUpdate();
+  }
+  return false;
+}
+#endif
+
+#if ESP32FW_FEATURE_ESPOTA
+// Accepts an espota.py invitation and reads the image from the host, like a
+// pull update. The tool is told about a refusal instead of being left to
+// time out.
+void ESP32FwUploaderClass::updateFromEspOta(){
+  const ESP32FwEspOta::Invitation& invitation = _espOta.invitation();
+  ESP32Fw_Mode otaMode = invitation.command == ESP32FwEspOta::CMD_FILESYSTEM ? ESP32FW_MODE_FILESYSTEM : ESP32FW_MODE_FIRMWARE;
+  {
+    ESP32FwTransportLock lock(_transport);
+    if (!acquireUpload(ESP32FW_SOURCE_ESPOTA, nullptr)) {
+      _espOta.reply("Update in progress");
+      return;
+    }
+    if (!setExpectedDigests("", invitation.md5) || !checkPartitionSize(otaMode, invitation.size)) {
+      _espOta.reply(_lastErrorMessage);
+      finishUpload(false);
+      return;
+    }
+    _espOta.reply("OK");
+    
+    if (_onStart) {
+      _onStart();
+    }
+    _events.record(ESP32FW_EVENT_ESPOTA_START, otaMode, invitation.size, invitation.host.toString().c_str());
+  }
+  bool success = receiveEspOta(invitation, otaMode);
+  ESP32FwTransportLock lock(_transport);
+  if (success) {
+    _events.record(ESP32FW_EVENT_UPDATE_SUCCESS);
+  }
+  finishUpload(success);
+}
+
+bool ESP32FwUploaderClass::receiveEspOta(const ESP32FwEspOta::Invitation& invitation, ESP32Fw_Mode otaMode){
+  // The host waits for the device to connect back to the port it announced
+  WiFiClient client;
+  if (!client.connect(invitation.host, invitation.port)) {
+    ESP32FwTransportLock lock(_transport);
+    setError(ESP32FW_ERROR_NETWORK_ERROR, "espota: failed to connect back to the host");
+    return false;
+  }
+  uint8_t* buffer = (uint8_t*)malloc(ESP32FW_PULL_BUFFER_SIZE);
+  if (!buffer) {
+    ESP32FwTransportLock lock(_transport);
+    setError(ESP32FW_ERROR_UPDATE_BEGIN_FAILED, "Not enough memory for espota buffer");
+    client.stop();
+    return false;
+  }
+  
+  {
+    ESP32FwTransportLock lock(_transport);
+    beginUpdate(otaMode, invitation.size);
+    startPayload("");
+  }
+  size_t received = 0;
+  unsigned long lastData = millis();
+  bool success = true;
+  while (received < invitation.size) {
+    size_t available = client.available();
+    if (available == 0) {
+      if (!client.connected() || millis() - lastData > ESP32FW_ESPOTA_TIMEOUT_MS) {
+        ESP32FwTransportLock lock(_transport);
+        setError(ESP32FW_ERROR_NETWORK_ERROR, "espota: connection lost");
+        success = false;
+        break;
+      }
+      delay(1);
+      continue;
+    }
+    int n = client.read(buffer, min(available, min((size_t)ESP32FW_PULL_BUFFER_SIZE, invitation.size - received)));
+    {
+      ESP32FwTransportLock lock(_transport);
+      if (n <= 0 || !writePayload(buffer, n)) {
+        success = false;
+        break;
+      }
+      received += n;
+      reportProgress(received, invitation.size);
+    }
+    lastData = millis();
+    // The tool waits for each piece to be acknowledged before it sends more
+    client.print(n);
+  }
+  free(buffer);
+  
+  {
+    ESP32FwTransportLock lock(_transport);
+    if (success) {
+      success = endUpdate();
+    } else {
+      abortUpdate();
+    }
+  }
+  // espota.py reports an answer containing "OK" as success and one
+  // containing "E" as a failure
+  if (success) {
+    client.print("OK");
+  } else {
+    client.print(String("Error: ") + _lastErrorMessage);
+  }
+  client.stop();
+  return success;
+}
+#endif
+
+void ESP32FwUploaderClass::handleMetrics(ESP32FwRequest& request){
+  if (_authenticate && !checkAuth(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  // JSON by default, Prometheus text exposition format on request
+  if (request.arg("format") == "prometheus") {
+    request.send(200, "text/plain; version=0.0.4", _metrics.toPrometheus());
+  } else {
+    request.send(200, "application/json", _metrics.toJSON());
+  }
+}
+
+void ESP32FwUploaderClass::reportProgress(size_t current, size_t total){
+  if (_onProgress) {
+    _onProgress(current, total);
+  }
+  // Update.progress() counts what has been handed to flash, which trails
+  // the received bytes by the write buffers
+  size_t written = !_updateStarted ? 0 : _sectorWrites ? _sectors.progress() : Update.progress();
+  _progress.update(current, written, total);
+}
+
+#if ESP32FW_FEATURE_EVENT_LOG
+void ESP32FwUploaderClass::handleEvents(ESP32FwRequest& request){
+  if (_authenticate && !checkAuth(request)) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed");
+    return request.requestAuthentication();
+  }
+  String json = "{\"events\":" + _events.toJSON() +
+                ",\"last_error\":" + String(_lastError) + "}";
+  request.send(200, "application/json", json);
+}
+#endif
+
+void ESP32FwUploaderClass::sendSessionStatus(ESP32FwRequest& request, int code){
+  String json = "{\"session\":" + String(_session.id) +
+                ",\"offset\":" + String(_session.offset) +
+                ",\"size\":" + String(_session.size) + "}";
+  request.send(code, "application/json", json);
+}
+
+#if ESP32FW_FEATURE_FILESYSTEM
+void ESP32FwUploaderClass::sendFileSyncStatus(ESP32FwRequest& request, int code){
+  String json = "{\"sync\":" + String(_session.id) + ",\"pending\":[";
+  const std::vector<ESP32FwFileSync::Entry>& pending = _fileSync.pending();
+  for (size_t i = 0; i < pending.size(); i++) {
+    json += i > 0 ? ",\"" : "\"";
+    json += pending[i].path + "\"";
+  }
+  json += "],\"deleted\":[";
+  const std::vector<String>& deleted = _fileSync.deleted();
+  for (size_t i = 0; i < deleted.size(); i++) {
+    json += i > 0 ? ",\"" : "\"";
+    json += deleted[i] + "\"";
+  }
+  json += "]}";
+  request.send(code, "application/json", json);
+}
+#endif
+
+void ESP32FwUploaderClass::reportWriteError(size_t expected, size_t written){
+  String errorMsg = "Failed to write update data: ";
+  String updateError = updateErrorString();
+  if (updateError.length() == 0 || updateError == "No Error") {
+    errorMsg += "Write size mismatch (expected: " + String(expected) + ", written: " + String(written) + ")";
+    errorMsg += ", Free heap: " + String(ESP.getFreeHeap()) + " bytes";
+  } else {
+    errorMsg += updateError;
+  }
+  setError(ESP32FW_ERROR_UPDATE_WRITE_FAILED, errorMsg);
+}
+
+ESP32Fw_Mode ESP32FwUploaderClass::parseMode(const String& mode){
+  if (mode == "filesystem") {
+    return ESP32FW_MODE_FILESYSTEM;
+  }
+  if (mode == "firmware") {
+    return ESP32FW_MODE_FIRMWARE;
+  }
+  // Picked from the first bytes of the image
+  return ESP32FW_MODE_AUTO;
+}
+
+void ESP32FwUploaderClass::beginUpdate(ESP32Fw_Mode otaMode, size_t size, bool preErase){
+  _updateMode = otaMode;
+  _payloadExpected = size;
+  _preEraseRequested = preErase;
+  _updateStarted = false;
+  _events.record(ESP32FW_EVENT_UPLOAD_START, otaMode, size);
+  _progress.setPhase(ESP32FW_PHASE_BEGIN);
+  // Nothing is begun or erased until the first bytes of the image have
+  // been checked; see startUpdate()
+}
+
+bool ESP32FwUploaderClass::checkPartitionSize(ESP32Fw_Mode otaMode, size_t size){
+  #if defined(ESP8266)
+    size_t partitionSize = otaMode == ESP32FW_MODE_FILESYSTEM ?
+      ((size_t) &_FS_end - (size_t) &_FS_start) : ((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000);
+  #else
+    size_t partitionSize = ESP32FwSectorWriter::partitionSize(otaMode == ESP32FW_MODE_FILESYSTEM ?
+      ESP32FwSectorWriter::TARGET_FILESYSTEM : ESP32FwSectorWriter::TARGET_FIRMWARE);
+  #endif
+  if (size == 0 || partitionSize == 0 || size <= partitionSize) {
+    return true;
+  }
+  setError(ESP32FW_ERROR_FILE_TOO_LARGE, otaMode == ESP32FW_MODE_FILESYSTEM ?
+           "File too large for filesystem partition" : "File too large for flash partition");
+  return false;
+}
+
+bool ESP32FwUploaderClass::startUpdate(ESP32Fw_Mode otaMode){
+  _updateMode = otaMode;
+  #if !ESP32FW_FEATURE_FILESYSTEM
+    if (otaMode == ESP32FW_MODE_FILESYSTEM) {
+      setError(ESP32FW_ERROR_INVALID_FILE, "File system updates are not included in this build");
+      return false;
+    }
+  #endif
+  if (!checkPartitionSize(otaMode, _payloadExpected)) {
+    return false;
+  }
+  
+  // Start update process
+  bool updateStarted = false;
+  uint32_t beginStart = micros();
+  ESP32FwSectorWriter::Target target = otaMode == ESP32FW_MODE_FILESYSTEM ?
+    ESP32FwSectorWriter::TARGET_FILESYSTEM : ESP32FwSectorWriter::TARGET_FIRMWARE;
+  // Erasing ahead needs the sector writer; skipping unchanged sectors
+  // compares against the old contents, so it takes precedence
+  _sectorWrites = (_skipUnchanged || _preEraseRequested) && ESP32FwSectorWriter::supports(target);
+  if (_sectorWrites) {
+    #if defined(ESP8266)
+      if (otaMode == ESP32FW_MODE_FILESYSTEM) {
+        close_all_fs();
+      }
+    #endif
+    updateStarted = _sectors.begin(target, _payloadExpected);
+    _sectors.setCompare(_skipUnchanged);
+    if (updateStarted && !_skipUnchanged) {
+      _sectors.preErase(_payloadExpected);
+    }
+  }
+  #if defined(ESP8266)
+    else if (otaMode == ESP32FW_MODE_FILESYSTEM) {
+      size_t fsSize = ((size_t) &_FS_end - (size_t) &_FS_start);
+      close_all_fs();
+      updateStarted = Update.begin(fsSize, U_FS);
+    } else {
+      uint32_t maxSketchSpace = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
+      updateStarted = Update.begin(maxSketchSpace, U_FLASH);
+    }
+  #elif defined(ESP32)
+    else if (otaMode == ESP32FW_MODE_FILESYSTEM) {
+      updateStarted = Update.begin(UPDATE_SIZE_UNKNOWN, U_SPIFFS);
+    } else {
+      updateStarted = Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH);
+    }
+  #endif
+  _metrics.updateBegin(micros() - beginStart);
+  
+  if (!updateStarted) {
+    String errorMsg = "Failed to begin update: ";
+    errorMsg += updateErrorString();
+    setError(ESP32FW_ERROR_UPDATE_BEGIN_FAILED, errorMsg);
+    return false;
+  }
+  _updateStarted = true;
+  const char* description = _imageCheck.description();
+  _events.record(ESP32FW_EVENT_IMAGE_ACCEPTED, otaMode, 0, description[0] ? description : nullptr);
+  startWrites();
+  _progress.setPhase(ESP32FW_PHASE_WRITE);
+  return true;
+}
+
+bool ESP32FwUploaderClass::endUpdate(){
+  // Bundle sections are committed as they complete; the last one already
+  // checked the payload digest
+  #if ESP32FW_FEATURE_FILESYSTEM
+    if (_bundle.isRunning()) {
+      bool complete = _bundle.finish();
+      if (!complete && _lastError == ESP32FW_ERROR_NONE) {
+        String errorMsg = "Invalid bundle: ";
+        errorMsg += _bundle.errorString();
+        setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+        abortUpdate();
+      }
+      _bundle.end();
+      return complete;
+    }
+  #endif
+  _progress.setPhase(ESP32FW_PHASE_VERIFY);
+  // Refuse a payload that does not match the client's digest before
+  // anything is committed
+  if (!verifyPayload()) {
+    abortUpdate();
+    return false;
+  }
+  return commitUpdate();
+}
+
+bool ESP32FwUploaderClass::commitUpdate(){
+  // Releases the last image bytes held back with the trailer, then checks
+  // the signature; must run before the stages below are finished
+  #if ESP32FW_FEATURE_SIGNING
+    if (_verifier.isRunning()) {
+      if (!_verifier.finish()) {
+        if (_lastError == ESP32FW_ERROR_NONE) {
+          String errorMsg = "Signature check failed: ";
+          errorMsg += _verifier.errorString();
+          setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
         }
-      #endif
-      
-      if (!updateStarted) {
-        String errorMsg = "Failed to begin update: ";
-        #if defined(ESP8266) || defined(ESP32)
-          errorMsg += Update.errorString();
-        #else
-          errorMsg += "Unknown error";
-        #endif
-        setError(ESP32FW_ERROR_UPDATE_BEGIN_FAILED, errorMsg);
-        logError(errorMsg);
+        abortUpdate();
+        return false;
       }
-      
-    } else if(upload.status == UPLOAD_FILE_WRITE){
-      // First write - validate we have actual data
-      static bool firstWrite = true;
-      if (firstWrite) {
-        firstWrite = false;
-        if (upload.currentSize == 0) {
-          setError(ESP32FW_ERROR_INVALID_FILE, "No data received in upload");
-          logError("No data received in upload");
-          Update.abort();
-          return;
+      _events.record(ESP32FW_EVENT_SIGNATURE_VERIFIED);
+    }
+  #endif
+  #if defined(ESP32) && ESP32FW_FEATURE_COMPRESSION
+    if (_inflater.isRunning()) {
+      bool complete = _inflater.finish();
+      if (!complete) {
+        String errorMsg = "Invalid compressed image: ";
+        errorMsg += _inflater.errorString();
+        setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+        abortUpdate();
+        return false;
+      }
+      _events.record(ESP32FW_EVENT_INFLATED, _inflater.outputSize());
+    }
+  #endif
+  #if ESP32FW_FEATURE_DELTA
+    if (_patcher.isRunning()) {
+      if (!_patcher.finish()) {
+        String errorMsg = "Invalid delta patch: ";
+        errorMsg += _patcher.errorString();
+        setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+        abortUpdate();
+        return false;
+      }
+      _events.record(ESP32FW_EVENT_DELTA_APPLIED, _patcher.targetSize());
+    }
+  #endif
+  // An image shorter than the checked header is only identified here
+  if (!_imageCheck.finish()) {
+    if (_lastError == ESP32FW_ERROR_NONE) {
+      String errorMsg = "Rejected image: ";
+      errorMsg += _imageCheck.errorString();
+      setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+    }
+    abortUpdate();
+    return false;
+  }
+  if (!finishWrites()) {
+    String errorMsg = "Failed to write update data: ";
+    errorMsg += updateErrorString();
+    setError(ESP32FW_ERROR_UPDATE_WRITE_FAILED, errorMsg);
+    abortUpdate();
+    return false;
+  }
+  _progress.setPhase(ESP32FW_PHASE_END);
+  uint32_t endStart = micros();
+  bool ended = _sectorWrites ? _sectors.finish() : Update.end(true);
+  _metrics.updateEnd(micros() - endStart);
+  if (_sectorWrites) {
+    size_t skipped = _sectors.sectorsSkipped();
+    size_t total = skipped + _sectors.sectorsWritten();
+    _metrics.sectorsWritten(_sectors.sectorsWritten(), skipped);
+    if (_skipUnchanged) {
+      _events.record(ESP32FW_EVENT_SECTORS_SKIPPED, skipped, total);
+    } else {
+      _events.record(ESP32FW_EVENT_SECTORS_PRE_ERASED, _sectors.sectorsPreErased(), total);
+    }
+  }
+  if (!ended) {
+    String errorMsg = "Failed to finalize update: ";
+    errorMsg += updateErrorString();
+    setError(ESP32FW_ERROR_UPDATE_END_FAILED, errorMsg);
+    abortUpdate();
+    return false;
+  }
+  _sectors.end();
+  _updateStarted = false;
+  return true;
+}
+
+bool ESP32FwUploaderClass::readExpectedDigests(ESP32FwRequest& request){
+  // Query arguments take precedence over the X-Firmware-* headers
+  String sha256 = request.hasArg("sha256") ? request.arg("sha256") : request.header("X-Firmware-SHA256");
+  String md5 = request.hasArg("md5") ? request.arg("md5") : request.header("X-Firmware-MD5");
+  return setExpectedDigests(sha256, md5);
+}
+
+// The SHA-256 of an image equals the running one only if the bytes are the
+// same, so compressed, delta and bundle payloads never match. A digest not
+// hashed yet (or expired) counts as different and is queued, so the next
+// attempt can be skipped.
+bool ESP32FwUploaderClass::isUpToDate(const String& sha256, ESP32Fw_Mode mode){
+  uint8_t expected[ESP32FW_SHA256_SIZE];
+  if (!_skipUpToDate || !hexToDigest(sha256, expected, sizeof(expected))) {
+    return false;
+  }
+  for (int target = 0; target < ESP32FwRunningHash::TARGET_COUNT; target++) {
+    ESP32Fw_Mode targetMode = target == ESP32FwRunningHash::TARGET_FIRMWARE ? ESP32FW_MODE_FIRMWARE : ESP32FW_MODE_FILESYSTEM;
+    if (mode != ESP32FW_MODE_AUTO && mode != targetMode) {
+      continue;
+    }
+    const uint8_t* running = _runningHash.digest((ESP32FwRunningHash::Target)target);
+    if (!running) {
+      _runningHash.request((ESP32FwRunningHash::Target)target);
+    } else if (memcmp(running, expected, sizeof(expected)) == 0) {
+      _events.record(ESP32FW_EVENT_UP_TO_DATE, targetMode);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ESP32FwUploaderClass::setExpectedDigests(const String& sha256, const String& md5){
+  _expectSha256 = sha256.length() > 0;
+  _expectMd5 = md5.length() > 0;
+  if ((_expectSha256 && !hexToDigest(sha256, _expectedSha256, sizeof(_expectedSha256))) ||
+      (_expectMd5 && !hexToDigest(md5, _expectedMd5, sizeof(_expectedMd5)))) {
+    _expectSha256 = false;
+    _expectMd5 = false;
+    setError(ESP32FW_ERROR_INVALID_FILE, "Malformed expected digest");
+    return false;
+  }
+  return true;
+}
+
+void ESP32FwUploaderClass::startPayload(const String& compression){
+  // "gzip"/"deflate" force decompression; otherwise gzip is detected from
+  // the magic bytes at the start of the payload
+  
+  // SHA-256 is always measured; MD5 only when the client asks for it
+  _payloadSize = 0;
+  _lastSha256 = "";
+  _lastMd5 = "";
+  _payloadSha256.begin();
+  if (_expectMd5) {
+    _payloadMd5.begin();
+  }
+  if (compression == "gzip") {
+    startImage(ESP32FW_COMPRESSION_GZIP);
+  } else if (compression == "deflate") {
+    startImage(ESP32FW_COMPRESSION_DEFLATE);
+  } else if (compression == "none") {
+    startImage(ESP32FW_COMPRESSION_NONE);
+  } else {
+    startImage(ESP32FW_COMPRESSION_AUTO);
+  }
+}
+
+void ESP32FwUploaderClass::startImage(ESP32Fw_Compression compression){
+  _payloadStarted = false;
+  _imageStarted = false;
+  _payloadCompression = compression;
+  
+  // The update begins once the image has been identified
+  ESP32FwImageCheck::Kind expected = _updateMode == ESP32FW_MODE_FIRMWARE ? ESP32FwImageCheck::KIND_FIRMWARE :
+    _updateMode == ESP32FW_MODE_FILESYSTEM ? ESP32FwImageCheck::KIND_FILESYSTEM : ESP32FwImageCheck::KIND_UNKNOWN;
+  _imageCheck.begin(expected, [this](ESP32FwImageCheck::Kind kind) {
+    return startUpdate(kind == ESP32FwImageCheck::KIND_FILESYSTEM ? ESP32FW_MODE_FILESYSTEM : ESP32FW_MODE_FIRMWARE);
+  }, [this](uint8_t* out, size_t outLen) {
+    return writeFlash(out, outLen);
+  });
+  
+  // With a signing key set every image must carry a valid signature
+  #if ESP32FW_FEATURE_SIGNING
+    if (_signatureRequired) {
+      _verifier.begin([this](uint8_t* out, size_t outLen) {
+        return writeStream(out, outLen);
+      });
+    }
+  #endif
+}
+
+bool ESP32FwUploaderClass::writePayload(uint8_t* data, size_t len){
+  _metrics.chunkReceived(len);
+  _payloadSha256.update(data, len);
+  if (_expectMd5) {
+    _payloadMd5.add(data, len);
+  }
+  _payloadSize += len;
+  
+  // Progress is recorded at fixed byte intervals, not per chunk
+  if (_payloadSize / ESP32FW_PROGRESS_EVENT_BYTES != (_payloadSize - len) / ESP32FW_PROGRESS_EVENT_BYTES) {
+    _events.record(ESP32FW_EVENT_PROGRESS, _payloadSize, _payloadExpected);
+  }
+  
+  // Stages only record errors; the update is aborted here, once they have returned
+  bool ok;
+  #if ESP32FW_FEATURE_FILESYSTEM
+    // A bundle replaces the update begun for the request with one per section
+    if (_payloadSize == len && len >= 4 && memcmp(data, ESP32FW_BUNDLE_MAGIC, 4) == 0) {
+      startBundle();
+    }
+    if (_bundle.isRunning()) {
+      ok = _bundle.write(data, len);
+      if (!ok && _lastError == ESP32FW_ERROR_NONE) {
+        String errorMsg = "Invalid bundle: ";
+        errorMsg += _bundle.errorString();
+        setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+      }
+    } else {
+      ok = writeSigned(data, len);
+    }
+  #else
+    ok = writeSigned(data, len);
+  #endif
+  if (!ok) {
+    abortUpdate();
+  }
+  return ok;
+}
+
+bool ESP32FwUploaderClass::writeSigned(uint8_t* data, size_t len){
+  #if ESP32FW_FEATURE_SIGNING
+    return _verifier.isRunning() ? _verifier.write(data, len) : writeStream(data, len);
+  #else
+    return writeStream(data, len);
+  #endif
+}
+
+#if ESP32FW_FEATURE_FILESYSTEM
+void ESP32FwUploaderClass::startBundle(){
+  // Nothing has been begun yet; the sections begin their own updates
+  abortUpdate();
+  _bundle.begin([this](const ESP32FwBundleReader::Section& section) {
+    ESP32Fw_Mode mode = section.type == ESP32FW_BUNDLE_FILESYSTEM ? ESP32FW_MODE_FILESYSTEM : ESP32FW_MODE_FIRMWARE;
+    beginUpdate(mode, section.size);
+    startImage(ESP32FW_COMPRESSION_AUTO);
+    return true;
+  }, [this](uint8_t* data, size_t len) {
+    return writeSigned(data, len);
+  }, [this](const ESP32FwBundleReader::Section& section) {
+    // The last section ends with the payload: check the client's digest
+    // before the firmware is made bootable
+    if (_bundle.sectionsDone() + 1 == _bundle.sectionCount()) {
+      _progress.setPhase(ESP32FW_PHASE_VERIFY);
+      if (!verifyPayload()) {
+        return false;
+      }
+    }
+    if (!commitUpdate()) {
+      return false;
+    }
+    if (section.type == ESP32FW_BUNDLE_FIRMWARE) {
+      _bundleFirmwareCommitted = true;
+    }
+    _events.record(ESP32FW_EVENT_BUNDLE_SECTION_DONE, section.type, section.size);
+    return true;
+  });
+  _events.record(ESP32FW_EVENT_BUNDLE_START);
+}
+
+void ESP32FwUploaderClass::keepRunningFirmware(){
+  #if defined(ESP32)
+    esp_ota_set_boot_partition(esp_ota_get_running_partition());
+  #elif defined(ESP8266)
+    // Drops the copy command Update.end() left for the bootloader
+    eboot_command_clear();
+  #endif
+  _events.record(ESP32FW_EVENT_BUNDLE_FIRMWARE_KEPT);
+}
+#endif
+
+bool ESP32FwUploaderClass::writeStream(uint8_t* data, size_t len){
+  if (!_payloadStarted && len > 0) {
+    _payloadStarted = true;
+    if (_payloadCompression == ESP32FW_COMPRESSION_AUTO) {
+      bool gzip = len >= 2 && data[0] == 0x1f && data[1] == 0x8b;
+      _payloadCompression = gzip ? ESP32FW_COMPRESSION_GZIP : ESP32FW_COMPRESSION_NONE;
+    }
+    if (_payloadCompression != ESP32FW_COMPRESSION_NONE && !startInflate()) {
+      return false;
+    }
+  }
+  
+  #if defined(ESP32) && ESP32FW_FEATURE_COMPRESSION
+    if (_inflater.isRunning()) {
+      bool ok = _inflater.write(data, len);
+      if (!ok && _lastError == ESP32FW_ERROR_NONE) {
+        String errorMsg = "Invalid compressed image: ";
+        errorMsg += _inflater.errorString();
+        setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+      }
+      return ok;
+    }
+  #endif
+  return writeImage(data, len);
+}
+
+bool ESP32FwUploaderClass::verifyPayload(){
+  uint8_t sha256[ESP32FW_SHA256_SIZE];
+  _payloadSha256.finish(sha256);
+  _lastSha256 = digestToHex(sha256, sizeof(sha256));
+  _events.record(ESP32FW_EVENT_PAYLOAD_DIGEST, 0, 0, _lastSha256.c_str());
+  
+  String errorMsg;
+  if (_expectSha256 && memcmp(sha256, _expectedSha256, sizeof(sha256)) != 0) {
+    errorMsg = "SHA-256 mismatch: expected " + digestToHex(_expectedSha256, sizeof(_expectedSha256)) + ", got " + _lastSha256;
+  }
+  if (_expectMd5) {
+    uint8_t md5[16];
+    _payloadMd5.calculate();
+    _payloadMd5.getBytes(md5);
+    _lastMd5 = digestToHex(md5, sizeof(md5));
+    if (errorMsg.length() == 0 && memcmp(md5, _expectedMd5, sizeof(md5)) != 0) {
+      errorMsg = "MD5 mismatch: expected " + digestToHex(_expectedMd5, sizeof(_expectedMd5)) + ", got " + _lastMd5;
+    }
+  }
+  if (errorMsg.length() == 0) {
+    return true;
+  }
+  // A payload cut short by an earlier error keeps that error
+  if (_lastError == ESP32FW_ERROR_NONE) {
+    setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+  }
+  return false;
+}
+
+bool ESP32FwUploaderClass::writeImage(uint8_t* data, size_t len){
+  // A delta patch is recognized by its magic once any compression is removed
+  if (!_imageStarted && len > 0) {
+    _imageStarted = true;
+    if (len >= 4 && memcmp(data, ESP32FW_DELTA_MAGIC, 4) == 0) {
+      #if ESP32FW_FEATURE_DELTA
+        if (_updateMode == ESP32FW_MODE_FILESYSTEM) {
+          setError(ESP32FW_ERROR_INVALID_FILE, "Delta patches are only supported for firmware");
+          return false;
         }
-        logMessage("First chunk received: " + String(upload.currentSize) + " bytes");
+        // A digest of the running firmware hashed earlier from loop() spares
+        // the patcher hashing the source itself
+        _patcher.begin([this](uint8_t* out, size_t outLen) {
+          return writeChecked(out, outLen);
+        }, _runningHash.digest(ESP32FwRunningHash::TARGET_FIRMWARE), _runningHash.size(ESP32FwRunningHash::TARGET_FIRMWARE));
+        _events.record(ESP32FW_EVENT_DELTA_START);
+      #else
+        setError(ESP32FW_ERROR_INVALID_FILE, "Delta patches are not included in this build");
+        return false;
+      #endif
+    }
+  }
+  
+  #if ESP32FW_FEATURE_DELTA
+    if (_patcher.isRunning()) {
+      bool ok = _patcher.write(data, len);
+      if (!ok && _lastError == ESP32FW_ERROR_NONE) {
+        String errorMsg = "Invalid delta patch: ";
+        errorMsg += _patcher.errorString();
+        setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
       }
-      
-      size_t written = Update.write(upload.buf, upload.currentSize);
-      if(written != upload.currentSize){
-        String errorMsg = "Failed to write update data: ";
-        #if defined(ESP8266) || defined(ESP32)
-          String updateError = Update.errorString();
-          if (updateError.length() == 0 || updateError == "No Error") {
-            errorMsg += "Write size mismatch (expected: " + String(upload.currentSize) + ", written: " + String(written) + ")";
-            errorMsg += ", Free heap: " + String(ESP.getFreeHeap()) + " bytes";
-          } else {
-            errorMsg += updateError;
-          }
-        #else
-          errorMsg += "Unknown error";
-        #endif
-        setError(ESP32FW_ERROR_UPDATE_WRITE_FAILED, errorMsg);
-        logError(errorMsg);
-        Update.abort();
+      return ok;
+    }
+  #endif
+  return writeChecked(data, len);
+}
+
+bool ESP32FwUploaderClass::writeChecked(uint8_t* data, size_t len){
+  bool ok = _imageCheck.write(data, len);
+  if (!ok && _lastError == ESP32FW_ERROR_NONE) {
+    String errorMsg = "Rejected image: ";
+    errorMsg += _imageCheck.errorString();
+    setError(ESP32FW_ERROR_INVALID_FILE, errorMsg);
+  }
+  return ok;
+}
+
+bool ESP32FwUploaderClass::writeFlash(uint8_t* data, size_t len){
+  size_t written = writeUpdate(data, len);
+  if (written != len) {
+    reportWriteError(len, written);
+    return false;
+  }
+  return true;
+}
+
+bool ESP32FwUploaderClass::startInflate(){
+  #if !ESP32FW_FEATURE_COMPRESSION
+    setError(ESP32FW_ERROR_INVALID_FILE, "Compressed images are not included in this build");
+    return false;
+  #elif defined(ESP32)
+    ESP32FwInflater::Format format = _payloadCompression == ESP32FW_COMPRESSION_GZIP ?
+      ESP32FwInflater::FORMAT_GZIP : ESP32FwInflater::FORMAT_ZLIB;
+    bool started = _inflater.begin(format, [this](uint8_t* out, size_t outLen) {
+      return writeImage(out, outLen);
+    });
+    if (!started) {
+      setError(ESP32FW_ERROR_UPDATE_BEGIN_FAILED, _inflater.errorString());
+      return false;
+    }
+    _events.record(ESP32FW_EVENT_INFLATE_START);
+    return true;
+  #else
+    // The ESP8266 bootloader unpacks gzip firmware itself when it copies the
+    // new image into place, so compressed firmware is written as is
+    if (_updateMode != ESP32FW_MODE_FILESYSTEM && _payloadCompression == ESP32FW_COMPRESSION_GZIP) {
+      _payloadCompression = ESP32FW_COMPRESSION_NONE;
+      _events.record(ESP32FW_EVENT_GZIP_PASSTHROUGH);
+      return true;
+    }
+    setError(ESP32FW_ERROR_INVALID_FILE, "Compressed images are only supported for gzip firmware on ESP8266");
+    return false;
+  #endif
+}
+
+void ESP32FwUploaderClass::startWrites(){
+  #if defined(ESP32)
+    if (_pipelined) {
+      auto output = [this](uint8_t* data, size_t len) {
+        return writeTarget(data, len) == len;
+      };
+      if (_pipeline.begin(output, &_metrics.flashWrites())) {
+        _events.record(ESP32FW_EVENT_PIPELINE_START);
         return;
-      } else {
-        totalReceived += upload.currentSize;
-        
-        // Call progress callback
-        if (_onProgress) {
-          _onProgress(totalReceived, upload.totalSize);
-        }
-        
-        // Log progress periodically
-        if (totalReceived % 10240 == 0 || totalReceived == upload.totalSize) { // Every 10KB or at end
-          float percentage = (float)totalReceived / upload.totalSize * 100.0;
-          logMessage("Upload progress: " + String(percentage, 1) + "% (" + String(totalReceived) + "/" + String(upload.totalSize) + " bytes)");
-        }
       }
-    } else if(upload.status == UPLOAD_FILE_END){
-      if(Update.end(true)){
-        logMessage("Update success: " + String(upload.totalSize) + " bytes");
-      } else {
-        String errorMsg = "Failed to finalize update: ";
-        #if defined(ESP8266) || defined(ESP32)
-          errorMsg += Update.errorString();
-        #else
-          errorMsg += "Unknown error";
-        #endif
-        setError(ESP32FW_ERROR_UPDATE_END_FAILED, errorMsg);
-        logError(errorMsg);
+      _events.record(ESP32FW_EVENT_PIPELINE_FALLBACK);
+    }
+  #endif
+  // Coalesce chunks into whole blocks; the pipeline's slots already do this
+  _blockLen = 0;
+  if (_writeBlockSize > 0) {
+    _blockBuffer = (uint8_t*)malloc(_writeBlockSize);
+    if (!_blockBuffer) {
+      _events.record(ESP32FW_EVENT_BLOCK_FALLBACK);
+    }
+  }
+}
+
+size_t ESP32FwUploaderClass::writeUpdate(uint8_t* data, size_t len){
+  #if defined(ESP32)
+    if (_pipeline.isRunning()) {
+      return _pipeline.write(data, len) ? len : 0;
+    }
+  #endif
+  if (!_blockBuffer) {
+    return flashWrite(data, len);
+  }
+  size_t consumed = 0;
+  while (consumed < len) {
+    // Pass whole blocks straight through when nothing is pending
+    if (_blockLen == 0 && len - consumed >= _writeBlockSize) {
+      if (flashWrite(data + consumed, _writeBlockSize) != _writeBlockSize) {
+        return consumed;
+      }
+      consumed += _writeBlockSize;
+      continue;
+    }
+    size_t n = min(len - consumed, _writeBlockSize - _blockLen);
+    memcpy(_blockBuffer + _blockLen, data + consumed, n);
+    _blockLen += n;
+    consumed += n;
+    if (_blockLen == _writeBlockSize) {
+      if (flashWrite(_blockBuffer, _blockLen) != _blockLen) {
+        return consumed - n;
       }
-    } else if(upload.status == UPLOAD_FILE_ABORTED) {
-      logError("Upload aborted");
-      setError(ESP32FW_ERROR_NETWORK_ERROR, "Upload was aborted");
+      _blockLen = 0;
     }
-  });
+  }
+  return consumed;
+}
+
+size_t ESP32FwUploaderClass::flashWrite(uint8_t* data, size_t len){
+  uint32_t start = micros();
+  size_t written = writeTarget(data, len);
+  _metrics.flashWrites().record(micros() - start);
+  return written;
+}
+
+size_t ESP32FwUploaderClass::writeTarget(uint8_t* data, size_t len){
+  if (_sectorWrites) {
+    return _sectors.write(data, len) ? len : 0;
+  }
+  return Update.write(data, len);
+}
+
+String ESP32FwUploaderClass::updateErrorString(){
+  if (_sectorWrites) {
+    return _sectors.errorString() ? _sectors.errorString() : "";
+  }
+  #if defined(ESP8266) || defined(ESP32)
+    return Update.errorString();
+  #else
+    return "Unknown error";
+  #endif
+}
+
+bool ESP32FwUploaderClass::finishWrites(){
+  bool ok = true;
+  #if defined(ESP32)
+    if (_pipeline.isRunning()) {
+      ok = _pipeline.flush();
+      _pipeline.end();
+    }
+  #endif
+  // Flush the partial block left at the end of the image
+  if (_blockBuffer && _blockLen > 0) {
+    ok = ok && flashWrite(_blockBuffer, _blockLen) == _blockLen;
+  }
+  stopWrites();
+  return ok;
+}
+
+void ESP32FwUploaderClass::stopWrites(){
+  #if defined(ESP32)
+    _pipeline.end();
+  #endif
+  #if defined(ESP32) && ESP32FW_FEATURE_COMPRESSION
+    _inflater.end();
+  #endif
+  #if ESP32FW_FEATURE_DELTA
+    _patcher.end();
+  #endif
+  #if ESP32FW_FEATURE_SIGNING
+    _verifier.end();
+  #endif
+  _imageCheck.end();
+  free(_blockBuffer);
+  _blockBuffer = nullptr;
+  _blockLen = 0;
+}
+
+void ESP32FwUploaderClass::abortUpdate(){
+  stopWrites();
+  if (!_updateStarted) {
+    return;
+  }
+  _updateStarted = false;
+  if (_sectorWrites) {
+    _sectors.end();
+  } else {
+    Update.abort();
+  }
 }
 
 void ESP32FwUploaderClass::loop(){
+  // With the async server the handlers run in another task; everything
+  // here that touches upload state does so under the transport's lock.
+  // Pull and espota updates take it a step at a time, never while they
+  // wait on the network.
+  {
+    ESP32FwTransportLock lock(_transport);
+    // Drop sessions the client has given up on so the update is not left open
+    bool idleSource = _session.source == ESP32FW_SOURCE_SESSION || _session.source == ESP32FW_SOURCE_FILES;
+    if (idleSource && millis() - _session.activity > ESP32FW_SESSION_TIMEOUT_MS) {
+      setError(ESP32FW_ERROR_NETWORK_ERROR, "Upload session timed out");
+      abortUpdate();
+      finishUpload(false);
+    }
+    
+    // Erase ahead of an announced upload while its data is on the way
+    if (_sectorWrites && _sectors.isErasing()) {
+      _sectors.eraseStep(ESP32FW_PRE_ERASE_BUDGET_MS);
+    }
+    
+    if (_transport) {
+      _transport->loop();
+    }
+    
+    // Events are only formatted here, outside the upload handlers
+    #if ESP32FW_FEATURE_EVENT_LOG
+      if (_debugEnabled) {
+        _events.drain(Serial);
+      }
+    #endif
+  }
+  
+  #if ESP32FW_FEATURE_PULL
+    if (_pullRequested) {
+      _pullRequested = false;
+      updateFromURL(_pullUrl, _pullMode, _pullSha256);
+    }
+  #endif
+  
+  // Hash the running image a slice at a time while no update touches
+  // flash. Any update may have rewritten the file system, which is hashed
+  // again when next asked for.
+  {
+    ESP32FwTransportLock lock(_transport);
+    if (_fsHashStale) {
+      _fsHashStale = false;
+      _runningHash.invalidate(ESP32FwRunningHash::TARGET_FILESYSTEM);
+    }
+    if (_session.source == ESP32FW_SOURCE_NONE) {
+      _runningHash.step(ESP32FW_RUNNING_HASH_BUDGET_US);
+    }
+  }
+  
+  #if ESP32FW_FEATURE_ESPOTA
+    ESP32FwEspOta::Result espOta = _espOta.poll();
+    if (espOta == ESP32FwEspOta::RESULT_INVITED) {
+      updateFromEspOta();
+    } else if (espOta == ESP32FwEspOta::RESULT_AUTH_FAILED) {
+      ESP32FwTransportLock lock(_transport);
+      _events.record(ESP32FW_EVENT_AUTH_REJECTED, ESP32FW_SOURCE_ESPOTA);
+    }
+  #endif
   handleReboot();
 }
 
+#if ESP32FW_FEATURE_AUTH
 void ESP32FwUploaderClass::setAuth(const char* username, const char* password) {
   _username = username;
   _password = password;
   _authenticate = (_username.length() > 0 && _password.length() > 0);
-  logMessage("Authentication " + String(_authenticate ? "enabled" : "disabled"));
+  #if ESP32FW_FEATURE_ESPOTA
+    _espOta.setPassword(_authenticate ? _password : String());
+  #endif
+  if (_transport) {
+    _transport->setCredentials(_authenticate ? username : "", _authenticate ? password : "");
+  }
+  _events.record(ESP32FW_EVENT_AUTH, 0, 0, _authenticate ? "enabled" : "disabled");
 }
 
 void ESP32FwUploaderClass::clearAuth() {
   _authenticate = false;
   _username = "";
   _password = "";
-  logMessage("Authentication cleared");
+  #if ESP32FW_FEATURE_ESPOTA
+    _espOta.setPassword(String());
+  #endif
+  if (_transport) {
+    _transport->setCredentials("", "");
+  }
+  _events.record(ESP32FW_EVENT_AUTH, 0, 0, "cleared");
 }
+#endif
 
 void ESP32FwUploaderClass::setAutoReboot(bool enable) {
   _autoReboot = enable;
-  logMessage("Auto reboot " + String(enable ? "enabled" : "disabled"));
+  _events.record(ESP32FW_EVENT_AUTO_REBOOT, 0, 0, enable ? "enabled" : "disabled");
 }
 
+#if ESP32FW_FEATURE_EVENT_LOG
 void ESP32FwUploaderClass::setDebug(bool enable) {
   _debugEnabled = enable;
-  logMessage("Debug logging " + String(enable ? "enabled" : "disabled"));
+  _events.record(ESP32FW_EVENT_DEBUG, 0, 0, enable ? "enabled" : "disabled");
+}
+#endif
+
+void ESP32FwUploaderClass::setPipelined(bool enable) {
+  #if defined(ESP32)
+    _pipelined = enable;
+    _events.record(ESP32FW_EVENT_PIPELINED, 0, 0, enable ? "enabled" : "disabled");
+  #else
+    _events.record(ESP32FW_EVENT_PIPELINED, 0, 0, "only supported on ESP32");
+  #endif
+}
+
+void ESP32FwUploaderClass::setSkipUnchanged(bool enable) {
+  _skipUnchanged = enable;
+  #if defined(ESP32)
+    _events.record(ESP32FW_EVENT_SKIP_UNCHANGED, 0, 0, enable ? "enabled" : "disabled");
+  #else
+    _events.record(ESP32FW_EVENT_SKIP_UNCHANGED, 0, 0, enable ? "enabled for file system images" : "disabled");
+  #endif
+}
+
+void ESP32FwUploaderClass::setPreErase(bool enable) {
+  _preErase = enable;
+  #if defined(ESP32)
+    _events.record(ESP32FW_EVENT_PRE_ERASE, 0, 0, enable ? "enabled" : "disabled");
+  #else
+    _events.record(ESP32FW_EVENT_PRE_ERASE, 0, 0, enable ? "enabled for file system images" : "disabled");
+  #endif
+}
+
+void ESP32FwUploaderClass::setSkipUpToDate(bool enable) {
+  _skipUpToDate = enable;
+  // The running firmware cannot change before the next reboot, so it is
+  // hashed once right away; the file system only when a client asks
+  if (enable) {
+    _runningHash.request(ESP32FwRunningHash::TARGET_FIRMWARE);
+  }
+  _events.record(ESP32FW_EVENT_SKIP_UP_TO_DATE, 0, 0, enable ? "enabled" : "disabled");
+}
+
+#if ESP32FW_FEATURE_FILESYSTEM
+void ESP32FwUploaderClass::setFileSystem(fs::FS& fs) {
+  _fileSync.setFileSystem(&fs);
+  _events.record(ESP32FW_EVENT_FILE_SYNC, 0, 0, "enabled");
+}
+#endif
+
+#if ESP32FW_FEATURE_ESPOTA
+bool ESP32FwUploaderClass::setEspOta(bool enable, uint16_t port) {
+  if (!enable) {
+    _espOta.end();
+    _events.record(ESP32FW_EVENT_ESPOTA, port, 0, "disabled");
+    return true;
+  }
+  bool started = _espOta.begin(port);
+  _events.record(ESP32FW_EVENT_ESPOTA, port, 0, started ? "enabled" : "failed to open port");
+  return started;
+}
+#endif
+
+void ESP32FwUploaderClass::setProgressInterval(uint32_t intervalMs) {
+  _progress.setInterval(intervalMs);
+}
+
+void ESP32FwUploaderClass::setWriteBlockSize(size_t size) {
+  _writeBlockSize = size;
+  _events.record(ESP32FW_EVENT_BLOCK_SIZE, size);
+}
+
+#if ESP32FW_FEATURE_SIGNING
+bool ESP32FwUploaderClass::setSigningKey(const char* publicKeyPem) {
+  // A key that fails to load still requires signatures, so every upload is
+  // refused rather than accepted unchecked
+  _signatureRequired = publicKeyPem && *publicKeyPem;
+  if (!_verifier.setKey(publicKeyPem)) {
+    _events.record(ESP32FW_EVENT_SIGNING, 0, 0, "invalid key; only ECDSA public keys in PEM format are supported");
+    return false;
+  }
+  _events.record(ESP32FW_EVENT_SIGNING, 0, 0, _signatureRequired ? "required" : "not required");
+  return true;
 }
+#endif
 
+#if ESP32FW_FEATURE_WEB_UI
 void ESP32FwUploaderClass::setDarkMode(bool enable) {
   extern bool _webui_dark_mode;
   _webui_dark_mode = enable;
-  logMessage("Dark mode " + String(enable ? "enabled" : "disabled"));
+  _events.record(ESP32FW_EVENT_DARK_MODE, 0, 0, enable ? "enabled" : "disabled");
 }
+#endif
 
+#if ESP32FW_FEATURE_CALLBACKS
 void ESP32FwUploaderClass::onStart(std::function<void()> callback) {
   _onStart = callback;
 }
@@ -237,6 +1865,7 @@ void ESP32FwUploaderClass::onEnd(std::function<void(bool success)> callback) {
 void ESP32FwUploaderClass::onError(std::function<void(ESP32Fw_Error error, const String& message)> callback) {
   _onError = callback;
 }
+#endif
 
 ESP32Fw_Error ESP32FwUploaderClass::getLastError() {
   return _lastError;
@@ -246,38 +1875,101 @@ String ESP32FwUploaderClass::getLastErrorMessage() {
   return _lastErrorMessage;
 }
 
-bool ESP32FwUploaderClass::checkAuth() {
-  return _server->authenticate(_username.c_str(), _password.c_str());
+String ESP32FwUploaderClass::getLastSHA256() {
+  return _lastSha256;
+}
+
+String ESP32FwUploaderClass::getLastMD5() {
+  return _lastMd5;
+}
+
+String ESP32FwUploaderClass::getRunningSHA256(ESP32Fw_Mode mode) {
+  ESP32FwRunningHash::Target target = mode == ESP32FW_MODE_FILESYSTEM ?
+    ESP32FwRunningHash::TARGET_FILESYSTEM : ESP32FwRunningHash::TARGET_FIRMWARE;
+  const uint8_t* digest = _runningHash.digest(target);
+  if (!digest) {
+    _runningHash.request(target);
+    return String();
+  }
+  return digestToHex(digest, ESP32FW_SHA256_SIZE);
+}
+
+bool ESP32FwUploaderClass::checkAuth(ESP32FwRequest& request) {
+  #if ESP32FW_FEATURE_AUTH
+    return request.authenticate(_username.c_str(), _password.c_str());
+  #else
+    return true;
+  #endif
+}
+
+// Requests inside a session or file sync may carry the token handed out when
+// it began instead of the credentials; comparing it is cheap enough to do on
+// every chunk
+bool ESP32FwUploaderClass::checkToken(ESP32FwRequest& request) {
+  if (!_authenticate) {
+    return true;
+  }
+  String token = request.header("X-Upload-Token");
+  if (token.length() == 0) {
+    return checkAuth(request);
+  }
+  if (_session.token[0] == '\0' || token.length() != ESP32FW_TOKEN_LENGTH) {
+    return false;
+  }
+  uint8_t diff = 0;
+  for (size_t i = 0; i < ESP32FW_TOKEN_LENGTH; i++) {
+    diff |= token[i] ^ _session.token[i];
+  }
+  return diff == 0;
+}
+
+// Called when the body of an upload starts, before the update lock is taken
+// or anything is erased. A refused upload is answered with 401 and marked
+// rejected: the rest of its body is dropped as it arrives and the request
+// handler does not run. The update in progress, if any, is not disturbed.
+bool ESP32FwUploaderClass::admitUpload(ESP32FwRequest& request, ESP32Fw_UploadSource source, bool token) {
+  if (token ? checkToken(request) : (!_authenticate || checkAuth(request))) {
+    return true;
+  }
+  _events.record(ESP32FW_EVENT_AUTH_REJECTED, source);
+  if (_session.source == ESP32FW_SOURCE_NONE && !_pullRequested) {
+    setError(ESP32FW_ERROR_AUTH_FAILED, "Authentication failed, upload refused");
+  }
+  request.requestAuthentication();
+  request.reject();
+  return false;
 }
 
 void ESP32FwUploaderClass::handleReboot() {
   if (_rebootRequested && millis() >= _rebootTime) {
-    logMessage("Rebooting device...");
+    // No request is left half-handled by the restart
+    ESP32FwTransportLock lock(_transport);
+    _events.record(ESP32FW_EVENT_REBOOTING);
+    #if ESP32FW_FEATURE_EVENT_LOG
+      if (_debugEnabled) {
+        _events.drain(Serial);
+      }
+    #endif
+    // Updates pulled or received over espota work without begin()
+    if (_transport) {
+      _transport->end();
+    }
     ESP.restart();
   }
 }
 
-void ESP32FwUploaderClass::setError(ESP32Fw_Error error, const String& message) {
+void ESP32FwUploaderClass::setError(ESP32Fw_Error error, const char* message) {
   _lastError = error;
-  _lastErrorMessage = message;
+  strlcpy(_lastErrorMessage, message, sizeof(_lastErrorMessage));
+  _events.record(ESP32FW_EVENT_ERROR, error, 0, _lastErrorMessage);
   
   if (_onError) {
-    _onError(error, message);
+    _onError(error, String(_lastErrorMessage));
   }
 }
 
-void ESP32FwUploaderClass::logMessage(const String& message) {
-  if (_debugEnabled) {
-    Serial.print("[ESP32FwUploader] ");
-    Serial.println(message);
-  }
-}
-
-void ESP32FwUploaderClass::logError(const String& message) {
-  if (_debugEnabled) {
-    Serial.print("[ESP32FwUploader ERROR] ");
-    Serial.println(message);
-  }
+void ESP32FwUploaderClass::setError(ESP32Fw_Error error, const String& message) {
+  setError(error, message.c_str());
 }
 
 ESP32FwUploaderClass ESP32FwUploader;
@@ -2,24 +2,61 @@
 #define ESP32FwUploader_h
 
 #include <Arduino.h>
+#include "feature_flags.h"
 #include "web_ui.h"
+#include "upload_pipeline.h"
+#include "sector_writer.h"
+#include "file_sync.h"
+#include "bundle.h"
+#include "image_check.h"
+#if ESP32FW_FEATURE_ESPOTA
+  #include "espota.h"
+#endif
+#if ESP32FW_FEATURE_COMPRESSION
+  #include "inflater.h"
+#endif
+// Also without delta support: its magic tells a patch apart from an image
+#include "delta_patch.h"
+#include "running_hash.h"
+#include "digest.h"
+#if ESP32FW_FEATURE_SIGNING
+  #include "signature.h"
+#endif
+#include "metrics.h"
+#include "events.h"
+#include "progress_stream.h"
+#include <MD5Builder.h>
+
+// Build with -D ESP32FW_ASYNC_WEBSERVER to serve through ESPAsyncWebServer
+// instead of the synchronous WebServer / ESP8266WebServer
+#if defined(ESP32FW_ASYNC_WEBSERVER)
+  #include "transport_async.h"
+#define ESP32FW_WEBSERVER AsyncWebServer
+#define ESP32FW_TRANSPORT ESP32FwAsyncTransport
+#else
+  #include "transport_sync.h"
+#define ESP32FW_WEBSERVER ESP32FwSyncServer
+#define ESP32FW_TRANSPORT ESP32FwSyncTransport
+#endif
 
 #if defined(ESP8266)
   #include <ESP8266WiFi.h>
-  #include <ESP8266WebServer.h>
+  #if ESP32FW_FEATURE_PULL
+    #include <ESP8266HTTPClient.h>
+  #endif
   #include <Updater.h>
   #include <FS.h>
   #include <LittleFS.h>
-#define ESP32FW_WEBSERVER ESP8266WebServer
   extern "C" uint32_t _FS_start;
   extern "C" uint32_t _FS_end;
 #elif defined(ESP32)
   #include <WiFi.h>
-  #include <WebServer.h>
+  #if ESP32FW_FEATURE_PULL
+    #include <HTTPClient.h>
+  #endif
   #include <Update.h>
   #include <FS.h>
   #include <SPIFFS.h>
-#define ESP32FW_WEBSERVER WebServer
 #endif
 
 // Debug macros
@@ -35,9 +72,81 @@
   #define ESP32FW_DEBUG_PRINTF(x, ...)
 #endif
 
+// Size of the blocks uploads are coalesced into before Update.write()
+#ifndef ESP32FW_WRITE_BLOCK_SIZE
+  #define ESP32FW_WRITE_BLOCK_SIZE 4096
+#endif
+
+// Longest each loop() call spends erasing ahead of an announced upload
+#ifndef ESP32FW_PRE_ERASE_BUDGET_MS
+  #define ESP32FW_PRE_ERASE_BUDGET_MS 50
+#endif
+
+// Idle time after which an unfinished resumable upload session is aborted
+#ifndef ESP32FW_SESSION_TIMEOUT_MS
+  #define ESP32FW_SESSION_TIMEOUT_MS 300000
+#endif
+
+// Hex digits of the token handed out when a session or file sync begins
+#define ESP32FW_TOKEN_LENGTH 32
+
+// Pull updates: read buffer, stall timeout and reconnect attempts (resumed
+// with a Range request) before giving up
+#ifndef ESP32FW_PULL_BUFFER_SIZE
+  #define ESP32FW_PULL_BUFFER_SIZE 1460
+#endif
+#ifndef ESP32FW_PULL_TIMEOUT_MS
+  #define ESP32FW_PULL_TIMEOUT_MS 10000
+#endif
+#ifndef ESP32FW_PULL_RETRIES
+  #define ESP32FW_PULL_RETRIES 5
+#endif
+
+// Longest error message kept for getLastErrorMessage()
+#ifndef ESP32FW_ERROR_MESSAGE_SIZE
+  #define ESP32FW_ERROR_MESSAGE_SIZE 128
+#endif
+
 enum ESP32Fw_Mode {
     ESP32FW_MODE_FIRMWARE = 0,
-    ESP32FW_MODE_FILESYSTEM = 1
+    ESP32FW_MODE_FILESYSTEM = 1,
+    ESP32FW_MODE_AUTO = 2           // detected from the image header
+};
+
+enum ESP32Fw_Compression {
+    ESP32FW_COMPRESSION_AUTO = 0,
+    ESP32FW_COMPRESSION_NONE,
+    ESP32FW_COMPRESSION_GZIP,
+    ESP32FW_COMPRESSION_DEFLATE
+};
+
+// Where the update in progress comes from
+enum ESP32Fw_UploadSource {
+    ESP32FW_SOURCE_NONE = 0,
+    ESP32FW_SOURCE_UPLOAD,
+    ESP32FW_SOURCE_SESSION,
+    ESP32FW_SOURCE_PULL,
+    ESP32FW_SOURCE_FILES,
+    ESP32FW_SOURCE_ESPOTA
+};
+
+// State of the update in progress. Only one runs at a time: its source holds
+// the lock from acquireUpload() until finishUpload() resets this.
+struct ESP32FwUploadSession {
+    ESP32Fw_UploadSource source = ESP32FW_SOURCE_NONE;
+    const void* owner = nullptr;    // request carrying a multipart upload or file
+    size_t received = 0;
+    bool firstChunk = true;
+    bool tooLarge = false;          // refused by its Content-Length, answered with 413
+    
+    // Resumable upload session or file sync
+    uint32_t id = 0;
+    size_t size = 0;
+    size_t offset = 0;
+    unsigned long activity = 0;
+    const void* chunkOwner = nullptr;  // the chunk request being written
+    size_t chunkSkip = 0;
+    char token[ESP32FW_TOKEN_LENGTH + 1] = "";  // sent back in X-Upload-Token
 };
 
 enum ESP32Fw_Error {
@@ -51,52 +160,249 @@ enum ESP32Fw_Error {
     ESP32FW_ERROR_NETWORK_ERROR
 };
 
+#if ESP32FW_FEATURE_CALLBACKS
+  template<typename T> using ESP32FwCallback = std::function<T>;
+#else
+  // Stand-in for a std::function that is never set: `if (_onEnd)` is false
+  // at compile time and the call folds away
+  template<typename T> struct ESP32FwCallback {
+    constexpr explicit operator bool() const { return false; }
+    template<typename... Args> void operator()(Args&&...) const {}
+  };
+#endif
+
 class ESP32FwUploaderClass{
   public:
     ESP32FwUploaderClass();
     void begin(ESP32FW_WEBSERVER *server);
+    void begin(ESP32FwTransport *transport);
     void loop();
+#if ESP32FW_FEATURE_AUTH
     void setAuth(const char* username, const char* password);
     void clearAuth();
+#endif
     void setAutoReboot(bool enable);
+#if ESP32FW_FEATURE_EVENT_LOG
     void setDebug(bool enable);
+#endif
+#if ESP32FW_FEATURE_WEB_UI
     void setDarkMode(bool enable);
+#endif
+    void setPipelined(bool enable);
+    void setWriteBlockSize(size_t size);
+    void setSkipUnchanged(bool enable);
+    void setPreErase(bool enable);
+    void setSkipUpToDate(bool enable);
+#if ESP32FW_FEATURE_FILESYSTEM
+    void setFileSystem(fs::FS& fs);
+#endif
+#if ESP32FW_FEATURE_ESPOTA
+    bool setEspOta(bool enable, uint16_t port = ESP32FW_ESPOTA_PORT);
+#endif
+    void setProgressInterval(uint32_t intervalMs);
+#if ESP32FW_FEATURE_SIGNING
+    bool setSigningKey(const char* publicKeyPem);
+#endif
+#if ESP32FW_FEATURE_PULL
+    bool updateFromURL(const String& url, ESP32Fw_Mode mode = ESP32FW_MODE_FIRMWARE, const String& expectedSha256 = "");
+#endif
     
+#if ESP32FW_FEATURE_CALLBACKS
     // Callback functions
     void onStart(std::function<void()> callback);
     void onProgress(std::function<void(size_t current, size_t total)> callback);
     void onEnd(std::function<void(bool success)> callback);
     void onError(std::function<void(ESP32Fw_Error error, const String& message)> callback);
+#endif
     
     // Error handling
     ESP32Fw_Error getLastError();
     String getLastErrorMessage();
+    
+    // Digests of the last uploaded payload, as received (lowercase hex)
+    String getLastSHA256();
+    String getLastMD5();
+    
+    // SHA-256 of the running firmware or file system (lowercase hex), empty
+    // until it has been hashed from loop()
+    String getRunningSHA256(ESP32Fw_Mode mode = ESP32FW_MODE_FIRMWARE);
 
   private:
-    ESP32FW_WEBSERVER *_server;
+    ESP32FW_TRANSPORT _serverTransport;
+    ESP32FwTransport *_transport = nullptr;
+#if ESP32FW_FEATURE_AUTH
     bool _authenticate = false;
     String _username;
     String _password;
+#else
+    // Every `_authenticate &&` check folds away
+    static constexpr bool _authenticate = false;
+#endif
     bool _autoReboot = true;
     bool _rebootRequested = false;
     unsigned long _rebootTime = 0;
+#if ESP32FW_FEATURE_EVENT_LOG
     bool _debugEnabled = false;
+#endif
+    bool _pipelined = false;
+    size_t _writeBlockSize = ESP32FW_WRITE_BLOCK_SIZE;
+    uint8_t* _blockBuffer = nullptr;
+    size_t _blockLen = 0;
+    bool _skipUnchanged = false;
+    bool _preErase = false;
+    bool _skipUpToDate = false;
+    bool _sectorWrites = false;     // update goes through _sectors, not Update
+    bool _updateStarted = false;    // Update or _sectors has been begun
+    bool _preEraseRequested = false;
+    ESP32FwSectorWriter _sectors;
+#if ESP32FW_FEATURE_FILESYSTEM
+    ESP32FwFileSync _fileSync;
+    ESP32FwBundleReader _bundle;
+    bool _bundleFirmwareCommitted = false;  // undone if a later section fails
+#endif
+    ESP32FwImageCheck _imageCheck;
+#if ESP32FW_FEATURE_ESPOTA
+    ESP32FwEspOta _espOta;
+#endif
+    ESP32FwRunningHash _runningHash;
+    bool _fsHashStale = false;      // set by finishUpload(), handled in loop()
+#if defined(ESP32)
+    ESP32FwPipeline _pipeline;
+#endif
+#if defined(ESP32) && ESP32FW_FEATURE_COMPRESSION
+    ESP32FwInflater _inflater;
+#endif
+#if ESP32FW_FEATURE_DELTA
+    ESP32FwDeltaPatcher _patcher;
+#endif
+#if ESP32FW_FEATURE_SIGNING
+    ESP32FwSignatureVerifier _verifier;
+    bool _signatureRequired = false;
+#endif
+    ESP32FwMetrics _metrics;
+    ESP32FwEventLog _events;
+    ESP32FwProgressStream _progress;
+    ESP32Fw_Mode _updateMode = ESP32FW_MODE_FIRMWARE;
+    ESP32Fw_Compression _payloadCompression = ESP32FW_COMPRESSION_AUTO;
+    bool _payloadStarted = false;
+    bool _imageStarted = false;
+    
+    // Payload digests, computed as the upload streams in
+    ESP32FwSha256 _payloadSha256;
+    MD5Builder _payloadMd5;
+    size_t _payloadSize = 0;
+    size_t _payloadExpected = 0;
+    bool _expectSha256 = false;
+    bool _expectMd5 = false;
+    uint8_t _expectedSha256[ESP32FW_SHA256_SIZE];
+    uint8_t _expectedMd5[16];
+    String _lastSha256;
+    String _lastMd5;
     
     // Error handling
     ESP32Fw_Error _lastError = ESP32FW_ERROR_NONE;
-    String _lastErrorMessage = "";
+    char _lastErrorMessage[ESP32FW_ERROR_MESSAGE_SIZE] = "";
+    
+    // Update in progress
+    ESP32FwUploadSession _session;
+    
+    // Pull update requested through /ota/pull, run from loop(); stays false
+    // in a build without pull updates
+    bool _pullRequested = false;
+#if ESP32FW_FEATURE_PULL
+    String _pullUrl;
+    ESP32Fw_Mode _pullMode = ESP32FW_MODE_FIRMWARE;
+    String _pullSha256;
+#endif
     
     // Callback functions
-    std::function<void()> _onStart = nullptr;
-    std::function<void(size_t, size_t)> _onProgress = nullptr;
-    std::function<void(bool)> _onEnd = nullptr;
-    std::function<void(ESP32Fw_Error, const String&)> _onError = nullptr;
+    ESP32FwCallback<void()> _onStart;
+    ESP32FwCallback<void(size_t, size_t)> _onProgress;
+    ESP32FwCallback<void(bool)> _onEnd;
+    ESP32FwCallback<void(ESP32Fw_Error, const String&)> _onError;
     
-    bool checkAuth();
+#if ESP32FW_FEATURE_WEB_UI
+    void handleWebUI(ESP32FwRequest& request);
+#endif
+    void handleUpload(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len);
+    void handleUploadComplete(ESP32FwRequest& request);
+    void handleRawUpload(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len);
+    void handleSessionBegin(ESP32FwRequest& request);
+    void handleSessionChunk(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len);
+    void handleSessionChunkComplete(ESP32FwRequest& request);
+    void handleSessionStatus(ESP32FwRequest& request);
+    void handleSessionFinalize(ESP32FwRequest& request);
+#if ESP32FW_FEATURE_FILESYSTEM
+    void handleFilesBegin(ESP32FwRequest& request);
+    void handleManifest(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len);
+    void handleFileComplete(ESP32FwRequest& request);
+    void handleFile(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len);
+    void handleFilesFinish(ESP32FwRequest& request);
+#endif
+    void handleDigest(ESP32FwRequest& request);
+    void handleRunning(ESP32FwRequest& request);
+#if ESP32FW_FEATURE_PULL
+    void handlePull(ESP32FwRequest& request);
+#endif
+    void handleMetrics(ESP32FwRequest& request);
+#if ESP32FW_FEATURE_EVENT_LOG
+    void handleEvents(ESP32FwRequest& request);
+#endif
+    void reportProgress(size_t current, size_t total);
+#if ESP32FW_FEATURE_PULL
+    bool pullUpdate(const String& url, ESP32Fw_Mode otaMode);
+#endif
+#if ESP32FW_FEATURE_ESPOTA
+    void updateFromEspOta();
+    bool receiveEspOta(const ESP32FwEspOta::Invitation& invitation, ESP32Fw_Mode otaMode);
+#endif
+    bool isSessionRequest(ESP32FwRequest& request);
+    bool acquireUpload(ESP32Fw_UploadSource source, const void* owner);
+    bool ownsUpload(ESP32FwRequest& request);
+    void sendSessionStatus(ESP32FwRequest& request, int code);
+#if ESP32FW_FEATURE_FILESYSTEM
+    bool isFileSyncRequest(ESP32FwRequest& request);
+    void sendFileSyncStatus(ESP32FwRequest& request, int code);
+#endif
+    void finishUpload(bool success);
+    ESP32Fw_Mode parseMode(const String& mode);
+    void beginUpdate(ESP32Fw_Mode otaMode, size_t size, bool preErase = false);
+    bool checkPartitionSize(ESP32Fw_Mode otaMode, size_t size);
+    bool startUpdate(ESP32Fw_Mode otaMode);
+    bool endUpdate();
+    bool commitUpdate();
+    void reportWriteError(size_t expected, size_t written);
+    bool readExpectedDigests(ESP32FwRequest& request);
+    bool isUpToDate(const String& sha256, ESP32Fw_Mode mode);
+    bool setExpectedDigests(const String& sha256, const String& md5);
+    void startPayload(const String& compression);
+    void startImage(ESP32Fw_Compression compression);
+#if ESP32FW_FEATURE_FILESYSTEM
+    void startBundle();
+    void keepRunningFirmware();
+#endif
+    bool verifyPayload();
+    bool writePayload(uint8_t* data, size_t len);
+    bool writeSigned(uint8_t* data, size_t len);
+    bool writeStream(uint8_t* data, size_t len);
+    bool writeImage(uint8_t* data, size_t len);
+    bool writeChecked(uint8_t* data, size_t len);
+    bool writeFlash(uint8_t* data, size_t len);
+    bool startInflate();
+    void startWrites();
+    size_t writeUpdate(uint8_t* data, size_t len);
+    size_t flashWrite(uint8_t* data, size_t len);
+    size_t writeTarget(uint8_t* data, size_t len);
+    String updateErrorString();
+    bool finishWrites();
+    void stopWrites();
+    void abortUpdate();
+    bool checkAuth(ESP32FwRequest& request);
+    bool checkToken(ESP32FwRequest& request);
+    bool admitUpload(ESP32FwRequest& request, ESP32Fw_UploadSource source, bool token);
     void handleReboot();
+    void setError(ESP32Fw_Error error, const char* message);
     void setError(ESP32Fw_Error error, const String& message);
-    void logMessage(const String& message);
-    void logError(const String& message);
 };
 
 extern ESP32FwUploaderClass ESP32FwUploader;
@@ -0,0 +1,157 @@
+#include "bundle.h"
+#include "feature_flags.h"
+
+#if ESP32FW_FEATURE_FILESYSTEM
+
+static uint32_t readLE32(const uint8_t* p){
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+ESP32FwBundleReader::ESP32FwBundleReader(){}
+
+bool ESP32FwBundleReader::begin(Begin onBegin, Output output, End onEnd){
+  _running = true;
+  _onBegin = onBegin;
+  _output = output;
+  _onEnd = onEnd;
+  _state = STATE_HEADER;
+  _headerLen = 0;
+  _count = 0;
+  _parsed = 0;
+  _done = 0;
+  _left = 0;
+  _error = nullptr;
+  return true;
+}
+
+bool ESP32FwBundleReader::write(uint8_t* data, size_t len){
+  while (len > 0 && _state != STATE_ERROR) {
+    size_t n;
+    switch (_state) {
+      case STATE_HEADER:
+        n = min(len, (size_t)ESP32FW_BUNDLE_HEADER_SIZE - _headerLen);
+        memcpy(_header + _headerLen, data, n);
+        _headerLen += n;
+        if (_headerLen == ESP32FW_BUNDLE_HEADER_SIZE && parseHeader()) {
+          _headerLen = 0;
+          _state = STATE_MANIFEST;
+        }
+        break;
+      case STATE_MANIFEST:
+        n = min(len, (size_t)ESP32FW_BUNDLE_ENTRY_SIZE - _headerLen);
+        memcpy(_header + _headerLen, data, n);
+        _headerLen += n;
+        if (_headerLen == ESP32FW_BUNDLE_ENTRY_SIZE && parseEntry()) {
+          _headerLen = 0;
+          if (_parsed == _count) {
+            startSection();
+          }
+        }
+        break;
+      case STATE_DATA:
+        n = min(len, _left);
+        _sha.update(data, n);
+        if (!_output(data, n)) {
+          return fail("Failed to write section");
+        }
+        _left -= n;
+        if (_left == 0) {
+          const Section& section = _sections[_done];
+          uint8_t digest[ESP32FW_SHA256_SIZE];
+          _sha.finish(digest);
+          if (memcmp(digest, section.sha256, sizeof(digest)) != 0) {
+            return fail("Section hash mismatch");
+          }
+          if (!_onEnd(section)) {
+            return fail("Failed to finish section");
+          }
+          _done++;
+          startSection();
+        }
+        break;
+      case STATE_DONE:
+        return fail("Unexpected data after the last section");
+      default:
+        return false;
+    }
+    data += n;
+    len -= n;
+  }
+  return _state != STATE_ERROR;
+}
+
+bool ESP32FwBundleReader::finish(){
+  if (_state == STATE_ERROR) {
+    return false;
+  }
+  if (_state != STATE_DONE) {
+    return fail("Bundle is truncated");
+  }
+  return true;
+}
+
+void ESP32FwBundleReader::end(){
+  _running = false;
+  _onBegin = nullptr;
+  _output = nullptr;
+  _onEnd = nullptr;
+}
+
+bool ESP32FwBundleReader::parseHeader(){
+  if (memcmp(_header, ESP32FW_BUNDLE_MAGIC, 4) != 0) {
+    return fail("Not a bundle");
+  }
+  if (readLE32(_header + 4) != ESP32FW_BUNDLE_VERSION) {
+    return fail("Unsupported bundle version");
+  }
+  _count = readLE32(_header + 8);
+  if (_count == 0 || _count > ESP32FW_BUNDLE_MAX_SECTIONS) {
+    return fail("Unsupported number of bundle sections");
+  }
+  return true;
+}
+
+bool ESP32FwBundleReader::parseEntry(){
+  Section& section = _sections[_parsed];
+  section.type = readLE32(_header);
+  section.size = readLE32(_header + 4);
+  memcpy(section.sha256, _header + 8, sizeof(section.sha256));
+  if (section.type != ESP32FW_BUNDLE_FIRMWARE && section.type != ESP32FW_BUNDLE_FILESYSTEM) {
+    return fail("Unknown bundle section type");
+  }
+  if (section.size == 0) {
+    return fail("Empty bundle section");
+  }
+  for (size_t i = 0; i < _parsed; i++) {
+    if (_sections[i].type == section.type || section.type == ESP32FW_BUNDLE_FIRMWARE) {
+      return fail("Firmware must be the first section and each type appear once");
+    }
+  }
+  _parsed++;
+  return true;
+}
+
+bool ESP32FwBundleReader::startSection(){
+  if (_done == _count) {
+    _state = STATE_DONE;
+    return true;
+  }
+  const Section& section = _sections[_done];
+  _left = section.size;
+  _sha.begin();
+  _state = STATE_DATA;
+  if (!_onBegin(section)) {
+    return fail("Failed to begin section");
+  }
+  return true;
+}
+
+bool ESP32FwBundleReader::fail(const char* error){
+  if (_state != STATE_ERROR) {
+    _error = error;
+    _state = STATE_ERROR;
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef bundle_h
+#define bundle_h
+
+#include <Arduino.h>
+#include <functional>
+#include "digest.h"
+
+// Bundle format written by tools/make_bundle.py (all integers little endian):
+//
+//   header:   "EFWB" | version (u32) | section count (u32)
+//   manifest: per section: type (u32) | size (u32) | SHA-256 (32)
+//   data:     the section images, concatenated in manifest order
+//
+// Section types match ESP32Fw_Mode. Each type appears at most once and the
+// firmware section comes first: the file system is written in place, so it
+// is only touched once the firmware has been checked and written. A later
+// failure puts the running firmware back as the boot image.
+#define ESP32FW_BUNDLE_MAGIC "EFWB"
+#define ESP32FW_BUNDLE_VERSION 1
+#define ESP32FW_BUNDLE_HEADER_SIZE 12
+#define ESP32FW_BUNDLE_ENTRY_SIZE 40
+#define ESP32FW_BUNDLE_FIRMWARE 0
+#define ESP32FW_BUNDLE_FILESYSTEM 1
+#define ESP32FW_BUNDLE_MAX_SECTIONS 2
+
+// Splits a streamed bundle into its sections. Each section is announced to
+// the begin callback, its bytes go to the output callback as they arrive,
+// and the end callback runs once the section is complete and its hash has
+// been checked against the manifest.
+class ESP32FwBundleReader{
+  public:
+    struct Section {
+      uint32_t type;
+      uint32_t size;
+      uint8_t sha256[ESP32FW_SHA256_SIZE];
+    };
+    typedef std::function<bool(const Section& section)> Begin;
+    typedef std::function<bool(uint8_t* data, size_t len)> Output;
+    typedef std::function<bool(const Section& section)> End;
+
+    ESP32FwBundleReader();
+    bool begin(Begin onBegin, Output output, End onEnd);
+    bool write(uint8_t* data, size_t len);
+    bool finish();
+    void end();
+    bool isRunning() const { return _running; }
+    size_t sectionCount() const { return _count; }
+    size_t sectionsDone() const { return _done; }
+    const char* errorString() const { return _error; }
+
+  private:
+    enum State {
+      STATE_HEADER,
+      STATE_MANIFEST,
+      STATE_DATA,
+      STATE_DONE,
+      STATE_ERROR
+    };
+
+    bool _running = false;
+    Begin _onBegin;
+    Output _output;
+    End _onEnd;
+    State _state = STATE_HEADER;
+    uint8_t _header[ESP32FW_BUNDLE_ENTRY_SIZE];
+    size_t _headerLen = 0;
+    Section _sections[ESP32FW_BUNDLE_MAX_SECTIONS];
+    size_t _count = 0;
+    size_t _parsed = 0;
+    size_t _done = 0;
+    size_t _left = 0;
+    ESP32FwSha256 _sha;
+    const char* _error = nullptr;
+
+    bool parseHeader();
+    bool parseEntry();
+    bool startSection();
+    bool fail(const char* error);
+};
+
+#endif
@@ -0,0 +1,240 @@
+#include "delta_patch.h"
+#include "feature_flags.h"
+
+#if ESP32FW_FEATURE_DELTA
+
+#if defined(ESP32)
+  #include <esp_ota_ops.h>
+  #include <esp_partition.h>
+#endif
+
+static uint32_t readLE32(const uint8_t* p){
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+ESP32FwDeltaPatcher::ESP32FwDeltaPatcher(){}
+
+bool ESP32FwDeltaPatcher::begin(Output output, const uint8_t* sourceDigest, size_t sourceSize){
+  _running = true;
+  _output = output;
+  _knownSourceDigest = sourceDigest;
+  _knownSourceSize = sourceSize;
+  _sourceHashed = 0;
+  _sourceVerified = false;
+  _state = STATE_HEADER;
+  _headerLen = 0;
+  _sourceSize = 0;
+  _targetSize = 0;
+  _sourcePos = 0;
+  _produced = 0;
+  _diffLeft = 0;
+  _extraLeft = 0;
+  _seek = 0;
+  _error = nullptr;
+  _sha.begin();
+  return true;
+}
+
+bool ESP32FwDeltaPatcher::write(uint8_t* data, size_t len){
+  while (len > 0 && _state != STATE_ERROR) {
+    size_t n;
+    switch (_state) {
+      case STATE_HEADER:
+        n = min(len, (size_t)ESP32FW_DELTA_HEADER_SIZE - _headerLen);
+        memcpy(_header + _headerLen, data, n);
+        _headerLen += n;
+        if (_headerLen == ESP32FW_DELTA_HEADER_SIZE && parseHeader()) {
+          _headerLen = 0;
+          _state = STATE_RECORD;
+        }
+        break;
+      case STATE_RECORD:
+        if (_produced == _targetSize) {
+          return fail("Unexpected data after end of patch");
+        }
+        n = min(len, (size_t)ESP32FW_DELTA_RECORD_SIZE - _headerLen);
+        memcpy(_header + _headerLen, data, n);
+        _headerLen += n;
+        if (_headerLen == ESP32FW_DELTA_RECORD_SIZE) {
+          _headerLen = 0;
+          parseRecord();
+        }
+        break;
+      case STATE_DIFF:
+        // Patched byte = source byte + diff byte
+        n = min(len, min((size_t)_diffLeft, sizeof(_buffer)));
+        if (!readSource(_sourcePos, _buffer, n)) {
+          return false;
+        }
+        for (size_t i = 0; i < n; i++) {
+          _buffer[i] += data[i];
+        }
+        if (!emit(_buffer, n)) {
+          return false;
+        }
+        _sourcePos += n;
+        _diffLeft -= n;
+        if (_diffLeft == 0) {
+          _state = STATE_EXTRA;
+          parseRecord();
+        }
+        break;
+      case STATE_EXTRA:
+        n = min(len, (size_t)_extraLeft);
+        if (!emit(data, n)) {
+          return false;
+        }
+        _extraLeft -= n;
+        if (_extraLeft == 0) {
+          parseRecord();
+        }
+        break;
+      default:
+        return false;
+    }
+    data += n;
+    len -= n;
+  }
+  // Keep the source hash in step with the output, a bounded slice per call
+  if (_state != STATE_ERROR && _state != STATE_HEADER && !_sourceVerified && _targetSize > 0) {
+    hashSource((size_t)((uint64_t)_sourceSize * _produced / _targetSize));
+  }
+  return _state != STATE_ERROR;
+}
+
+bool ESP32FwDeltaPatcher::finish(){
+  if (_state == STATE_ERROR) {
+    return false;
+  }
+  if (_state != STATE_RECORD || _headerLen != 0 || _produced != _targetSize) {
+    return fail("Patch is truncated");
+  }
+  if (!_sourceVerified && !hashSource(_sourceSize)) {
+    return false;
+  }
+  uint8_t digest[ESP32FW_SHA256_SIZE];
+  _sha.finish(digest);
+  if (memcmp(digest, _targetHash, sizeof(digest)) != 0) {
+    return fail("Patched image hash mismatch");
+  }
+  return true;
+}
+
+void ESP32FwDeltaPatcher::end(){
+  _running = false;
+  _output = nullptr;
+}
+
+bool ESP32FwDeltaPatcher::parseHeader(){
+  if (memcmp(_header, ESP32FW_DELTA_MAGIC, 4) != 0) {
+    return fail("Not a delta patch");
+  }
+  if (readLE32(_header + 4) != ESP32FW_DELTA_VERSION) {
+    return fail("Unsupported delta patch version");
+  }
+  _sourceSize = readLE32(_header + 8);
+  _targetSize = readLE32(_header + 12);
+  memcpy(_targetHash, _header + 48, sizeof(_targetHash));
+  // The patch only makes sense against the exact image it was made from
+  memcpy(_sourceHash, _header + 16, sizeof(_sourceHash));
+  _sourceSha.begin();
+  if (_knownSourceDigest && _knownSourceSize == _sourceSize) {
+    _sourceHashed = _sourceSize;
+    return verifySource();
+  }
+  return hashSource(0);
+}
+
+// Moves to the next state once the current diff/extra run is exhausted,
+// reading a new record header when both are
+void ESP32FwDeltaPatcher::parseRecord(){
+  if (_state == STATE_RECORD) {
+    _diffLeft = readLE32(_header);
+    _extraLeft = readLE32(_header + 4);
+    _seek = (int32_t)readLE32(_header + 8);
+    if (_produced + _diffLeft + _extraLeft > _targetSize) {
+      fail("Patch produces more data than the target size");
+      return;
+    }
+    _state = STATE_DIFF;
+  }
+  if (_state == STATE_DIFF && _diffLeft > 0) {
+    return;
+  }
+  _state = STATE_EXTRA;
+  if (_extraLeft > 0) {
+    return;
+  }
+  // Record complete: move the source position
+  int64_t pos = (int64_t)_sourcePos + _seek;
+  if (pos < 0 || pos > (int64_t)_sourceSize) {
+    fail("Patch seeks outside the source image");
+    return;
+  }
+  _sourcePos = (size_t)pos;
+  _state = STATE_RECORD;
+}
+
+// Hashes the source image up to offset upTo, verifying it once all of it is in
+bool ESP32FwDeltaPatcher::hashSource(size_t upTo){
+  while (_sourceHashed < upTo) {
+    size_t n = min(sizeof(_buffer), upTo - _sourceHashed);
+    if (!readSource(_sourceHashed, _buffer, n)) {
+      return false;
+    }
+    _sourceSha.update(_buffer, n);
+    _sourceHashed += n;
+  }
+  return _sourceHashed < _sourceSize || _sourceVerified || verifySource();
+}
+
+bool ESP32FwDeltaPatcher::verifySource(){
+  uint8_t digest[ESP32FW_SHA256_SIZE];
+  if (_knownSourceDigest && _knownSourceSize == _sourceSize) {
+    memcpy(digest, _knownSourceDigest, sizeof(digest));
+  } else {
+    _sourceSha.finish(digest);
+  }
+  if (memcmp(digest, _sourceHash, sizeof(digest)) != 0) {
+    return fail("Patch was made for a different firmware than the one running");
+  }
+  _sourceVerified = true;
+  return true;
+}
+
+bool ESP32FwDeltaPatcher::readSource(size_t offset, uint8_t* data, size_t len){
+  if (offset + len > _sourceSize) {
+    return fail("Patch reads outside the source image");
+  }
+  #if defined(ESP32)
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    if (!running || offset + len > running->size || esp_partition_read(running, offset, data, len) != ESP_OK) {
+      return fail("Failed to read the running firmware");
+    }
+  #elif defined(ESP8266)
+    // The running sketch starts at the beginning of flash
+    if (!ESP.flashRead(offset, data, len)) {
+      return fail("Failed to read the running firmware");
+    }
+  #endif
+  return true;
+}
+
+bool ESP32FwDeltaPatcher::emit(uint8_t* data, size_t len){
+  _sha.update(data, len);
+  _produced += len;
+  if (!_output(data, len)) {
+    return fail("Failed to write patched data");
+  }
+  return true;
+}
+
+bool ESP32FwDeltaPatcher::fail(const char* error){
+  if (_state != STATE_ERROR) {
+    _error = error;
+    _state = STATE_ERROR;
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef delta_patch_h
+#define delta_patch_h
+
+#include <Arduino.h>
+#include <functional>
+#include "digest.h"
+
+// Patch format written by tools/make_delta.py (all integers little endian):
+//
+//   header:  "EFWD" | version (u32) | source size (u32) | target size (u32)
+//            | source SHA-256 (32) | target SHA-256 (32)
+//   records: diff length (u32) | extra length (u32) | seek (i32)
+//            | diff bytes, added to the source bytes at the current position
+//            | extra bytes, copied as is
+//            then the source position moves by seek
+#define ESP32FW_DELTA_MAGIC "EFWD"
+#define ESP32FW_DELTA_VERSION 1
+#define ESP32FW_DELTA_HEADER_SIZE 80
+#define ESP32FW_DELTA_RECORD_SIZE 12
+
+// Size of the buffer source bytes are read into while applying diff runs
+#ifndef ESP32FW_DELTA_BUFFER_SIZE
+  #define ESP32FW_DELTA_BUFFER_SIZE 256
+#endif
+
+// Applies a streamed binary patch against the running app image. The patched
+// image is produced in order through the output callback, so the only memory
+// needed is a small source read buffer. The source image is checked against
+// the patch header without stalling the upload: right away when its digest is
+// already known, otherwise hashed a slice per write() in step with the output,
+// so it is complete when the last byte is produced. finish() fails unless
+// both the source and the result match the header; nothing produced before
+// then is used until it passes.
+class ESP32FwDeltaPatcher{
+  public:
+    typedef std::function<bool(uint8_t* data, size_t len)> Output;
+
+    ESP32FwDeltaPatcher();
+    // sourceDigest: SHA-256 of the running image if known, over sourceSize bytes
+    bool begin(Output output, const uint8_t* sourceDigest = nullptr, size_t sourceSize = 0);
+    bool write(uint8_t* data, size_t len);
+    bool finish();
+    void end();
+    bool isRunning() const { return _running; }
+    size_t targetSize() const { return _targetSize; }
+    const char* errorString() const { return _error; }
+
+  private:
+    enum State {
+      STATE_HEADER,
+      STATE_RECORD,
+      STATE_DIFF,
+      STATE_EXTRA,
+      STATE_ERROR
+    };
+
+    bool _running = false;
+    Output _output;
+    State _state = STATE_HEADER;
+    uint8_t _header[ESP32FW_DELTA_HEADER_SIZE];
+    size_t _headerLen = 0;
+    size_t _sourceSize = 0;
+    size_t _targetSize = 0;
+    uint8_t _targetHash[ESP32FW_SHA256_SIZE];
+    uint8_t _sourceHash[ESP32FW_SHA256_SIZE];
+    const uint8_t* _knownSourceDigest = nullptr;
+    size_t _knownSourceSize = 0;
+    size_t _sourceHashed = 0;
+    bool _sourceVerified = false;
+    ESP32FwSha256 _sourceSha;
+    size_t _sourcePos = 0;
+    size_t _produced = 0;
+    uint32_t _diffLeft = 0;
+    uint32_t _extraLeft = 0;
+    int32_t _seek = 0;
+    uint8_t _buffer[ESP32FW_DELTA_BUFFER_SIZE];
+    ESP32FwSha256 _sha;
+    const char* _error = nullptr;
+
+    bool parseHeader();
+    void parseRecord();
+    bool hashSource(size_t upTo);
+    bool verifySource();
+    bool readSource(size_t offset, uint8_t* data, size_t len);
+    bool emit(uint8_t* data, size_t len);
+    bool fail(const char* error);
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "digest.h"
+
+ESP32FwSha256::ESP32FwSha256(){
+  #if defined(ESP32)
+    mbedtls_sha256_init(&_ctx);
+  #endif
+}
+
+ESP32FwSha256::~ESP32FwSha256(){
+  #if defined(ESP32)
+    mbedtls_sha256_free(&_ctx);
+  #endif
+}
+
+void ESP32FwSha256::begin(){
+  #if defined(ESP8266)
+    br_sha256_init(&_ctx);
+  #elif defined(ESP32)
+    #if MBEDTLS_VERSION_NUMBER >= 0x03000000
+      mbedtls_sha256_starts(&_ctx, 0);
+    #else
+      mbedtls_sha256_starts_ret(&_ctx, 0);
+    #endif
+  #endif
+}
+
+void ESP32FwSha256::update(const uint8_t* data, size_t len){
+  #if defined(ESP8266)
+    br_sha256_update(&_ctx, data, len);
+  #elif defined(ESP32)
+    #if MBEDTLS_VERSION_NUMBER >= 0x03000000
+      mbedtls_sha256_update(&_ctx, data, len);
+    #else
+      mbedtls_sha256_update_ret(&_ctx, data, len);
+    #endif
+  #endif
+}
+
+void ESP32FwSha256::finish(uint8_t digest[ESP32FW_SHA256_SIZE]){
+  #if defined(ESP8266)
+    br_sha256_out(&_ctx, digest);
+  #elif defined(ESP32)
+    #if MBEDTLS_VERSION_NUMBER >= 0x03000000
+      mbedtls_sha256_finish(&_ctx, digest);
+    #else
+      mbedtls_sha256_finish_ret(&_ctx, digest);
+    #endif
+  #endif
+}
+
+String digestToHex(const uint8_t* digest, size_t len){
+  static const char hexChars[] = "0123456789abcdef";
+  String hex;
+  hex.reserve(len * 2);
+  for (size_t i = 0; i < len; i++) {
+    hex += hexChars[digest[i] >> 4];
+    hex += hexChars[digest[i] & 0x0f];
+  }
+  return hex;
+}
+
+bool hexToDigest(const String& hex, uint8_t* digest, size_t len){
+  if (hex.length() != len * 2) {
+    return false;
+  }
+  for (size_t i = 0; i < len * 2; i++) {
+    char c = hex[i];
+    uint8_t nibble;
+    if (c >= '0' && c <= '9') {
+      nibble = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      nibble = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      nibble = c - 'A' + 10;
+    } else {
+      return false;
+    }
+    if (i % 2 == 0) {
+      digest[i / 2] = nibble << 4;
+    } else {
+      digest[i / 2] |= nibble;
+    }
+  }
+  return true;
+}
+
+void randomHex(char* hex, size_t len){
+  for (size_t i = 0; i < len; i += 8) {
+    #if defined(ESP8266)
+      uint32_t word = RANDOM_REG32;
+    #else
+      uint32_t word = esp_random();
+    #endif
+    char digits[9];
+    snprintf(digits, sizeof(digits), "%08x", word);
+    memcpy(hex + i, digits, min(len - i, (size_t)8));
+  }
+  hex[len] = '\0';
+}
@@ -0,0 +1,39 @@
+#ifndef digest_h
+#define digest_h
+
+#include <Arduino.h>
+
+#if defined(ESP8266)
+  #include <bearssl/bearssl_hash.h>
+#elif defined(ESP32)
+  #include <mbedtls/sha256.h>
+#endif
+
+#define ESP32FW_SHA256_SIZE 32
+
+// Incremental SHA-256 on the SDK's crypto library (hardware accelerated on ESP32)
+class ESP32FwSha256{
+  public:
+    ESP32FwSha256();
+    ~ESP32FwSha256();
+    void begin();
+    void update(const uint8_t* data, size_t len);
+    void finish(uint8_t digest[ESP32FW_SHA256_SIZE]);
+
+  private:
+#if defined(ESP8266)
+    br_sha256_context _ctx;
+#elif defined(ESP32)
+    mbedtls_sha256_context _ctx;
+#endif
+};
+
+// Hex helpers for digests passed through the HTTP API
+String digestToHex(const uint8_t* digest, size_t len);
+bool hexToDigest(const String& hex, uint8_t* digest, size_t len);
+
+// len random hex digits from the hardware random number generator, for
+// tokens and nonces; hex must hold len + 1 chars
+void randomHex(char* hex, size_t len);
+
+#endif
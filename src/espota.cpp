@@ -0,0 +1,113 @@
+#include "espota.h"
+#include "digest.h"
+#include "feature_flags.h"
+#include <MD5Builder.h>
+
+#if ESP32FW_FEATURE_ESPOTA
+
+static String md5Hex(const String& text){
+  MD5Builder md5;
+  md5.begin();
+  md5.add(text);
+  md5.calculate();
+  return md5.toString();
+}
+
+ESP32FwEspOta::ESP32FwEspOta(){}
+
+bool ESP32FwEspOta::begin(uint16_t port){
+  end();
+  _running = _udp.begin(port) == 1;
+  return _running;
+}
+
+void ESP32FwEspOta::end(){
+  if (_running) {
+    _udp.stop();
+  }
+  _running = false;
+  _challenged = false;
+}
+
+void ESP32FwEspOta::setPassword(const String& password){
+  // Only the MD5 of the password takes part in the challenge
+  _passwordMd5 = password.length() > 0 ? md5Hex(password) : String();
+}
+
+ESP32FwEspOta::Result ESP32FwEspOta::poll(){
+  if (!_running) {
+    return RESULT_NONE;
+  }
+  if (_challenged && millis() - _challengeTime > ESP32FW_ESPOTA_TIMEOUT_MS) {
+    _challenged = false;
+  }
+  if (_udp.parsePacket() <= 0) {
+    return RESULT_NONE;
+  }
+  char packet[ESP32FW_ESPOTA_PACKET_SIZE];
+  int len = _udp.read(packet, sizeof(packet) - 1);
+  if (len <= 0) {
+    return RESULT_NONE;
+  }
+  packet[len] = '\0';
+
+  if (atoi(packet) == CMD_AUTH) {
+    return authenticate(packet);
+  }
+  return invite(packet);
+}
+
+void ESP32FwEspOta::reply(const char* message){
+  _udp.beginPacket(_invitation.host, _udp.remotePort());
+  _udp.print(message);
+  _udp.endPacket();
+}
+
+ESP32FwEspOta::Result ESP32FwEspOta::invite(char* packet){
+  int command;
+  unsigned port;
+  unsigned long size;
+  char md5[33];
+  if (sscanf(packet, "%d %u %lu %32s", &command, &port, &size, md5) != 4 ||
+      (command != CMD_FLASH && command != CMD_FILESYSTEM) || port == 0 || port > 0xFFFF || strlen(md5) != 32) {
+    return RESULT_NONE;
+  }
+  _invitation.command = (Command)command;
+  _invitation.host = _udp.remoteIP();
+  _invitation.port = port;
+  _invitation.size = size;
+  _invitation.md5 = md5;
+
+  if (_passwordMd5.length() == 0) {
+    _challenged = false;
+    return RESULT_INVITED;
+  }
+  // The tool resends its invitation until it is answered; each one gets a
+  // fresh challenge
+  randomHex(_nonce, 32);
+  _challenged = true;
+  _challengeTime = millis();
+  String challenge = "AUTH ";
+  challenge += _nonce;
+  reply(challenge.c_str());
+  return RESULT_NONE;
+}
+
+ESP32FwEspOta::Result ESP32FwEspOta::authenticate(char* packet){
+  int command;
+  char cnonce[33];
+  char response[33];
+  if (!_challenged || _udp.remoteIP() != _invitation.host ||
+      sscanf(packet, "%d %32s %32s", &command, cnonce, response) != 3) {
+    return RESULT_NONE;
+  }
+  _challenged = false;
+  String expected = md5Hex(_passwordMd5 + ":" + _nonce + ":" + cnonce);
+  if (!expected.equalsIgnoreCase(response)) {
+    reply("Authentication Failed");
+    return RESULT_AUTH_FAILED;
+  }
+  return RESULT_INVITED;
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef espota_h
+#define espota_h
+
+#include <Arduino.h>
+#if defined(ESP8266)
+  #include <ESP8266WiFi.h>
+#elif defined(ESP32)
+  #include <WiFi.h>
+#endif
+#include <WiFiUdp.h>
+
+// UDP port espota.py sends its invitation to unless told otherwise
+#if defined(ESP8266)
+  #define ESP32FW_ESPOTA_PORT 8266
+#else
+  #define ESP32FW_ESPOTA_PORT 3232
+#endif
+
+// How long an invitation waits for the answer to its authentication
+// challenge, and for image data once the transfer has started
+#ifndef ESP32FW_ESPOTA_TIMEOUT_MS
+  #define ESP32FW_ESPOTA_TIMEOUT_MS 10000
+#endif
+
+// Longest invitation or authentication packet
+#define ESP32FW_ESPOTA_PACKET_SIZE 128
+
+// Listener for the protocol of espota.py, the tool behind the Arduino IDE's
+// network ports and PlatformIO's upload_protocol = espota. The tool sends
+// an invitation over UDP naming the image kind, its size, its MD5 and a TCP
+// port on the host. With a password set the device answers with a nonce and
+// the tool proves it knows the password by an MD5 challenge-response. Once
+// the invitation is accepted the device connects back to the host and reads
+// the image, acknowledging each piece with the number of bytes received and
+// the end with "OK".
+class ESP32FwEspOta{
+  public:
+    enum Command {
+      CMD_FLASH = 0,
+      CMD_FILESYSTEM = 100,
+      CMD_AUTH = 200
+    };
+    enum Result {
+      RESULT_NONE,
+      RESULT_INVITED,                // invitation() is waiting for reply()
+      RESULT_AUTH_FAILED
+    };
+    struct Invitation {
+      Command command = CMD_FLASH;
+      IPAddress host;
+      uint16_t port = 0;
+      size_t size = 0;
+      String md5;
+    };
+
+    ESP32FwEspOta();
+    bool begin(uint16_t port);
+    void end();
+    bool isRunning() const { return _running; }
+    // Empty to accept invitations without authentication
+    void setPassword(const String& password);
+    // Handles the next packet, if any; call from loop()
+    Result poll();
+    const Invitation& invitation() const { return _invitation; }
+    // Answers the invitation: "OK" to start the transfer or an error
+    void reply(const char* message);
+
+  private:
+    WiFiUDP _udp;
+    bool _running = false;
+    String _passwordMd5;
+    Invitation _invitation;
+    bool _challenged = false;
+    unsigned long _challengeTime = 0;
+    char _nonce[33];
+
+    Result invite(char* packet);
+    Result authenticate(char* packet);
+};
+
+#endif
@@ -0,0 +1,195 @@
+#include "events.h"
+
+#if ESP32FW_FEATURE_EVENT_LOG
+
+// Messages are printf formats for the two numeric arguments; attached text
+// is appended after a colon
+static const char fmtInit[] PROGMEM = "ESP32FwUploader library initialized";
+static const char fmtWebUI[] PROGMEM = "Serving OTA web interface";
+static const char fmtUploadStart[] PROGMEM = "Update started: mode %u, %u bytes announced";
+static const char fmtFirstChunk[] PROGMEM = "First chunk received: %u bytes";
+static const char fmtImageAccepted[] PROGMEM = "Image header checked, writing as mode %u";
+static const char fmtProgress[] PROGMEM = "Upload progress: %u of %u bytes";
+static const char fmtUploadWritten[] PROGMEM = "Update written: %u bytes";
+static const char fmtUpdateSuccess[] PROGMEM = "Update completed successfully";
+static const char fmtUpToDate[] PROGMEM = "Device already runs the offered image: mode %u, nothing written";
+static const char fmtSessionStart[] PROGMEM = "Upload session %u started: %u bytes";
+static const char fmtFilesStart[] PROGMEM = "File sync started";
+static const char fmtFilesCompared[] PROGMEM = "Manifest compared: %u files to send, %u to delete";
+static const char fmtFileWritten[] PROGMEM = "File written: %u bytes";
+static const char fmtFilesDone[] PROGMEM = "File sync complete: %u written, %u deleted";
+static const char fmtPullStart[] PROGMEM = "Pulling update";
+static const char fmtPullSize[] PROGMEM = "Downloading %u bytes";
+static const char fmtPullDone[] PROGMEM = "Downloaded %u bytes";
+static const char fmtEspOtaStart[] PROGMEM = "espota invitation accepted: mode %u, %u bytes";
+static const char fmtPayloadDigest[] PROGMEM = "Payload SHA-256";
+static const char fmtSignatureVerified[] PROGMEM = "Image signature verified";
+static const char fmtInflateStart[] PROGMEM = "Inflating compressed upload";
+static const char fmtInflated[] PROGMEM = "Inflated %u bytes";
+static const char fmtGzipPassthrough[] PROGMEM = "Writing gzip firmware for the bootloader to unpack";
+static const char fmtDeltaStart[] PROGMEM = "Applying delta patch against the running firmware";
+static const char fmtDeltaApplied[] PROGMEM = "Delta patch applied: %u bytes, hash verified";
+static const char fmtBundleStart[] PROGMEM = "Unpacking bundle";
+static const char fmtBundleSectionDone[] PROGMEM = "Bundle section written: mode %u, %u bytes";
+static const char fmtPipelineStart[] PROGMEM = "Pipelined flash writes enabled";
+static const char fmtSectorsSkipped[] PROGMEM = "Unchanged sectors skipped: %u of %u";
+static const char fmtSectorsPreErased[] PROGMEM = "Sectors erased ahead of the upload: %u of %u";
+static const char fmtRebootScheduled[] PROGMEM = "Scheduling reboot in %u ms";
+static const char fmtRebooting[] PROGMEM = "Rebooting device...";
+static const char fmtAuth[] PROGMEM = "Authentication";
+static const char fmtAutoReboot[] PROGMEM = "Auto reboot";
+static const char fmtDebug[] PROGMEM = "Debug logging";
+static const char fmtDarkMode[] PROGMEM = "Dark mode";
+static const char fmtPipelined[] PROGMEM = "Pipelined writes";
+static const char fmtBlockSize[] PROGMEM = "Write block size: %u bytes";
+static const char fmtSigning[] PROGMEM = "Signed images";
+static const char fmtSkipUnchanged[] PROGMEM = "Skip unchanged sectors";
+static const char fmtPreErase[] PROGMEM = "Pre-erase";
+static const char fmtFileSync[] PROGMEM = "File sync";
+static const char fmtEspOta[] PROGMEM = "espota listener on port %u";
+static const char fmtSkipUpToDate[] PROGMEM = "Skip up-to-date images";
+static const char fmtPipelineFallback[] PROGMEM = "Failed to start write pipeline, writing synchronously";
+static const char fmtBlockFallback[] PROGMEM = "Failed to allocate write block buffer, writing chunks as received";
+static const char fmtPullRetry[] PROGMEM = "Connection lost at byte %u, retry %u";
+static const char fmtBundleFirmwareKept[] PROGMEM = "Bundle failed after its firmware section, the running firmware stays bootable";
+static const char fmtFileFailed[] PROGMEM = "File not written, the sync waits for it to be sent again";
+static const char fmtUploadAborted[] PROGMEM = "Upload aborted";
+static const char fmtUploadRejected[] PROGMEM = "Update from source %u rejected, source %u is in progress";
+static const char fmtAuthRejected[] PROGMEM = "Upload from source %u refused before any data was read: authentication failed";
+static const char fmtError[] PROGMEM = "Error %u";
+
+static const char* const formats[] PROGMEM = {
+  fmtInit, fmtWebUI, fmtUploadStart, fmtFirstChunk, fmtImageAccepted, fmtProgress, fmtUploadWritten,
+  fmtUpdateSuccess, fmtUpToDate, fmtSessionStart, fmtFilesStart, fmtFilesCompared, fmtFileWritten,
+  fmtFilesDone, fmtPullStart, fmtPullSize,
+  fmtPullDone, fmtEspOtaStart, fmtPayloadDigest, fmtSignatureVerified, fmtInflateStart, fmtInflated,
+  fmtGzipPassthrough, fmtDeltaStart, fmtDeltaApplied, fmtBundleStart,
+  fmtBundleSectionDone, fmtPipelineStart, fmtSectorsSkipped, fmtSectorsPreErased,
+  fmtRebootScheduled, fmtRebooting, fmtAuth, fmtAutoReboot, fmtDebug, fmtDarkMode,
+  fmtPipelined, fmtBlockSize, fmtSigning, fmtSkipUnchanged, fmtPreErase, fmtFileSync, fmtEspOta, fmtSkipUpToDate, fmtPipelineFallback, fmtBlockFallback,
+  fmtPullRetry, fmtBundleFirmwareKept, fmtFileFailed, fmtUploadAborted, fmtUploadRejected, fmtAuthRejected, fmtError
+};
+static_assert(sizeof(formats) / sizeof(formats[0]) == ESP32FW_EVENT_COUNT, "one format per event");
+
+// Longest formatted message: format output plus ": " and the text
+#define EVENT_MESSAGE_SIZE (ESP32FW_EVENT_TEXT_MAX + 64)
+
+ESP32FwEventLog::ESP32FwEventLog(){}
+
+void ESP32FwEventLog::record(ESP32Fw_Event event, uint32_t a, uint32_t b, const char* text){
+  Header header;
+  header.time = millis();
+  header.event = event;
+  header.textLen = text ? strnlen(text, ESP32FW_EVENT_TEXT_MAX) : 0;
+  header.a = a;
+  header.b = b;
+  size_t size = sizeof(header) + header.textLen;
+
+  // Make room by dropping the oldest records
+  while (_used + size > sizeof(_buffer)) {
+    Header oldest;
+    get(_tail, &oldest, sizeof(oldest));
+    size_t oldestSize = sizeof(oldest) + oldest.textLen;
+    _tail = (_tail + oldestSize) % sizeof(_buffer);
+    _used -= oldestSize;
+    _count--;
+    if (_undrained > _count) {
+      _undrained = _count;
+      _dropped++;
+    }
+  }
+
+  size_t head = (_tail + _used) % sizeof(_buffer);
+  put(head, &header, sizeof(header));
+  put((head + sizeof(header)) % sizeof(_buffer), text, header.textLen);
+  _used += size;
+  _count++;
+  _undrained++;
+}
+
+void ESP32FwEventLog::drain(Print& out){
+  if (_undrained == 0) {
+    return;
+  }
+  if (_dropped > 0) {
+    out.printf("[ESP32FwUploader] %u events dropped\n", (unsigned)_dropped);
+    _dropped = 0;
+  }
+  char message[EVENT_MESSAGE_SIZE];
+  size_t offset = skip(_tail, _count - _undrained);
+  while (_undrained > 0) {
+    Header header;
+    offset = format(offset, header, message, sizeof(message));
+    out.print(header.event >= ESP32FW_EVENT_FIRST_ERROR ? "[ESP32FwUploader ERROR] " : "[ESP32FwUploader] ");
+    out.println(message);
+    _undrained--;
+  }
+}
+
+String ESP32FwEventLog::toJSON() const{
+  String json;
+  json.reserve(_used + _count * 48 + 32);
+  json += "[";
+  char message[EVENT_MESSAGE_SIZE];
+  size_t offset = _tail;
+  for (size_t i = 0; i < _count; i++) {
+    Header header;
+    offset = format(offset, header, message, sizeof(message));
+    json += i > 0 ? ",{\"time\":" : "{\"time\":";
+    json += String(header.time) + ",\"event\":" + String(header.event) + ",\"level\":\"";
+    json += header.event >= ESP32FW_EVENT_FIRST_ERROR ? "error" : "info";
+    json += "\",\"message\":\"";
+    for (const char* p = message; *p; p++) {
+      if (*p == '"' || *p == '\\') {
+        json += '\\';
+        json += *p;
+      } else if ((uint8_t)*p >= 0x20) {
+        json += *p;
+      }
+    }
+    json += "\"}";
+  }
+  json += "]";
+  return json;
+}
+
+void ESP32FwEventLog::put(size_t offset, const void* data, size_t len){
+  const uint8_t* src = (const uint8_t*)data;
+  size_t first = min(len, sizeof(_buffer) - offset);
+  memcpy(_buffer + offset, src, first);
+  memcpy(_buffer, src + first, len - first);
+}
+
+void ESP32FwEventLog::get(size_t offset, void* data, size_t len) const{
+  uint8_t* dst = (uint8_t*)data;
+  size_t first = min(len, sizeof(_buffer) - offset);
+  memcpy(dst, _buffer + offset, first);
+  memcpy(dst + first, _buffer, len - first);
+}
+
+size_t ESP32FwEventLog::skip(size_t offset, size_t records) const{
+  while (records-- > 0) {
+    Header header;
+    get(offset, &header, sizeof(header));
+    offset = (offset + sizeof(header) + header.textLen) % sizeof(_buffer);
+  }
+  return offset;
+}
+
+// Formats the record at offset into out and returns the offset of the next one
+size_t ESP32FwEventLog::format(size_t offset, Header& header, char* out, size_t size) const{
+  get(offset, &header, sizeof(header));
+  const char* fmt = (const char*)pgm_read_ptr(&formats[header.event]);
+  int len = snprintf_P(out, size, fmt, (unsigned)header.a, (unsigned)header.b);
+  len = constrain(len, 0, (int)size - 1);
+  if (header.textLen > 0 && (size_t)len + 2 + header.textLen < size) {
+    out[len++] = ':';
+    out[len++] = ' ';
+    get((offset + sizeof(header)) % sizeof(_buffer), out + len, header.textLen);
+    len += header.textLen;
+    out[len] = '\0';
+  }
+  return (offset + sizeof(header) + header.textLen) % sizeof(_buffer);
+}
+
+#endif
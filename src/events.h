@@ -0,0 +1,129 @@
+#ifndef events_h
+#define events_h
+
+#include <Arduino.h>
+#include "feature_flags.h"
+
+// Bytes reserved for the event ring; the oldest events are overwritten
+#ifndef ESP32FW_EVENT_BUFFER_SIZE
+  #define ESP32FW_EVENT_BUFFER_SIZE 1024
+#endif
+
+// Longest text attached to an event (error messages, digests)
+#define ESP32FW_EVENT_TEXT_MAX 96
+
+// Upload progress is recorded each time this many more bytes have arrived
+#ifndef ESP32FW_PROGRESS_EVENT_BYTES
+  #define ESP32FW_PROGRESS_EVENT_BYTES 65536
+#endif
+
+// Event ids index the format table in events.cpp; keep both in the same order
+enum ESP32Fw_Event : uint8_t {
+    ESP32FW_EVENT_INIT = 0,
+    ESP32FW_EVENT_WEB_UI,
+    ESP32FW_EVENT_UPLOAD_START,
+    ESP32FW_EVENT_FIRST_CHUNK,
+    ESP32FW_EVENT_IMAGE_ACCEPTED,
+    ESP32FW_EVENT_PROGRESS,
+    ESP32FW_EVENT_UPLOAD_WRITTEN,
+    ESP32FW_EVENT_UPDATE_SUCCESS,
+    ESP32FW_EVENT_UP_TO_DATE,
+    ESP32FW_EVENT_SESSION_START,
+    ESP32FW_EVENT_FILES_START,
+    ESP32FW_EVENT_FILES_COMPARED,
+    ESP32FW_EVENT_FILE_WRITTEN,
+    ESP32FW_EVENT_FILES_DONE,
+    ESP32FW_EVENT_PULL_START,
+    ESP32FW_EVENT_PULL_SIZE,
+    ESP32FW_EVENT_PULL_DONE,
+    ESP32FW_EVENT_ESPOTA_START,
+    ESP32FW_EVENT_PAYLOAD_DIGEST,
+    ESP32FW_EVENT_SIGNATURE_VERIFIED,
+    ESP32FW_EVENT_INFLATE_START,
+    ESP32FW_EVENT_INFLATED,
+    ESP32FW_EVENT_GZIP_PASSTHROUGH,
+    ESP32FW_EVENT_DELTA_START,
+    ESP32FW_EVENT_DELTA_APPLIED,
+    ESP32FW_EVENT_BUNDLE_START,
+    ESP32FW_EVENT_BUNDLE_SECTION_DONE,
+    ESP32FW_EVENT_PIPELINE_START,
+    ESP32FW_EVENT_SECTORS_SKIPPED,
+    ESP32FW_EVENT_SECTORS_PRE_ERASED,
+    ESP32FW_EVENT_REBOOT_SCHEDULED,
+    ESP32FW_EVENT_REBOOTING,
+    ESP32FW_EVENT_AUTH,
+    ESP32FW_EVENT_AUTO_REBOOT,
+    ESP32FW_EVENT_DEBUG,
+    ESP32FW_EVENT_DARK_MODE,
+    ESP32FW_EVENT_PIPELINED,
+    ESP32FW_EVENT_BLOCK_SIZE,
+    ESP32FW_EVENT_SIGNING,
+    ESP32FW_EVENT_SKIP_UNCHANGED,
+    ESP32FW_EVENT_PRE_ERASE,
+    ESP32FW_EVENT_FILE_SYNC,
+    ESP32FW_EVENT_ESPOTA,
+    ESP32FW_EVENT_SKIP_UP_TO_DATE,
+    // Warnings and errors from here on
+    ESP32FW_EVENT_PIPELINE_FALLBACK,
+    ESP32FW_EVENT_BLOCK_FALLBACK,
+    ESP32FW_EVENT_PULL_RETRY,
+    ESP32FW_EVENT_BUNDLE_FIRMWARE_KEPT,
+    ESP32FW_EVENT_FILE_FAILED,
+    ESP32FW_EVENT_UPLOAD_ABORTED,
+    ESP32FW_EVENT_UPLOAD_REJECTED,
+    ESP32FW_EVENT_AUTH_REJECTED,
+    ESP32FW_EVENT_ERROR,
+    ESP32FW_EVENT_COUNT
+};
+
+#define ESP32FW_EVENT_FIRST_ERROR ESP32FW_EVENT_PIPELINE_FALLBACK
+
+#if ESP32FW_FEATURE_EVENT_LOG
+
+// Fixed-size binary log. record() copies an event id, two numeric arguments
+// and optional text into a byte ring; nothing is formatted and nothing is
+// allocated until the events are read. drain() prints the events recorded
+// since the last drain, toJSON() dumps everything still in the ring.
+class ESP32FwEventLog{
+  public:
+    ESP32FwEventLog();
+    void record(ESP32Fw_Event event, uint32_t a = 0, uint32_t b = 0, const char* text = nullptr);
+    void drain(Print& out);
+    String toJSON() const;
+
+  private:
+    // Record layout: time (u32) | event (u8) | text length (u8) | a (u32) | b (u32) | text
+    struct Header {
+      uint32_t time;
+      uint8_t event;
+      uint8_t textLen;
+      uint32_t a;
+      uint32_t b;
+    } __attribute__((packed));
+
+    uint8_t _buffer[ESP32FW_EVENT_BUFFER_SIZE];
+    size_t _tail = 0;
+    size_t _used = 0;
+    size_t _count = 0;
+    size_t _undrained = 0;
+    uint32_t _dropped = 0;
+
+    void put(size_t offset, const void* data, size_t len);
+    void get(size_t offset, void* data, size_t len) const;
+    size_t skip(size_t offset, size_t records) const;
+    size_t format(size_t offset, Header& header, char* out, size_t size) const;
+};
+
+#else
+
+// Built without the event log: same interface, records nothing
+class ESP32FwEventLog{
+  public:
+    void record(ESP32Fw_Event event, uint32_t a = 0, uint32_t b = 0, const char* text = nullptr) {}
+    void drain(Print& out) {}
+    String toJSON() const { return "[]"; }
+};
+
+#endif
+
+#endif
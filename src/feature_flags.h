@@ -0,0 +1,64 @@
+#ifndef feature_flags_h
+#define feature_flags_h
+
+// Compile-time feature switches. Each one is on by default; building with
+// -D ESP32FW_FEATURE_<NAME>=0 leaves the feature, its endpoints, its API and
+// the code it pulls in out of the binary. The flag has to reach the
+// library's own sources, so set it in the build flags (PlatformIO
+// build_flags, or compiler.cpp.extra_flags with arduino-cli) rather than
+// with a #define in the sketch. tools/size_report measures what each
+// feature costs.
+
+// Web interface at /update: setDarkMode() and both pre-built pages
+#ifndef ESP32FW_FEATURE_WEB_UI
+  #define ESP32FW_FEATURE_WEB_UI 1
+#endif
+
+// HTTP Basic authentication: setAuth(), clearAuth() and upload tokens
+#ifndef ESP32FW_FEATURE_AUTH
+  #define ESP32FW_FEATURE_AUTH 1
+#endif
+
+// Event log: setDebug(), /ota/events and the event ring buffer
+#ifndef ESP32FW_FEATURE_EVENT_LOG
+  #define ESP32FW_FEATURE_EVENT_LOG 1
+#endif
+
+// onStart(), onProgress(), onEnd() and onError()
+#ifndef ESP32FW_FEATURE_CALLBACKS
+  #define ESP32FW_FEATURE_CALLBACKS 1
+#endif
+
+// File system images, per-file sync (setFileSystem(), /ota/fs/*) and
+// bundles; without it only firmware is updated
+#ifndef ESP32FW_FEATURE_FILESYSTEM
+  #define ESP32FW_FEATURE_FILESYSTEM 1
+#endif
+
+// Pull updates: updateFromURL() and /ota/pull
+#ifndef ESP32FW_FEATURE_PULL
+  #define ESP32FW_FEATURE_PULL 1
+#endif
+
+// espota.py listener: setEspOta()
+#ifndef ESP32FW_FEATURE_ESPOTA
+  #define ESP32FW_FEATURE_ESPOTA 1
+#endif
+
+// Signed images: setSigningKey() and the ECDSA check
+#ifndef ESP32FW_FEATURE_SIGNING
+  #define ESP32FW_FEATURE_SIGNING 1
+#endif
+
+// Compressed images: gzip/deflate inflated on ESP32, gzip firmware passed
+// to the bootloader on ESP8266; without it they are refused
+#ifndef ESP32FW_FEATURE_COMPRESSION
+  #define ESP32FW_FEATURE_COMPRESSION 1
+#endif
+
+// Delta patches against the running firmware; without it they are refused
+#ifndef ESP32FW_FEATURE_DELTA
+  #define ESP32FW_FEATURE_DELTA 1
+#endif
+
+#endif
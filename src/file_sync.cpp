@@ -0,0 +1,309 @@
+#include "file_sync.h"
+#include "feature_flags.h"
+
+#if ESP32FW_FEATURE_FILESYSTEM
+
+// Size of the buffer files are read through when they are hashed
+#define FILE_HASH_BUFFER_SIZE 256
+
+// Directory entries are reported as a full path by some file systems and
+// core versions and as a bare name by others
+static String joinPath(const String& dir, const String& name){
+  if (name.startsWith("/")) {
+    return name;
+  }
+  return dir.endsWith("/") ? dir + name : dir + "/" + name;
+}
+
+ESP32FwFileSync::ESP32FwFileSync(){}
+
+ESP32FwFileSync::~ESP32FwFileSync(){
+  end();
+}
+
+void ESP32FwFileSync::beginManifest(bool deleteUnlisted){
+  end();
+  _deleteUnlisted = deleteUnlisted;
+  _written = 0;
+  _removed = 0;
+  _error = nullptr;
+}
+
+bool ESP32FwFileSync::writeManifest(const uint8_t* data, size_t len){
+  for (size_t i = 0; i < len && !_error; i++) {
+    char c = (char)data[i];
+    if (c == '\n') {
+      _line[_lineLen] = '\0';
+      parseLine();
+      _lineLen = 0;
+    } else if (c != '\r') {
+      if (_lineLen == sizeof(_line) - 1) {
+        return fail("Manifest line too long");
+      }
+      _line[_lineLen++] = c;
+    }
+  }
+  return !_error;
+}
+
+bool ESP32FwFileSync::finishManifest(){
+  // The last line need not end with a newline
+  if (!_error && _lineLen > 0) {
+    _line[_lineLen] = '\0';
+    parseLine();
+    _lineLen = 0;
+  }
+  if (_error) {
+    return false;
+  }
+
+  // Walk the file system once: listed files are compared, the rest
+  // deleted if asked to
+  _unchanged.assign(_pending.size(), false);
+  listFiles("/");
+  size_t kept = 0;
+  for (size_t i = 0; i < _pending.size(); i++) {
+    if (!_unchanged[i]) {
+      if (kept != i) {
+        _pending[kept] = _pending[i];
+      }
+      kept++;
+    }
+  }
+  _pending.resize(kept);
+  std::vector<bool>().swap(_unchanged);
+  return true;
+}
+
+bool ESP32FwFileSync::beginFile(const String& path){
+  if (_fileEntry >= 0) {
+    return fail("Another file is being received");
+  }
+  int entry = findEntry(path);
+  if (entry < 0) {
+    return fail("File is not pending in this sync");
+  }
+  _file = _fs->open(ESP32FW_FILE_SYNC_TEMP, "w");
+  if (!_file) {
+    return fail("Failed to create file");
+  }
+  _fileEntry = entry;
+  _sha.begin();
+  return true;
+}
+
+bool ESP32FwFileSync::writeFile(const uint8_t* data, size_t len){
+  if (_fileEntry < 0) {
+    return false;
+  }
+  _sha.update(data, len);
+  if (_file.write(data, len) != len) {
+    closeFile();
+    return fail("Failed to write file, file system full?");
+  }
+  return true;
+}
+
+bool ESP32FwFileSync::finishFile(){
+  if (_fileEntry < 0) {
+    return false;
+  }
+  uint8_t digest[ESP32FW_SHA256_SIZE];
+  _sha.finish(digest);
+  if (memcmp(digest, _pending[_fileEntry].sha256, sizeof(digest)) != 0) {
+    closeFile();
+    return fail("File does not match its manifest hash");
+  }
+  _file.close();
+  const String& path = _pending[_fileEntry].path;
+  makeParentDirs(path);
+  if (!moveIntoPlace(path)) {
+    // The old file is still in place; the checked copy is kept until the
+    // next file is received
+    _fileEntry = -1;
+    return fail("Failed to move file into place");
+  }
+  _pending.erase(_pending.begin() + _fileEntry);
+  _fileEntry = -1;
+  _written++;
+  return true;
+}
+
+// Forgets the file being received and its error; the file stays pending
+// and the sync goes on
+void ESP32FwFileSync::dropFile(){
+  closeFile();
+  _error = nullptr;
+}
+
+bool ESP32FwFileSync::apply(){
+  if (!_pending.empty()) {
+    return fail("Files are still pending");
+  }
+  for (const String& path : _deleted) {
+    if (_fs->remove(path)) {
+      _removed++;
+    }
+  }
+  std::vector<String>().swap(_deleted);
+  return true;
+}
+
+void ESP32FwFileSync::end(){
+  closeFile();
+  std::vector<Entry>().swap(_pending);
+  std::vector<String>().swap(_deleted);
+  std::vector<bool>().swap(_unchanged);
+  _lineLen = 0;
+}
+
+bool ESP32FwFileSync::parseLine(){
+  if (_lineLen == 0) {
+    return true;
+  }
+  // "<64 hex digits> <path>"
+  const size_t hexLen = ESP32FW_SHA256_SIZE * 2;
+  if (_lineLen < hexLen + 2 || _line[hexLen] != ' ' || _line[hexLen + 1] != '/') {
+    return fail("Malformed manifest line");
+  }
+  const char* path = _line + hexLen + 1;
+  for (const char* p = path; *p; p++) {
+    // Paths are echoed back in JSON unescaped
+    if ((uint8_t)*p < 0x20 || *p == '"' || *p == '\\') {
+      return fail("Unsupported character in manifest path");
+    }
+  }
+  if (_pending.size() == ESP32FW_FILE_SYNC_MAX_FILES) {
+    return fail("Too many files in manifest");
+  }
+  Entry entry;
+  entry.path = path;
+  _line[hexLen] = '\0';
+  if (!hexToDigest(String(_line), entry.sha256, sizeof(entry.sha256))) {
+    return fail("Malformed hash in manifest");
+  }
+  if (findEntry(entry.path) >= 0) {
+    return fail("Duplicate path in manifest");
+  }
+  _pending.push_back(entry);
+  return true;
+}
+
+int ESP32FwFileSync::findEntry(const String& path) const{
+  for (size_t i = 0; i < _pending.size(); i++) {
+    if (_pending[i].path == path) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool ESP32FwFileSync::fileMatches(const String& path, const uint8_t* sha256){
+  File file = _fs->open(path, "r");
+  if (!file) {
+    return false;
+  }
+  ESP32FwSha256 sha;
+  sha.begin();
+  uint8_t buffer[FILE_HASH_BUFFER_SIZE];
+  size_t n;
+  while ((n = file.read(buffer, sizeof(buffer))) > 0) {
+    sha.update(buffer, n);
+  }
+  file.close();
+  uint8_t digest[ESP32FW_SHA256_SIZE];
+  sha.finish(digest);
+  return memcmp(digest, sha256, sizeof(digest)) == 0;
+}
+
+void ESP32FwFileSync::listFiles(const String& dir){
+  #if defined(ESP8266)
+    Dir entries = _fs->openDir(dir);
+    while (entries.next()) {
+      String path = joinPath(dir, entries.fileName());
+      if (entries.isDirectory()) {
+        listFiles(path);
+      } else {
+        visitFile(path);
+      }
+    }
+  #else
+    File root = _fs->open(dir, "r");
+    if (!root || !root.isDirectory()) {
+      return;
+    }
+    for (File file = root.openNextFile(); file; file = root.openNextFile()) {
+      #if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 2
+        String path = file.path();
+      #else
+        String path = joinPath(dir, file.name());
+      #endif
+      bool isDir = file.isDirectory();
+      file.close();
+      if (isDir) {
+        listFiles(path);
+      } else {
+        visitFile(path);
+      }
+    }
+  #endif
+}
+
+void ESP32FwFileSync::visitFile(const String& path){
+  if (path == ESP32FW_FILE_SYNC_TEMP || path == ESP32FW_FILE_SYNC_OLD) {
+    return;
+  }
+  int entry = findEntry(path);
+  if (entry < 0) {
+    if (_deleteUnlisted) {
+      _deleted.push_back(path);
+    }
+  } else {
+    _unchanged[entry] = fileMatches(path, _pending[entry].sha256);
+  }
+}
+
+void ESP32FwFileSync::makeParentDirs(const String& path){
+  // Fails harmlessly on file systems without directories (SPIFFS)
+  for (int i = path.indexOf('/', 1); i > 0; i = path.indexOf('/', i + 1)) {
+    _fs->mkdir(path.substring(0, i));
+  }
+}
+
+bool ESP32FwFileSync::moveIntoPlace(const String& path){
+  if (_fs->rename(ESP32FW_FILE_SYNC_TEMP, path)) {
+    return true;
+  }
+  if (!_fs->exists(path)) {
+    return false;
+  }
+  // The target cannot be replaced by a rename: move it aside first and put
+  // it back if the new file still cannot take its place
+  _fs->remove(ESP32FW_FILE_SYNC_OLD);
+  if (!_fs->rename(path, ESP32FW_FILE_SYNC_OLD)) {
+    return false;
+  }
+  if (!_fs->rename(ESP32FW_FILE_SYNC_TEMP, path)) {
+    _fs->rename(ESP32FW_FILE_SYNC_OLD, path);
+    return false;
+  }
+  _fs->remove(ESP32FW_FILE_SYNC_OLD);
+  return true;
+}
+
+void ESP32FwFileSync::closeFile(){
+  if (_fileEntry >= 0) {
+    _file.close();
+    _fs->remove(ESP32FW_FILE_SYNC_TEMP);
+    _fileEntry = -1;
+  }
+}
+
+bool ESP32FwFileSync::fail(const char* error){
+  if (!_error) {
+    _error = error;
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef file_sync_h
+#define file_sync_h
+
+#include <Arduino.h>
+#include <FS.h>
+#include <vector>
+#include "digest.h"
+
+// Longest file path accepted in a manifest
+#ifndef ESP32FW_FILE_PATH_MAX
+  #define ESP32FW_FILE_PATH_MAX 96
+#endif
+
+// Most files a manifest may list; bounds the memory the comparison needs
+#ifndef ESP32FW_FILE_SYNC_MAX_FILES
+  #define ESP32FW_FILE_SYNC_MAX_FILES 128
+#endif
+
+// File written while a file is received, renamed over the target once its
+// hash has been checked
+#define ESP32FW_FILE_SYNC_TEMP "/.fwsync.tmp"
+
+// Where the file being replaced is kept on file systems that cannot rename
+// over an existing file (SPIFFS), until the new one is in place
+#define ESP32FW_FILE_SYNC_OLD "/.fwsync.old"
+
+// Per-file file system update. The client sends a manifest with one
+// "<sha256 hex> <path>" line for every file it wants on the device. The
+// manifest is compared with the file system, leaving the files that are
+// missing or differ (pending()) and, when the client asked for deletion,
+// the files the manifest does not list (deleted()). The client then sends
+// only the pending files; each one is written to a temporary file, checked
+// against its manifest hash and renamed into place, so a file is either
+// replaced whole or not at all. apply() removes the deleted files once
+// nothing is pending. Without deletion, files the manifest does not list
+// (logs, settings the application wrote) are left alone.
+class ESP32FwFileSync{
+  public:
+    struct Entry {
+      String path;
+      uint8_t sha256[ESP32FW_SHA256_SIZE];
+    };
+
+    ESP32FwFileSync();
+    ~ESP32FwFileSync();
+    void setFileSystem(fs::FS* fs) { _fs = fs; }
+    bool isEnabled() const { return _fs != nullptr; }
+
+    void beginManifest(bool deleteUnlisted);
+    bool writeManifest(const uint8_t* data, size_t len);
+    bool finishManifest();
+    const std::vector<Entry>& pending() const { return _pending; }
+    const std::vector<String>& deleted() const { return _deleted; }
+
+    bool beginFile(const String& path);
+    bool writeFile(const uint8_t* data, size_t len);
+    bool finishFile();
+    void dropFile();
+    bool apply();
+    void end();
+
+    size_t filesWritten() const { return _written; }
+    size_t filesDeleted() const { return _removed; }
+    const char* errorString() const { return _error; }
+
+  private:
+    fs::FS* _fs = nullptr;
+    std::vector<Entry> _pending;
+    std::vector<String> _deleted;
+    std::vector<bool> _unchanged;
+    bool _deleteUnlisted = false;
+    char _line[ESP32FW_SHA256_SIZE * 2 + 1 + ESP32FW_FILE_PATH_MAX + 1];
+    size_t _lineLen = 0;
+
+    // File being received
+    File _file;
+    int _fileEntry = -1;
+    ESP32FwSha256 _sha;
+    size_t _written = 0;
+    size_t _removed = 0;
+    const char* _error = nullptr;
+
+    bool parseLine();
+    int findEntry(const String& path) const;
+    bool fileMatches(const String& path, const uint8_t* sha256);
+    void listFiles(const String& dir);
+    void visitFile(const String& path);
+    void makeParentDirs(const String& path);
+    bool moveIntoPlace(const String& path);
+    void closeFile();
+    bool fail(const char* error);
+};
+
+#endif
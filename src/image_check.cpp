@@ -0,0 +1,181 @@
+#include "image_check.h"
+
+// First byte of every ESP application image
+#define IMAGE_MAGIC 0xE9
+
+#if defined(ESP32)
+  // esp_image_header_t followed by the first segment header; the
+  // application descriptor opens the first segment
+  #define IMAGE_HEADER_SIZE 24
+  #define IMAGE_MAX_FLASH_MODE 5
+  #define APP_DESC_OFFSET 32
+  #define APP_DESC_MAGIC 0xABCD5432
+  #if defined(CONFIG_IDF_FIRMWARE_CHIP_ID)
+    #define IMAGE_CHIP_ID CONFIG_IDF_FIRMWARE_CHIP_ID
+  #else
+    // Cores without the setting only build for the original ESP32
+    #define IMAGE_CHIP_ID 0x0000
+  #endif
+#else
+  #define IMAGE_HEADER_SIZE 8
+  #define IMAGE_MAX_FLASH_MODE 3
+  // Application images start executing from IRAM
+  #define IMAGE_ENTRY_REGION 0x40100000
+#endif
+
+// Most segments the bootloader loads from one image
+#define IMAGE_MAX_SEGMENTS 16
+
+// LittleFS keeps its name in the superblock at the start of block 0
+#define LITTLEFS_MAGIC_OFFSET 8
+#define LITTLEFS_MAGIC "littlefs"
+
+static uint32_t readLE32(const uint8_t* p){
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+ESP32FwImageCheck::ESP32FwImageCheck(){}
+
+bool ESP32FwImageCheck::begin(Kind expected, Begin onBegin, Output output){
+  _running = true;
+  _checked = false;
+  _expected = expected;
+  _kind = KIND_UNKNOWN;
+  _onBegin = onBegin;
+  _output = output;
+  _headerLen = 0;
+  _description[0] = '\0';
+  _error = nullptr;
+  return true;
+}
+
+bool ESP32FwImageCheck::write(uint8_t* data, size_t len){
+  if (_error) {
+    return false;
+  }
+  if (!_checked) {
+    size_t n = min(len, sizeof(_header) - _headerLen);
+    memcpy(_header + _headerLen, data, n);
+    _headerLen += n;
+    data += n;
+    len -= n;
+    if (_headerLen < sizeof(_header) || !check()) {
+      return !_error;
+    }
+  }
+  if (len > 0 && !_output(data, len)) {
+    return fail("Failed to write image");
+  }
+  return true;
+}
+
+bool ESP32FwImageCheck::finish(){
+  // An image shorter than the header is checked with what there is
+  if (!_error && !_checked) {
+    if (_headerLen == 0) {
+      return fail("Image is empty");
+    }
+    check();
+  }
+  return !_error;
+}
+
+void ESP32FwImageCheck::end(){
+  _running = false;
+  _onBegin = nullptr;
+  _output = nullptr;
+}
+
+bool ESP32FwImageCheck::check(){
+  Kind detected = identify();
+  if (_expected == KIND_FIRMWARE && detected == KIND_FILESYSTEM) {
+    return fail("File system image uploaded as firmware");
+  }
+  if (_expected == KIND_FILESYSTEM && detected == KIND_FIRMWARE) {
+    return fail("Firmware image uploaded as file system image");
+  }
+  _kind = detected != KIND_UNKNOWN ? detected : _expected;
+  if (_kind == KIND_UNKNOWN) {
+    return fail("Unrecognized image, select firmware or file system mode");
+  }
+  if (_kind == KIND_FIRMWARE && !checkFirmware()) {
+    return false;
+  }
+  if (detected == KIND_FILESYSTEM) {
+    strcpy(_description, LITTLEFS_MAGIC);
+  }
+  _checked = true;
+  if (!_onBegin(_kind)) {
+    return fail("Failed to begin update");
+  }
+  if (!_output(_header, _headerLen)) {
+    return fail("Failed to write image");
+  }
+  return true;
+}
+
+ESP32FwImageCheck::Kind ESP32FwImageCheck::identify(){
+  if (_headerLen >= IMAGE_HEADER_SIZE && _header[0] == IMAGE_MAGIC &&
+      _header[1] > 0 && _header[1] <= IMAGE_MAX_SEGMENTS && _header[2] <= IMAGE_MAX_FLASH_MODE) {
+    return KIND_FIRMWARE;
+  }
+  #if defined(ESP8266)
+    // Compressed firmware, unpacked by the bootloader
+    if (_headerLen >= 2 && _header[0] == 0x1f && _header[1] == 0x8b) {
+      return KIND_FIRMWARE;
+    }
+  #endif
+  if (_headerLen >= LITTLEFS_MAGIC_OFFSET + 8 && memcmp(_header + LITTLEFS_MAGIC_OFFSET, LITTLEFS_MAGIC, 8) == 0) {
+    return KIND_FILESYSTEM;
+  }
+  // SPIFFS and FAT images carry no signature
+  return KIND_UNKNOWN;
+}
+
+bool ESP32FwImageCheck::checkFirmware(){
+  #if defined(ESP8266)
+    if (_headerLen >= 2 && _header[0] == 0x1f && _header[1] == 0x8b) {
+      return true;
+    }
+  #endif
+  if (identify() != KIND_FIRMWARE) {
+    return fail("Not a firmware image");
+  }
+  #if defined(ESP32)
+    uint16_t chipId = _header[12] | (_header[13] << 8);
+    if (chipId != IMAGE_CHIP_ID) {
+      return fail("Firmware image is for a different chip");
+    }
+    uint8_t flashSize = _header[3] >> 4;
+    if (flashSize > 7) {
+      return fail("Malformed firmware image header");
+    }
+    if (ESP.getFlashChipSize() > 0 && (0x100000UL << flashSize) > ESP.getFlashChipSize()) {
+      return fail("Firmware image is built for a larger flash chip");
+    }
+    // Project name and version from the application descriptor
+    if (_headerLen >= APP_DESC_OFFSET + 80 && readLE32(_header + APP_DESC_OFFSET) == APP_DESC_MAGIC) {
+      snprintf(_description, sizeof(_description), "%.32s %.32s",
+               (const char*)_header + APP_DESC_OFFSET + 48, (const char*)_header + APP_DESC_OFFSET + 16);
+    }
+  #elif defined(ESP8266)
+    if ((readLE32(_header + 4) & 0xFFFF0000) != IMAGE_ENTRY_REGION) {
+      return fail("Firmware image is not for ESP8266");
+    }
+    uint32_t flashSize = ESP.magicFlashChipSize(_header[3] >> 4);
+    if (flashSize == 0) {
+      return fail("Malformed firmware image header");
+    }
+    if (flashSize > ESP.getFlashChipRealSize()) {
+      return fail("Firmware image is built for a larger flash chip");
+    }
+  #endif
+  return true;
+}
+
+bool ESP32FwImageCheck::fail(const char* error){
+  if (!_error) {
+    _error = error;
+  }
+  return false;
+}
@@ -0,0 +1,59 @@
+#ifndef image_check_h
+#define image_check_h
+
+#include <Arduino.h>
+#include <functional>
+
+// Leading image bytes held back and inspected before anything is written:
+// the image header, the first segment header and the start of the
+// application descriptor (magic, versions and project name)
+#define ESP32FW_IMAGE_CHECK_SIZE 112
+
+// Gate in front of the flash writes. The first bytes of each image are
+// collected and identified before the update is begun: an ESP application
+// image is checked against the running chip (chip id, flash size and mode)
+// and a LittleFS image is recognized by its superblock. A file that does
+// not match the expected kind is refused before the target is erased, and
+// when no kind is expected the detected one is used. The begin callback
+// starts the update for the accepted kind; the held-back bytes and
+// everything after them then go to the output callback unchanged.
+class ESP32FwImageCheck{
+  public:
+    enum Kind {
+      KIND_UNKNOWN,
+      KIND_FIRMWARE,
+      KIND_FILESYSTEM
+    };
+    typedef std::function<bool(Kind kind)> Begin;
+    typedef std::function<bool(uint8_t* data, size_t len)> Output;
+
+    ESP32FwImageCheck();
+    bool begin(Kind expected, Begin onBegin, Output output);
+    bool write(uint8_t* data, size_t len);
+    bool finish();
+    void end();
+    bool isRunning() const { return _running; }
+    Kind kind() const { return _kind; }
+    const char* description() const { return _description; }
+    const char* errorString() const { return _error; }
+
+  private:
+    bool _running = false;
+    bool _checked = false;
+    Kind _expected = KIND_UNKNOWN;
+    Kind _kind = KIND_UNKNOWN;
+    Begin _onBegin;
+    Output _output;
+    uint8_t _header[ESP32FW_IMAGE_CHECK_SIZE];
+    size_t _headerLen = 0;
+    // Project name and version of up to 32 characters each, and a space
+    char _description[32 + 1 + 32 + 1];
+    const char* _error = nullptr;
+
+    bool check();
+    Kind identify();
+    bool checkFirmware();
+    bool fail(const char* error);
+};
+
+#endif
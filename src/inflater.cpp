@@ -0,0 +1,216 @@
+#include "inflater.h"
+#include "feature_flags.h"
+
+#if defined(ESP32) && ESP32FW_FEATURE_COMPRESSION
+#include <rom/crc.h>
+
+// gzip header flags (RFC 1952)
+#define GZIP_FLAG_HCRC 0x02
+#define GZIP_FLAG_EXTRA 0x04
+#define GZIP_FLAG_NAME 0x08
+#define GZIP_FLAG_COMMENT 0x10
+#define GZIP_HEADER_SIZE 10
+
+ESP32FwInflater::ESP32FwInflater(){}
+
+ESP32FwInflater::~ESP32FwInflater(){
+  end();
+}
+
+bool ESP32FwInflater::begin(Format format, Output output){
+  end();
+  _decomp = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+  _window = (uint8_t*)malloc(TINFL_LZ_DICT_SIZE);
+  if (!_decomp || !_window) {
+    end();
+    _error = "Not enough memory for decompression";
+    return false;
+  }
+  tinfl_init(_decomp);
+  _windowPos = 0;
+  _output = output;
+  _format = format;
+  _state = format == FORMAT_GZIP ? STATE_HEADER : STATE_DEFLATE;
+  _flags = 0;
+  _fieldPos = 0;
+  _fieldLen = 0;
+  _crc = 0;
+  _outputSize = 0;
+  _error = nullptr;
+  return true;
+}
+
+bool ESP32FwInflater::write(const uint8_t* data, size_t len){
+  while (len > 0 && _state != STATE_ERROR) {
+    size_t used;
+    if (_state == STATE_DEFLATE) {
+      used = inflate(data, len);
+    } else if (_state == STATE_TRAILER) {
+      used = min(len, sizeof(_trailer) - _fieldPos);
+      memcpy(_trailer + _fieldPos, data, used);
+      _fieldPos += used;
+      if (_fieldPos == sizeof(_trailer)) {
+        _state = STATE_DONE;
+      }
+    } else if (_state == STATE_DONE) {
+      return fail("Unexpected data after end of compressed stream");
+    } else {
+      used = parseHeader(data, len);
+    }
+    data += used;
+    len -= used;
+  }
+  return _state != STATE_ERROR;
+}
+
+bool ESP32FwInflater::finish(){
+  if (_state == STATE_ERROR) {
+    return false;
+  }
+  if (_state != STATE_DONE) {
+    return fail("Compressed stream is truncated");
+  }
+  if (_format == FORMAT_GZIP) {
+    uint32_t crc = _trailer[0] | (_trailer[1] << 8) | (_trailer[2] << 16) | ((uint32_t)_trailer[3] << 24);
+    uint32_t size = _trailer[4] | (_trailer[5] << 8) | (_trailer[6] << 16) | ((uint32_t)_trailer[7] << 24);
+    if (size != (uint32_t)_outputSize || crc != _crc) {
+      return fail("Compressed stream checksum mismatch");
+    }
+  }
+  return true;
+}
+
+void ESP32FwInflater::end(){
+  free(_decomp);
+  _decomp = nullptr;
+  free(_window);
+  _window = nullptr;
+  _output = nullptr;
+}
+
+size_t ESP32FwInflater::parseHeader(const uint8_t* data, size_t len){
+  size_t used = 0;
+  while (used < len && _state != STATE_DEFLATE && _state != STATE_ERROR) {
+    uint8_t b = data[used++];
+    switch (_state) {
+      case STATE_HEADER:
+        if ((_fieldPos == 0 && b != 0x1f) || (_fieldPos == 1 && b != 0x8b) || (_fieldPos == 2 && b != 8)) {
+          fail("Not a gzip stream");
+          break;
+        }
+        if (_fieldPos == 3) {
+          _flags = b;
+        }
+        if (++_fieldPos == GZIP_HEADER_SIZE) {
+          _fieldPos = 0;
+          _state = STATE_EXTRA_LEN;
+        }
+        break;
+      case STATE_EXTRA_LEN:
+        if (!(_flags & GZIP_FLAG_EXTRA)) {
+          used--;
+          _state = STATE_NAME;
+          break;
+        }
+        _fieldLen |= (size_t)b << (8 * _fieldPos);
+        if (++_fieldPos == 2) {
+          _fieldPos = 0;
+          _state = STATE_EXTRA;
+        }
+        break;
+      case STATE_EXTRA:
+        if (_fieldPos == _fieldLen) {
+          used--;
+          _fieldPos = 0;
+          _state = STATE_NAME;
+        } else {
+          _fieldPos++;
+        }
+        break;
+      case STATE_NAME:
+        if (!(_flags & GZIP_FLAG_NAME) || b == 0) {
+          if (!(_flags & GZIP_FLAG_NAME)) {
+            used--;
+          }
+          _flags &= ~GZIP_FLAG_NAME;
+          _state = STATE_COMMENT;
+        }
+        break;
+      case STATE_COMMENT:
+        if (!(_flags & GZIP_FLAG_COMMENT) || b == 0) {
+          if (!(_flags & GZIP_FLAG_COMMENT)) {
+            used--;
+          }
+          _flags &= ~GZIP_FLAG_COMMENT;
+          _state = STATE_HEADER_CRC;
+        }
+        break;
+      case STATE_HEADER_CRC:
+        if (!(_flags & GZIP_FLAG_HCRC)) {
+          used--;
+          _state = STATE_DEFLATE;
+        } else if (++_fieldPos == 2) {
+          _fieldPos = 0;
+          _state = STATE_DEFLATE;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return used;
+}
+
+size_t ESP32FwInflater::inflate(const uint8_t* data, size_t len){
+  mz_uint32 flags = TINFL_FLAG_HAS_MORE_INPUT;
+  if (_format == FORMAT_ZLIB) {
+    flags |= TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_COMPUTE_ADLER32;
+  }
+  size_t used = 0;
+  for (;;) {
+    size_t inBytes = len - used;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - _windowPos;
+    tinfl_status status = tinfl_decompress(_decomp, data + used, &inBytes,
+                                           _window, _window + _windowPos, &outBytes, flags);
+    used += inBytes;
+    if (outBytes > 0) {
+      if (!emit(_window + _windowPos, outBytes)) {
+        return used;
+      }
+      _windowPos = (_windowPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+    }
+    if (status < TINFL_STATUS_DONE) {
+      fail("Corrupt compressed data");
+      return used;
+    }
+    if (status == TINFL_STATUS_DONE) {
+      // zlib's Adler-32 trailer is checked by tinfl; gzip's CRC-32/size follow
+      _fieldPos = 0;
+      _state = _format == FORMAT_GZIP ? STATE_TRAILER : STATE_DONE;
+      return used;
+    }
+    if (status == TINFL_STATUS_NEEDS_MORE_INPUT && used == len) {
+      return used;
+    }
+  }
+}
+
+bool ESP32FwInflater::emit(uint8_t* data, size_t len){
+  if (_format == FORMAT_GZIP) {
+    _crc = crc32_le(_crc, data, len);
+  }
+  _outputSize += len;
+  if (!_output(data, len)) {
+    return fail("Failed to write decompressed data");
+  }
+  return true;
+}
+
+bool ESP32FwInflater::fail(const char* error){
+  if (_state != STATE_ERROR) {
+    _error = error;
+    _state = STATE_ERROR;
+  }
+  return false;
+}
+#endif
@@ -0,0 +1,67 @@
+#ifndef inflater_h
+#define inflater_h
+
+#include <Arduino.h>
+#include <functional>
+
+#if defined(ESP32)
+#include <rom/miniz.h>
+
+// Streaming inflater for gzip (RFC 1952) and zlib (RFC 1950) compressed
+// uploads, built on the tinfl decoder in the ESP32 ROM. Memory is bounded to
+// the decoder state plus one 32 KB window, allocated in begin(); inflated data
+// is handed to the output callback as it leaves the window.
+class ESP32FwInflater{
+  public:
+    typedef std::function<bool(uint8_t* data, size_t len)> Output;
+    enum Format {
+      FORMAT_GZIP,
+      FORMAT_ZLIB
+    };
+
+    ESP32FwInflater();
+    ~ESP32FwInflater();
+    bool begin(Format format, Output output);
+    bool write(const uint8_t* data, size_t len);
+    bool finish();
+    void end();
+    bool isRunning() const { return _window != nullptr; }
+    size_t outputSize() const { return _outputSize; }
+    const char* errorString() const { return _error; }
+
+  private:
+    enum State {
+      STATE_HEADER,
+      STATE_EXTRA_LEN,
+      STATE_EXTRA,
+      STATE_NAME,
+      STATE_COMMENT,
+      STATE_HEADER_CRC,
+      STATE_DEFLATE,
+      STATE_TRAILER,
+      STATE_DONE,
+      STATE_ERROR
+    };
+
+    tinfl_decompressor* _decomp = nullptr;
+    uint8_t* _window = nullptr;
+    size_t _windowPos = 0;
+    Output _output;
+    Format _format = FORMAT_GZIP;
+    State _state = STATE_HEADER;
+    uint8_t _flags = 0;
+    size_t _fieldPos = 0;
+    size_t _fieldLen = 0;
+    uint8_t _trailer[8];
+    uint32_t _crc = 0;
+    size_t _outputSize = 0;
+    const char* _error = nullptr;
+
+    size_t parseHeader(const uint8_t* data, size_t len);
+    size_t inflate(const uint8_t* data, size_t len);
+    bool emit(uint8_t* data, size_t len);
+    bool fail(const char* error);
+};
+#endif
+
+#endif
@@ -0,0 +1,178 @@
+#include "metrics.h"
+
+// Bucket bounds: latencies in microseconds, chunk sizes in bytes
+static const uint32_t latencyBounds[] = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000 };
+static const uint32_t sizeBounds[] = { 128, 256, 512, 1024, 1460, 2048, 4096, 8192, 16384 };
+
+#define COUNT_OF(a) (sizeof(a) / sizeof((a)[0]))
+
+ESP32FwHistogram::ESP32FwHistogram(const uint32_t* bounds, uint8_t boundCount)
+  : _bounds(bounds), _boundCount(min(boundCount, (uint8_t)ESP32FW_HISTOGRAM_MAX_BUCKETS)){
+  reset();
+}
+
+void ESP32FwHistogram::record(uint32_t value){
+  uint8_t i = 0;
+  while (i < _boundCount && value > _bounds[i]) {
+    i++;
+  }
+  _buckets[i] = _buckets[i] + 1;
+  _count = _count + 1;
+  _sum = _sum + value;
+  if (value > _max) {
+    _max = value;
+  }
+}
+
+void ESP32FwHistogram::reset(){
+  for (uint8_t i = 0; i <= ESP32FW_HISTOGRAM_MAX_BUCKETS; i++) {
+    _buckets[i] = 0;
+  }
+  _count = 0;
+  _sum = 0;
+  _max = 0;
+}
+
+ESP32FwMetrics::ESP32FwMetrics()
+  : _flashWrite(latencyBounds, COUNT_OF(latencyBounds)),
+    _chunkInterval(latencyBounds, COUNT_OF(latencyBounds)),
+    _chunkSize(sizeBounds, COUNT_OF(sizeBounds)){}
+
+void ESP32FwMetrics::uploadStarted(){
+  _flashWrite.reset();
+  _chunkInterval.reset();
+  _chunkSize.reset();
+  _active = true;
+  _startMs = millis();
+  _endMs = _startMs;
+  _lastChunkUs = 0;
+  _bytes = 0;
+  _minFreeHeap = ESP.getFreeHeap();
+  _updateBeginUs = 0;
+  _updateEndUs = 0;
+  _sectorsWritten = 0;
+  _sectorsSkipped = 0;
+}
+
+void ESP32FwMetrics::uploadFinished(bool success){
+  if (success) {
+    _uploadsOk++;
+  } else {
+    _uploadsFailed++;
+  }
+  _active = false;
+  _endMs = millis();
+}
+
+void ESP32FwMetrics::chunkReceived(size_t len){
+  uint32_t now = micros();
+  if (_lastChunkUs != 0) {
+    _chunkInterval.record(now - _lastChunkUs);
+  }
+  _lastChunkUs = now;
+  _chunkSize.record(len);
+  _bytes += len;
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < _minFreeHeap) {
+    _minFreeHeap = freeHeap;
+  }
+}
+
+uint32_t ESP32FwMetrics::durationMs() const{
+  return (_active ? millis() : _endMs) - _startMs;
+}
+
+uint32_t ESP32FwMetrics::bytesPerSecond() const{
+  uint32_t ms = durationMs();
+  return ms > 0 ? (uint32_t)((uint64_t)_bytes * 1000 / ms) : 0;
+}
+
+static void appendHistogramJSON(String& out, const char* name, const ESP32FwHistogram& h){
+  out += "\"";
+  out += name;
+  out += "\":{\"count\":" + String(h.count()) +
+         ",\"sum\":" + String((double)h.sum(), 0) +
+         ",\"max\":" + String(h.max()) + ",\"buckets\":[";
+  for (uint8_t i = 0; i <= h.boundCount(); i++) {
+    out += i > 0 ? "," : "";
+    out += "{\"le\":";
+    out += i < h.boundCount() ? String(h.bound(i)) : String("\"+Inf\"");
+    out += ",\"count\":" + String(h.bucket(i)) + "}";
+  }
+  out += "]}";
+}
+
+String ESP32FwMetrics::toJSON() const{
+  String out;
+  out.reserve(1536);
+  out += "{\"uploads\":{\"ok\":" + String(_uploadsOk) + ",\"failed\":" + String(_uploadsFailed) + "},";
+  out += "\"upload\":{\"active\":";
+  out += _active ? "true" : "false";
+  out += ",\"bytes\":" + String(_bytes) +
+         ",\"duration_ms\":" + String(durationMs()) +
+         ",\"bytes_per_second\":" + String(bytesPerSecond()) +
+         ",\"min_free_heap\":" + String(_minFreeHeap) +
+         ",\"update_begin_us\":" + String(_updateBeginUs) +
+         ",\"update_end_us\":" + String(_updateEndUs) +
+         ",\"sectors_written\":" + String(_sectorsWritten) +
+         ",\"sectors_skipped\":" + String(_sectorsSkipped) + "},";
+  appendHistogramJSON(out, "flash_write_us", _flashWrite);
+  out += ",";
+  appendHistogramJSON(out, "chunk_interval_us", _chunkInterval);
+  out += ",";
+  appendHistogramJSON(out, "chunk_size_bytes", _chunkSize);
+  out += "}";
+  return out;
+}
+
+// Prometheus histograms are cumulative and in base units, so microsecond
+// values are scaled to seconds
+static void appendHistogramPrometheus(String& out, const char* name, const char* help,
+                                      const ESP32FwHistogram& h, double scale, unsigned char decimals){
+  String metric = String("esp32fw_") + name;
+  out += "# HELP " + metric + " " + help + "\n";
+  out += "# TYPE " + metric + " histogram\n";
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i <= h.boundCount(); i++) {
+    cumulative += h.bucket(i);
+    out += metric + "_bucket{le=\"";
+    out += i < h.boundCount() ? String(h.bound(i) * scale, decimals) : String("+Inf");
+    out += "\"} " + String(cumulative) + "\n";
+  }
+  out += metric + "_sum " + String((double)h.sum() * scale, decimals) + "\n";
+  out += metric + "_count " + String(h.count()) + "\n";
+}
+
+static void appendGauge(String& out, const char* name, const char* help, const String& value){
+  out += "# HELP esp32fw_";
+  out += name;
+  out += " ";
+  out += help;
+  out += "\n# TYPE esp32fw_";
+  out += name;
+  out += " gauge\nesp32fw_";
+  out += name;
+  out += " " + value + "\n";
+}
+
+String ESP32FwMetrics::toPrometheus() const{
+  String out;
+  out.reserve(4096);
+  out += "# HELP esp32fw_uploads_total Finished uploads since boot\n";
+  out += "# TYPE esp32fw_uploads_total counter\n";
+  out += "esp32fw_uploads_total{result=\"ok\"} " + String(_uploadsOk) + "\n";
+  out += "esp32fw_uploads_total{result=\"failed\"} " + String(_uploadsFailed) + "\n";
+  appendGauge(out, "upload_active", "1 while an upload is in progress", String(_active ? 1 : 0));
+  appendGauge(out, "upload_bytes", "Bytes received in the current or last upload", String(_bytes));
+  appendGauge(out, "upload_duration_seconds", "Duration of the current or last upload", String(durationMs() / 1000.0, 3));
+  appendGauge(out, "upload_bytes_per_second", "Average throughput of the current or last upload", String(bytesPerSecond()));
+  appendGauge(out, "upload_min_free_heap_bytes", "Lowest free heap seen during the upload", String(_minFreeHeap));
+  appendGauge(out, "update_begin_seconds", "Time spent in Update.begin", String(_updateBeginUs / 1e6, 6));
+  appendGauge(out, "update_end_seconds", "Time spent in Update.end", String(_updateEndUs / 1e6, 6));
+  appendGauge(out, "sectors_written", "Flash sectors erased and written by the last update", String(_sectorsWritten));
+  appendGauge(out, "sectors_skipped", "Flash sectors left alone because they were unchanged", String(_sectorsSkipped));
+  appendHistogramPrometheus(out, "flash_write_seconds", "Latency of Update.write calls", _flashWrite, 1e-6, 6);
+  appendHistogramPrometheus(out, "chunk_interval_seconds", "Time between received upload chunks", _chunkInterval, 1e-6, 6);
+  appendHistogramPrometheus(out, "chunk_size_bytes", "Size of received upload chunks", _chunkSize, 1, 0);
+  return out;
+}
@@ -0,0 +1,69 @@
+#ifndef metrics_h
+#define metrics_h
+
+#include <Arduino.h>
+
+#define ESP32FW_HISTOGRAM_MAX_BUCKETS 12
+
+// Fixed-bucket histogram: recording is a short scan over the bucket bounds
+// and a few counter updates, with no allocation. Values above the last bound
+// land in an implicit +Inf bucket.
+class ESP32FwHistogram{
+  public:
+    ESP32FwHistogram(const uint32_t* bounds, uint8_t boundCount);
+    void record(uint32_t value);
+    void reset();
+    uint8_t boundCount() const { return _boundCount; }
+    uint32_t bound(uint8_t i) const { return _bounds[i]; }
+    uint32_t bucket(uint8_t i) const { return _buckets[i]; }
+    uint32_t count() const { return _count; }
+    uint64_t sum() const { return _sum; }
+    uint32_t max() const { return _max; }
+
+  private:
+    const uint32_t* _bounds;
+    uint8_t _boundCount;
+    volatile uint32_t _buckets[ESP32FW_HISTOGRAM_MAX_BUCKETS + 1];
+    volatile uint32_t _count;
+    volatile uint64_t _sum;
+    volatile uint32_t _max;
+};
+
+// Upload instrumentation behind /ota/metrics. Histograms and the per-upload
+// figures describe the current or last upload and are reset when the next
+// one begins; the upload counters accumulate since boot.
+class ESP32FwMetrics{
+  public:
+    ESP32FwMetrics();
+    void uploadStarted();
+    void uploadFinished(bool success);
+    void chunkReceived(size_t len);
+    void updateBegin(uint32_t us) { _updateBeginUs = us; }
+    void updateEnd(uint32_t us) { _updateEndUs = us; }
+    void sectorsWritten(size_t written, size_t skipped) { _sectorsWritten = written; _sectorsSkipped = skipped; }
+    ESP32FwHistogram& flashWrites() { return _flashWrite; }
+    String toJSON() const;
+    String toPrometheus() const;
+
+  private:
+    ESP32FwHistogram _flashWrite;
+    ESP32FwHistogram _chunkInterval;
+    ESP32FwHistogram _chunkSize;
+    uint32_t _uploadsOk = 0;
+    uint32_t _uploadsFailed = 0;
+    bool _active = false;
+    unsigned long _startMs = 0;
+    unsigned long _endMs = 0;
+    uint32_t _lastChunkUs = 0;
+    uint32_t _bytes = 0;
+    uint32_t _minFreeHeap = 0;
+    uint32_t _updateBeginUs = 0;
+    uint32_t _updateEndUs = 0;
+    uint32_t _sectorsWritten = 0;
+    uint32_t _sectorsSkipped = 0;
+
+    uint32_t durationMs() const;
+    uint32_t bytesPerSecond() const;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#include "progress_stream.h"
+
+static const char* const phaseNames[] = {
+  "idle", "begin", "write", "verify", "end", "done", "error", "reboot"
+};
+
+ESP32FwProgressStream::ESP32FwProgressStream(){}
+
+void ESP32FwProgressStream::setPhase(ESP32Fw_Phase phase, const char* error){
+  if (phase == ESP32FW_PHASE_BEGIN) {
+    _received = 0;
+    _written = 0;
+    _total = 0;
+    _startTime = millis();
+  }
+  _phase = phase;
+  publish(error);
+}
+
+void ESP32FwProgressStream::update(size_t received, size_t written, size_t total){
+  _received = received;
+  _written = written;
+  _total = total;
+  if (millis() - _lastSent >= _intervalMs) {
+    publish();
+  }
+}
+
+void ESP32FwProgressStream::publish(const char* error){
+  _lastSent = millis();
+  if (!_transport) {
+    return;
+  }
+  // Write rate is measured over flash writes since the update began
+  unsigned long elapsed = millis() - _startTime;
+  uint32_t rate = _phase >= ESP32FW_PHASE_WRITE && elapsed > 0 ? (uint64_t)_written * 1000 / elapsed : 0;
+  char data[224];
+  int len = snprintf(data, sizeof(data),
+                     "{\"phase\":\"%s\",\"received\":%u,\"written\":%u,\"total\":%u,\"rate\":%u",
+                     phaseNames[_phase], (unsigned)_received, (unsigned)_written, (unsigned)_total, (unsigned)rate);
+  if (error) {
+    len += snprintf(data + len, sizeof(data) - len, ",\"error\":\"");
+    for (const char* p = error; *p && len < (int)sizeof(data) - 8; p++) {
+      if (*p == '"' || *p == '\\') {
+        data[len++] = '\\';
+      }
+      data[len++] = *p >= 0x20 ? *p : ' ';
+    }
+    data[len++] = '"';
+  }
+  snprintf(data + len, sizeof(data) - len, "}");
+  _transport->sendEvent("progress", data);
+}
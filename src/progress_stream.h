@@ -0,0 +1,47 @@
+#ifndef progress_stream_h
+#define progress_stream_h
+
+#include <Arduino.h>
+#include "transport.h"
+
+// Minimum time between two progress events while writing; phase changes are
+// always sent at once
+#ifndef ESP32FW_PROGRESS_INTERVAL_MS
+  #define ESP32FW_PROGRESS_INTERVAL_MS 250
+#endif
+
+enum ESP32Fw_Phase {
+    ESP32FW_PHASE_IDLE = 0,
+    ESP32FW_PHASE_BEGIN,
+    ESP32FW_PHASE_WRITE,
+    ESP32FW_PHASE_VERIFY,
+    ESP32FW_PHASE_END,
+    ESP32FW_PHASE_DONE,
+    ESP32FW_PHASE_ERROR,
+    ESP32FW_PHASE_REBOOT
+};
+
+// Progress events behind /ota/progress. Tracks the phase, byte counts and
+// write rate of the current update and publishes them as "progress" events
+// on the transport's event stream, rate-limited while writing.
+class ESP32FwProgressStream{
+  public:
+    ESP32FwProgressStream();
+    void begin(ESP32FwTransport* transport) { _transport = transport; }
+    void setInterval(uint32_t intervalMs) { _intervalMs = intervalMs; }
+    void setPhase(ESP32Fw_Phase phase, const char* error = nullptr);
+    void update(size_t received, size_t written, size_t total);
+    void publish(const char* error = nullptr);
+
+  private:
+    ESP32FwTransport* _transport = nullptr;
+    uint32_t _intervalMs = ESP32FW_PROGRESS_INTERVAL_MS;
+    ESP32Fw_Phase _phase = ESP32FW_PHASE_IDLE;
+    size_t _received = 0;
+    size_t _written = 0;
+    size_t _total = 0;
+    unsigned long _startTime = 0;
+    unsigned long _lastSent = 0;
+};
+
+#endif
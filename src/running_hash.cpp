@@ -0,0 +1,165 @@
+#include "running_hash.h"
+
+#if defined(ESP32)
+  #include <esp_ota_ops.h>
+  // esp_image_header_t; each segment is preceded by an 8-byte header
+  #define IMAGE_HEADER_SIZE 24
+  #define SEGMENT_HEADER_SIZE 8
+  // Header byte set when the build appended a SHA-256 of the image
+  #define IMAGE_HASH_APPENDED 23
+#elif defined(ESP8266)
+  extern "C" uint32_t _FS_start;
+  extern "C" uint32_t _FS_end;
+  // Flash is mapped into the address space from here
+  #define FLASH_MAP_BASE 0x40200000
+#endif
+
+// First byte of every ESP application image
+#define IMAGE_MAGIC 0xE9
+
+// Most segments the bootloader loads from one image
+#define IMAGE_MAX_SEGMENTS 16
+
+static uint32_t readLE32(const uint8_t* p){
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+ESP32FwRunningHash::ESP32FwRunningHash(){}
+
+ESP32FwRunningHash::~ESP32FwRunningHash(){
+  stop();
+}
+
+void ESP32FwRunningHash::request(Target target){
+  if (!_entries[target].known && _current != target) {
+    _entries[target].queued = true;
+  }
+}
+
+const uint8_t* ESP32FwRunningHash::digest(Target target){
+  Entry& entry = _entries[target];
+  if (entry.known && target == TARGET_FILESYSTEM && millis() - entry.hashedAt > ESP32FW_FS_HASH_MAX_AGE_MS) {
+    entry.known = false;
+    request(target);
+  }
+  return entry.known ? entry.digest : nullptr;
+}
+
+void ESP32FwRunningHash::invalidate(Target target){
+  _entries[target].known = false;
+  _entries[target].queued = false;
+  if (_current == target) {
+    stop();
+  }
+}
+
+bool ESP32FwRunningHash::step(uint32_t budgetUs){
+  if (_current == TARGET_COUNT) {
+    for (int target = 0; target < TARGET_COUNT && _current == TARGET_COUNT; target++) {
+      if (_entries[target].queued) {
+        start((Target)target);
+      }
+    }
+    if (_current == TARGET_COUNT) {
+      return false;
+    }
+  }
+
+  uint32_t started = micros();
+  do {
+    size_t n = min((size_t)ESP32FW_RUNNING_HASH_READ_SIZE, _size - _offset);
+    if (!read(_offset, _buffer, n)) {
+      stop();
+      return true;
+    }
+    _sha.update(_buffer, n);
+    _offset += n;
+    if (_offset >= _size) {
+      Entry& entry = _entries[_current];
+      _sha.finish(entry.digest);
+      entry.known = true;
+      entry.hashedAt = millis();
+      entry.size = _size;
+      stop();
+      return true;
+    }
+  } while (micros() - started < budgetUs);
+  return true;
+}
+
+bool ESP32FwRunningHash::start(Target target){
+  // A target that cannot be read is not retried until requested again
+  _entries[target].queued = false;
+  #if defined(ESP32)
+    _partition = target == TARGET_FIRMWARE ?
+      esp_ota_get_running_partition() :
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, nullptr);
+    if (!_partition) {
+      return false;
+    }
+    _current = target;
+    _size = target == TARGET_FIRMWARE ? imageSize() : _partition->size;
+  #elif defined(ESP8266)
+    _current = target;
+    _size = target == TARGET_FIRMWARE ? imageSize() : (size_t)&_FS_end - (size_t)&_FS_start;
+  #endif
+  _buffer = _size > 0 ? (uint8_t*)malloc(ESP32FW_RUNNING_HASH_READ_SIZE) : nullptr;
+  if (!_buffer) {
+    stop();
+    return false;
+  }
+  _offset = 0;
+  _sha.begin();
+  return true;
+}
+
+void ESP32FwRunningHash::stop(){
+  free(_buffer);
+  _buffer = nullptr;
+  _current = TARGET_COUNT;
+  _offset = 0;
+  _size = 0;
+}
+
+size_t ESP32FwRunningHash::imageSize(){
+  #if defined(ESP32)
+    // Walk the segment headers to the end of the image the way the
+    // bootloader does: the checksum byte pads the image to 16 bytes and the
+    // appended SHA-256, if any, follows
+    uint8_t header[IMAGE_HEADER_SIZE];
+    if (!read(0, header, sizeof(header)) || header[0] != IMAGE_MAGIC ||
+        header[1] == 0 || header[1] > IMAGE_MAX_SEGMENTS) {
+      return 0;
+    }
+    size_t pos = IMAGE_HEADER_SIZE;
+    for (uint8_t i = 0; i < header[1]; i++) {
+      uint8_t segment[SEGMENT_HEADER_SIZE];
+      if (!read(pos, segment, sizeof(segment))) {
+        return 0;
+      }
+      pos += SEGMENT_HEADER_SIZE + readLE32(segment + 4);
+    }
+    size_t size = (pos + 16) & ~15;
+    if (header[IMAGE_HASH_APPENDED] == 1) {
+      size += ESP32FW_SHA256_SIZE;
+    }
+    return size <= _partition->size ? size : 0;
+  #elif defined(ESP8266)
+    // The running sketch starts at the beginning of flash, with the
+    // bootloader copy in front of it as in the .bin
+    return ESP.getSketchSize();
+  #else
+    return 0;
+  #endif
+}
+
+bool ESP32FwRunningHash::read(size_t offset, uint8_t* data, size_t len){
+  #if defined(ESP32)
+    return offset + len <= _partition->size && esp_partition_read(_partition, offset, data, len) == ESP_OK;
+  #elif defined(ESP8266)
+    size_t base = _current == TARGET_FIRMWARE ? 0 : (size_t)&_FS_start - FLASH_MAP_BASE;
+    return ESP.flashRead(base + offset, data, len);
+  #else
+    return false;
+  #endif
+}
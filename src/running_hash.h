@@ -0,0 +1,78 @@
+#ifndef running_hash_h
+#define running_hash_h
+
+#include <Arduino.h>
+#include "digest.h"
+
+#if defined(ESP32)
+#include <esp_partition.h>
+#endif
+
+// Longest each step() call spends reading and hashing flash
+#ifndef ESP32FW_RUNNING_HASH_BUDGET_US
+  #define ESP32FW_RUNNING_HASH_BUDGET_US 2000
+#endif
+
+// Bytes read from flash at a time while hashing
+#ifndef ESP32FW_RUNNING_HASH_READ_SIZE
+  #define ESP32FW_RUNNING_HASH_READ_SIZE 1024
+#endif
+
+// The application may write its file system at any time, so a file system
+// digest older than this is hashed again before it is trusted
+#ifndef ESP32FW_FS_HASH_MAX_AGE_MS
+  #define ESP32FW_FS_HASH_MAX_AGE_MS 60000
+#endif
+
+// SHA-256 of what the device runs: the application image in the running
+// slot, over exactly the bytes of the .bin it was flashed from, and the
+// whole file system partition. Digests are computed only once requested,
+// a few flash reads per step() from the application's loop(), and kept:
+// the running firmware cannot change until the next reboot, the file system
+// digest until it expires or is invalidated.
+class ESP32FwRunningHash{
+  public:
+    enum Target {
+      TARGET_FIRMWARE,
+      TARGET_FILESYSTEM,
+      TARGET_COUNT
+    };
+
+    ESP32FwRunningHash();
+    ~ESP32FwRunningHash();
+    // Queues the target for hashing unless its digest is known
+    void request(Target target);
+    bool step(uint32_t budgetUs);
+    bool isHashing() const { return _current != TARGET_COUNT; }
+    // Known digest of the target, or nullptr while it is pending or expired
+    const uint8_t* digest(Target target);
+    size_t size(Target target) const { return _entries[target].size; }
+    // Forgets the digest after the target has been written
+    void invalidate(Target target);
+
+  private:
+    struct Entry {
+      bool known = false;
+      bool queued = false;
+      unsigned long hashedAt = 0;
+      size_t size = 0;
+      uint8_t digest[ESP32FW_SHA256_SIZE];
+    };
+
+    Entry _entries[TARGET_COUNT];
+    Target _current = TARGET_COUNT;
+    size_t _offset = 0;
+    size_t _size = 0;
+    ESP32FwSha256 _sha;
+    uint8_t* _buffer = nullptr;
+#if defined(ESP32)
+    const esp_partition_t* _partition = nullptr;
+#endif
+
+    bool start(Target target);
+    void stop();
+    size_t imageSize();
+    bool read(size_t offset, uint8_t* data, size_t len);
+};
+
+#endif
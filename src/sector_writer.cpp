@@ -0,0 +1,256 @@
+#include "sector_writer.h"
+
+#if defined(ESP32)
+  #include <esp_ota_ops.h>
+#elif defined(ESP8266)
+  extern "C" uint32_t _FS_start;
+  extern "C" uint32_t _FS_end;
+  // Flash is mapped into the address space from here
+  #define FLASH_MAP_BASE 0x40200000
+#endif
+
+// First byte of every ESP application image
+#define IMAGE_MAGIC 0xE9
+
+ESP32FwSectorWriter::ESP32FwSectorWriter(){}
+
+ESP32FwSectorWriter::~ESP32FwSectorWriter(){
+  end();
+}
+
+bool ESP32FwSectorWriter::supports(Target target){
+  #if defined(ESP32)
+    return true;
+  #else
+    return target == TARGET_FILESYSTEM;
+  #endif
+}
+
+size_t ESP32FwSectorWriter::partitionSize(Target target){
+  #if defined(ESP32)
+    const esp_partition_t* partition = target == TARGET_FIRMWARE ?
+      esp_ota_get_next_update_partition(nullptr) :
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, nullptr);
+    return partition ? partition->size : 0;
+  #elif defined(ESP8266)
+    return target == TARGET_FILESYSTEM ? (size_t)&_FS_end - (size_t)&_FS_start : 0;
+  #else
+    return 0;
+  #endif
+}
+
+bool ESP32FwSectorWriter::begin(Target target, size_t size){
+  end();
+  _target = target;
+  _offset = 0;
+  _sectorLen = 0;
+  _written = 0;
+  _skipped = 0;
+  _compareSectors = true;
+  _erased = 0;
+  _eraseEnd = 0;
+  _preErased = 0;
+  _error = nullptr;
+  if (!supports(target)) {
+    return fail("Not supported for this target");
+  }
+  #if defined(ESP32)
+    if (target == TARGET_FIRMWARE) {
+      _partition = esp_ota_get_next_update_partition(nullptr);
+    } else {
+      _partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, nullptr);
+    }
+    if (!_partition) {
+      return fail("No partition to write the update to");
+    }
+    _partitionSize = _partition->size;
+  #elif defined(ESP8266)
+    _partitionSize = (size_t)&_FS_end - (size_t)&_FS_start;
+  #endif
+  if (size > _partitionSize) {
+    return fail("File too large for the target partition");
+  }
+  _sector = (uint8_t*)malloc(ESP32FW_SECTOR_SIZE);
+  if (!_sector) {
+    return fail("Not enough memory for the sector buffer");
+  }
+  return true;
+}
+
+void ESP32FwSectorWriter::preErase(size_t size){
+  // A compressed image or delta patch grows past the announced size; the
+  // sectors beyond are erased as their data arrives
+  size_t end = (size + ESP32FW_SECTOR_SIZE - 1) & ~(size_t)(ESP32FW_SECTOR_SIZE - 1);
+  claimFlash();
+  _eraseEnd = min(end, _partitionSize);
+  releaseFlash();
+}
+
+bool ESP32FwSectorWriter::eraseStep(uint32_t budgetMs){
+  uint32_t start = millis();
+  do {
+    claimFlash();
+    // Never touch a sector that already holds written data
+    if (_erased < _offset) {
+      _erased = _offset;
+    }
+    if (!_sector || _error || _erased >= _eraseEnd) {
+      releaseFlash();
+      return false;
+    }
+    if (!eraseSector(_erased)) {
+      // Left to the write path, which reports the failure
+      _eraseEnd = _erased;
+      releaseFlash();
+      return false;
+    }
+    _erased += ESP32FW_SECTOR_SIZE;
+    _preErased++;
+    releaseFlash();
+  } while (millis() - start < budgetMs);
+  return isErasing();
+}
+
+bool ESP32FwSectorWriter::write(const uint8_t* data, size_t len){
+  if (_error) {
+    return false;
+  }
+  if (_offset + _sectorLen + len > _partitionSize) {
+    return fail("Image is larger than the target partition");
+  }
+  if (_target == TARGET_FIRMWARE && _offset == 0 && _sectorLen == 0 && len > 0 && data[0] != IMAGE_MAGIC) {
+    return fail("Not a firmware image");
+  }
+  while (len > 0) {
+    #if defined(ESP32)
+      // Whole sectors are compared and written in place; the ESP8266 flash
+      // API needs aligned buffers, so there everything goes through _sector
+      if (_sectorLen == 0 && len >= ESP32FW_SECTOR_SIZE) {
+        if (!commitSector(data, ESP32FW_SECTOR_SIZE)) {
+          return false;
+        }
+        data += ESP32FW_SECTOR_SIZE;
+        len -= ESP32FW_SECTOR_SIZE;
+        continue;
+      }
+    #endif
+    size_t n = min(len, (size_t)ESP32FW_SECTOR_SIZE - _sectorLen);
+    memcpy(_sector + _sectorLen, data, n);
+    _sectorLen += n;
+    data += n;
+    len -= n;
+    if (_sectorLen == ESP32FW_SECTOR_SIZE) {
+      _sectorLen = 0;
+      if (!commitSector(_sector, ESP32FW_SECTOR_SIZE)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool ESP32FwSectorWriter::finish(){
+  if (_error) {
+    return false;
+  }
+  if (_sectorLen > 0) {
+    // Pad the tail to a whole flash word; erased flash reads 0xFF anyway
+    size_t len = (_sectorLen + 3) & ~(size_t)3;
+    memset(_sector + _sectorLen, 0xFF, len - _sectorLen);
+    _sectorLen = 0;
+    if (!commitSector(_sector, len)) {
+      return false;
+    }
+  }
+  if (_offset == 0) {
+    return fail("No data written");
+  }
+  #if defined(ESP32)
+    // Checks the image (segments, checksum, appended hash) before switching
+    if (_target == TARGET_FIRMWARE && esp_ota_set_boot_partition(_partition) != ESP_OK) {
+      return fail("Firmware image failed verification");
+    }
+  #endif
+  return true;
+}
+
+void ESP32FwSectorWriter::end(){
+  claimFlash();
+  _eraseEnd = 0;
+  releaseFlash();
+  free(_sector);
+  _sector = nullptr;
+  _sectorLen = 0;
+}
+
+bool ESP32FwSectorWriter::commitSector(const uint8_t* data, size_t len){
+  claimFlash();
+  // A pre-erased sector is blank: nothing to compare, nothing to erase
+  bool erased = _offset < _erased;
+  if (!erased && _compareSectors && sectorMatches(data, len)) {
+    _skipped++;
+  } else {
+    if ((!erased && !eraseSector(_offset)) || !writeFlash(_offset, data, len)) {
+      releaseFlash();
+      return fail("Flash write failed");
+    }
+    _written++;
+  }
+  _offset += len;
+  releaseFlash();
+  return true;
+}
+
+bool ESP32FwSectorWriter::sectorMatches(const uint8_t* data, size_t len){
+  for (size_t pos = 0; pos < len; pos += sizeof(_compare)) {
+    size_t n = min(len - pos, sizeof(_compare));
+    if (!readFlash(_offset + pos, _compare, n) || memcmp(_compare, data + pos, n) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ESP32FwSectorWriter::readFlash(size_t offset, uint32_t* data, size_t len){
+  #if defined(ESP32)
+    return esp_partition_read(_partition, offset, data, len) == ESP_OK;
+  #elif defined(ESP8266)
+    return ESP.flashRead((size_t)&_FS_start - FLASH_MAP_BASE + offset, data, len);
+  #else
+    return false;
+  #endif
+}
+
+bool ESP32FwSectorWriter::eraseSector(size_t offset){
+  #if defined(ESP32)
+    return esp_partition_erase_range(_partition, offset, ESP32FW_SECTOR_SIZE) == ESP_OK;
+  #elif defined(ESP8266)
+    return ESP.flashEraseSector(((size_t)&_FS_start - FLASH_MAP_BASE + offset) / ESP32FW_SECTOR_SIZE);
+  #else
+    return false;
+  #endif
+}
+
+bool ESP32FwSectorWriter::writeFlash(size_t offset, const uint8_t* data, size_t len){
+  #if defined(ESP32)
+    return esp_partition_write(_partition, offset, data, len) == ESP_OK;
+  #elif defined(ESP8266)
+    return ESP.flashWrite((size_t)&_FS_start - FLASH_MAP_BASE + offset, (const uint32_t*)data, len);
+  #else
+    return false;
+  #endif
+}
+
+void ESP32FwSectorWriter::claimFlash(){
+  // Held for at most one sector erase
+  while (_flashBusy.exchange(true)) {
+    delay(1);
+  }
+}
+
+bool ESP32FwSectorWriter::fail(const char* error){
+  if (!_error) {
+    _error = error;
+  }
+  return false;
+}
@@ -0,0 +1,96 @@
+#ifndef sector_writer_h
+#define sector_writer_h
+
+#include <Arduino.h>
+#include <atomic>
+
+#if defined(ESP32)
+#include <esp_partition.h>
+#endif
+
+// Erase unit of the SPI flash
+#define ESP32FW_SECTOR_SIZE 4096
+
+// Size of the buffer flash contents are read into for comparison
+#ifndef ESP32FW_SECTOR_COMPARE_SIZE
+  #define ESP32FW_SECTOR_COMPARE_SIZE 256
+#endif
+
+// Writes an image straight into its target partition, one flash sector at a
+// time, and leaves sectors that already hold the same bytes alone: each
+// sector is read back and compared first, and only a sector that differs is
+// erased and written. Images that change in a few places (file system images
+// with a handful of modified assets, or a firmware re-sent to the same slot)
+// then cost a flash read for most of the partition instead of an erase.
+//
+// Replaces Update for the whole update: finish() flushes the last partial
+// sector and, for firmware, verifies the image and makes it the boot
+// partition. Supported for firmware and file system on ESP32 and for the
+// file system on ESP8266, where firmware goes through the bootloader's copy.
+// A file system has no second partition to stage into: it is rewritten in
+// place as the data arrives and any digest is checked only after the last
+// sector, so a failed or interrupted update leaves it partly rewritten.
+//
+// When the image size is known in advance, preErase() plans to erase the
+// sectors it will occupy and eraseStep() erases them a few at a time from
+// the application's loop(), ahead of the data. Sectors erased that way are
+// written without an erase (or a comparison) when their data arrives.
+class ESP32FwSectorWriter{
+  public:
+    enum Target {
+      TARGET_FIRMWARE,
+      TARGET_FILESYSTEM
+    };
+
+    ESP32FwSectorWriter();
+    ~ESP32FwSectorWriter();
+    static bool supports(Target target);
+    static size_t partitionSize(Target target);
+    bool begin(Target target, size_t size);
+    void setCompare(bool enable) { _compareSectors = enable; }
+    void preErase(size_t size);
+    bool eraseStep(uint32_t budgetMs);
+    bool isErasing() const { return _eraseEnd > _erased; }
+    bool write(const uint8_t* data, size_t len);
+    bool finish();
+    void end();
+    bool isRunning() const { return _sector != nullptr; }
+    size_t progress() const { return _offset + _sectorLen; }
+    size_t sectorsWritten() const { return _written; }
+    size_t sectorsSkipped() const { return _skipped; }
+    size_t sectorsPreErased() const { return _preErased; }
+    const char* errorString() const { return _error; }
+
+  private:
+    Target _target = TARGET_FIRMWARE;
+#if defined(ESP32)
+    const esp_partition_t* _partition = nullptr;
+#endif
+    size_t _partitionSize = 0;
+    size_t _offset = 0;
+    uint8_t* _sector = nullptr;
+    size_t _sectorLen = 0;
+    size_t _written = 0;
+    size_t _skipped = 0;
+    bool _compareSectors = true;
+
+    // Pre-erase runs from loop() while writes may run in the async web
+    // server's task; both take _flashBusy around their flash operations
+    size_t _erased = 0;
+    size_t _eraseEnd = 0;
+    size_t _preErased = 0;
+    std::atomic<bool> _flashBusy{false};
+    uint32_t _compare[ESP32FW_SECTOR_COMPARE_SIZE / 4];
+    const char* _error = nullptr;
+
+    bool commitSector(const uint8_t* data, size_t len);
+    bool sectorMatches(const uint8_t* data, size_t len);
+    bool readFlash(size_t offset, uint32_t* data, size_t len);
+    bool eraseSector(size_t offset);
+    bool writeFlash(size_t offset, const uint8_t* data, size_t len);
+    void claimFlash();
+    void releaseFlash() { _flashBusy = false; }
+    bool fail(const char* error);
+};
+
+#endif
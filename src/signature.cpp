@@ -0,0 +1,150 @@
+#include "signature.h"
+#include "feature_flags.h"
+
+#if ESP32FW_FEATURE_SIGNING
+
+ESP32FwSignatureVerifier::ESP32FwSignatureVerifier(){
+  #if defined(ESP32)
+    mbedtls_pk_init(&_key);
+  #endif
+}
+
+ESP32FwSignatureVerifier::~ESP32FwSignatureVerifier(){
+  clearKey();
+}
+
+bool ESP32FwSignatureVerifier::setKey(const char* publicKeyPem){
+  clearKey();
+  if (!publicKeyPem || !*publicKeyPem) {
+    return true;
+  }
+  #if defined(ESP8266)
+    _key = new BearSSL::PublicKey(publicKeyPem);
+    if (!_key->isEC()) {
+      clearKey();
+      return false;
+    }
+  #elif defined(ESP32)
+    // The PEM parser wants the terminating NUL included in the length
+    int rc = mbedtls_pk_parse_public_key(&_key, (const unsigned char*)publicKeyPem, strlen(publicKeyPem) + 1);
+    if (rc != 0 || !mbedtls_pk_can_do(&_key, MBEDTLS_PK_ECKEY)) {
+      clearKey();
+      return false;
+    }
+    _keyLoaded = true;
+  #endif
+  return true;
+}
+
+bool ESP32FwSignatureVerifier::hasKey() const{
+  #if defined(ESP8266)
+    return _key != nullptr;
+  #elif defined(ESP32)
+    return _keyLoaded;
+  #else
+    return false;
+  #endif
+}
+
+void ESP32FwSignatureVerifier::clearKey(){
+  #if defined(ESP8266)
+    delete _key;
+    _key = nullptr;
+  #elif defined(ESP32)
+    mbedtls_pk_free(&_key);
+    mbedtls_pk_init(&_key);
+    _keyLoaded = false;
+  #endif
+}
+
+void ESP32FwSignatureVerifier::begin(Output output){
+  _running = true;
+  _output = output;
+  _heldLen = 0;
+  _error = nullptr;
+  _sha.begin();
+}
+
+bool ESP32FwSignatureVerifier::write(uint8_t* data, size_t len){
+  // Keep the last sizeof(_held) bytes back; everything before them is image
+  size_t total = _heldLen + len;
+  if (total > sizeof(_held)) {
+    size_t release = total - sizeof(_held);
+    size_t fromHeld = min(release, _heldLen);
+    if (fromHeld > 0) {
+      if (!emit(_held, fromHeld)) {
+        return false;
+      }
+      memmove(_held, _held + fromHeld, _heldLen - fromHeld);
+      _heldLen -= fromHeld;
+    }
+    size_t fromData = release - fromHeld;
+    if (fromData > 0 && !emit(data, fromData)) {
+      return false;
+    }
+    data += fromData;
+    len -= fromData;
+  }
+  memcpy(_held + _heldLen, data, len);
+  _heldLen += len;
+  return true;
+}
+
+bool ESP32FwSignatureVerifier::finish(){
+  if (_heldLen < ESP32FW_SIGNATURE_LENGTH_SIZE) {
+    return fail("Image is not signed");
+  }
+  const uint8_t* p = _held + _heldLen - ESP32FW_SIGNATURE_LENGTH_SIZE;
+  uint32_t sigLen = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+  if (sigLen == 0 || sigLen > _heldLen - ESP32FW_SIGNATURE_LENGTH_SIZE) {
+    return fail("Image is not signed");
+  }
+  size_t imageLeft = _heldLen - ESP32FW_SIGNATURE_LENGTH_SIZE - sigLen;
+  if (imageLeft > 0 && !emit(_held, imageLeft)) {
+    return false;
+  }
+  uint8_t hash[ESP32FW_SHA256_SIZE];
+  _sha.finish(hash);
+  if (!verify(hash, _held + imageLeft, sigLen)) {
+    return fail("Signature verification failed");
+  }
+  _running = false;
+  return true;
+}
+
+void ESP32FwSignatureVerifier::end(){
+  _running = false;
+  _output = nullptr;
+  _heldLen = 0;
+}
+
+bool ESP32FwSignatureVerifier::emit(uint8_t* data, size_t len){
+  _sha.update(data, len);
+  if (!_output(data, len)) {
+    return fail("Failed to write image data");
+  }
+  return true;
+}
+
+bool ESP32FwSignatureVerifier::verify(const uint8_t* hash, const uint8_t* signature, size_t len){
+  if (!hasKey()) {
+    return false;
+  }
+  #if defined(ESP8266)
+    br_ecdsa_vrfy vrfy = br_ecdsa_vrfy_asn1_get_default();
+    return vrfy(br_ec_get_default(), hash, ESP32FW_SHA256_SIZE, _key->getEC(), signature, len) == 1;
+  #elif defined(ESP32)
+    return mbedtls_pk_verify(&_key, MBEDTLS_MD_SHA256, hash, ESP32FW_SHA256_SIZE, signature, len) == 0;
+  #else
+    return false;
+  #endif
+}
+
+bool ESP32FwSignatureVerifier::fail(const char* error){
+  if (!_error) {
+    _error = error;
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef signature_h
+#define signature_h
+
+#include <Arduino.h>
+#include <functional>
+#include "digest.h"
+
+#if defined(ESP8266)
+  #include <BearSSLHelpers.h>
+#elif defined(ESP32)
+  #include <mbedtls/pk.h>
+#endif
+
+// Signed images written by tools/sign_firmware.py carry a trailer, the same
+// layout ESP8266 signed updates use (integers little endian):
+//
+//   image | signature | signature length (u32)
+//
+// The signature is ECDSA over the SHA-256 of the image, DER encoded.
+#define ESP32FW_SIGNATURE_LENGTH_SIZE 4
+
+// Largest DER-encoded signature accepted (ECDSA P-521)
+#ifndef ESP32FW_SIGNATURE_MAX_SIZE
+  #define ESP32FW_SIGNATURE_MAX_SIZE 139
+#endif
+
+// Verifies a signed image while it streams through. The image is hashed and
+// passed on to the output callback as it arrives; only the last bytes, which
+// may turn out to be the trailer, are held back. finish() releases the rest
+// of the image and checks the signature once.
+class ESP32FwSignatureVerifier{
+  public:
+    typedef std::function<bool(uint8_t* data, size_t len)> Output;
+
+    ESP32FwSignatureVerifier();
+    ~ESP32FwSignatureVerifier();
+    bool setKey(const char* publicKeyPem);
+    bool hasKey() const;
+    void begin(Output output);
+    bool write(uint8_t* data, size_t len);
+    bool finish();
+    void end();
+    bool isRunning() const { return _running; }
+    const char* errorString() const { return _error; }
+
+  private:
+#if defined(ESP8266)
+    BearSSL::PublicKey* _key = nullptr;
+#elif defined(ESP32)
+    mbedtls_pk_context _key;
+    bool _keyLoaded = false;
+#endif
+    bool _running = false;
+    Output _output;
+    ESP32FwSha256 _sha;
+    uint8_t _held[ESP32FW_SIGNATURE_MAX_SIZE + ESP32FW_SIGNATURE_LENGTH_SIZE];
+    size_t _heldLen = 0;
+    const char* _error = nullptr;
+
+    void clearKey();
+    bool emit(uint8_t* data, size_t len);
+    bool verify(const uint8_t* hash, const uint8_t* signature, size_t len);
+    bool fail(const char* error);
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef transport_h
+#define transport_h
+
+#include <Arduino.h>
+#include <functional>
+
+enum ESP32Fw_Method {
+    ESP32FW_HTTP_GET = 0,
+    ESP32FW_HTTP_POST,
+    ESP32FW_HTTP_PUT
+};
+
+enum ESP32Fw_UploadStatus {
+    ESP32FW_UPLOAD_START = 0,
+    ESP32FW_UPLOAD_WRITE,
+    ESP32FW_UPLOAD_END,
+    ESP32FW_UPLOAD_ABORTED
+};
+
+// One HTTP request as seen by the uploader. Headers added with sendHeader()
+// go out with the next send().
+class ESP32FwRequest{
+  public:
+    virtual ~ESP32FwRequest(){}
+    // Identifies the request across the calls of one upload
+    virtual const void* id() = 0;
+    virtual bool hasArg(const char* name) = 0;
+    virtual String arg(const char* name) = 0;
+    virtual String header(const char* name) = 0;
+    virtual size_t contentLength() = 0;
+    virtual bool authenticate(const char* username, const char* password) = 0;
+    virtual void requestAuthentication() = 0;
+    // Refuses an upload from its body callback after a response has been
+    // sent: the rest of the body no longer reaches the upload handler and
+    // the request handler does not run. The server closes the connection
+    // once it is done with it, never from inside the callback.
+    virtual void reject() = 0;
+    virtual void sendHeader(const char* name, const String& value) = 0;
+    virtual void send(int code, const char* contentType = nullptr, const String& content = String()) = 0;
+    virtual void send_P(int code, const char* contentType, const uint8_t* content, size_t length) = 0;
+};
+
+typedef std::function<void(ESP32FwRequest& request)> ESP32FwRequestHandler;
+typedef std::function<void(ESP32FwRequest& request, ESP32Fw_UploadStatus status, uint8_t* data, size_t len)> ESP32FwUploadHandler;
+
+// The web server underneath the uploader. Upload handlers get the body of a
+// multipart upload as START, one WRITE per received piece and END, or
+// ABORTED when the client goes away; the request handler runs after END.
+// Raw routes hand over a body that is not a form (application/octet-stream)
+// the same way, as it is read and without any multipart parsing. Event
+// streams are Server-Sent Events endpoints the uploader publishes to.
+//
+// Every handler runs with lock() held. A backend whose handlers run in a
+// task of their own makes it a recursive mutex, so the uploader can take it
+// in loop() and keep its own work from interleaving with a request; for one
+// that runs them inside the application's loop() it costs nothing.
+class ESP32FwTransport{
+  public:
+    virtual ~ESP32FwTransport(){}
+    virtual void collectHeaders(const char** names, size_t count) {}
+    virtual void on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler) = 0;
+    virtual void on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler upload) = 0;
+    virtual void onRaw(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler body) = 0;
+    virtual void setCredentials(const char* username, const char* password) {}
+    virtual void onEventStream(const char* uri, std::function<void()> connected) = 0;
+    virtual void sendEvent(const char* event, const char* data) = 0;
+    virtual void loop() {}
+    virtual void end() {}
+    virtual void lock() {}
+    virtual void unlock() {}
+};
+
+// Holds the transport's lock for a scope; a missing transport has none
+class ESP32FwTransportLock{
+  public:
+    ESP32FwTransportLock(ESP32FwTransport* transport) : _transport(transport) {
+      if (_transport) {
+        _transport->lock();
+      }
+    }
+    ~ESP32FwTransportLock() {
+      if (_transport) {
+        _transport->unlock();
+      }
+    }
+
+  private:
+    ESP32FwTransport* _transport;
+};
+
+#endif
@@ -0,0 +1,201 @@
+#include "transport_async.h"
+
+#if defined(ESP32FW_ASYNC_WEBSERVER)
+static WebRequestMethod toRequestMethod(ESP32Fw_Method method){
+  switch (method) {
+    case ESP32FW_HTTP_POST:
+      return HTTP_POST;
+    case ESP32FW_HTTP_PUT:
+      return HTTP_PUT;
+    default:
+      return HTTP_GET;
+  }
+}
+
+// Set by reject(); checked before every call into the uploader
+static bool isRejected(AsyncWebServerRequest* req){
+  ESP32FwAsyncBody* body = (ESP32FwAsyncBody*)req->_tempObject;
+  return body && body->rejected;
+}
+
+bool ESP32FwAsyncRequest::hasArg(const char* name){
+  return _request->hasArg(name);
+}
+
+String ESP32FwAsyncRequest::arg(const char* name){
+  return _request->arg(name);
+}
+
+String ESP32FwAsyncRequest::header(const char* name){
+  const AsyncWebHeader* header = _request->getHeader(name);
+  return header ? header->value() : String();
+}
+
+size_t ESP32FwAsyncRequest::contentLength(){
+  return _request->contentLength();
+}
+
+bool ESP32FwAsyncRequest::authenticate(const char* username, const char* password){
+  return _request->authenticate(username, password);
+}
+
+void ESP32FwAsyncRequest::requestAuthentication(){
+  _request->requestAuthentication();
+}
+
+void ESP32FwAsyncRequest::reject(){
+  // Closing the client here would free the request under the server's own
+  // body parser; the response already sent ends the exchange instead
+  ESP32FwAsyncBody* body = (ESP32FwAsyncBody*)_request->_tempObject;
+  if (body) {
+    body->rejected = true;
+  }
+}
+
+void ESP32FwAsyncRequest::sendHeader(const char* name, const String& value){
+  if (_headerCount < ESP32FW_ASYNC_MAX_HEADERS) {
+    _headerNames[_headerCount] = name;
+    _headerValues[_headerCount] = value;
+    _headerCount++;
+  }
+}
+
+void ESP32FwAsyncRequest::send(int code, const char* contentType, const String& content){
+  send(_request->beginResponse(code, contentType ? contentType : "", content));
+}
+
+void ESP32FwAsyncRequest::send_P(int code, const char* contentType, const uint8_t* content, size_t length){
+  send(_request->beginResponse_P(code, contentType, content, length));
+}
+
+void ESP32FwAsyncRequest::send(AsyncWebServerResponse* response){
+  for (size_t i = 0; i < _headerCount; i++) {
+    response->addHeader(_headerNames[i], _headerValues[i]);
+  }
+  _headerCount = 0;
+  _request->send(response);
+}
+
+ESP32FwAsyncTransport::ESP32FwAsyncTransport(){
+  _lock = xSemaphoreCreateRecursiveMutex();
+}
+
+ESP32FwAsyncTransport::~ESP32FwAsyncTransport(){
+  delete _events;
+  if (_lock) {
+    vSemaphoreDelete(_lock);
+  }
+}
+
+void ESP32FwAsyncTransport::on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler){
+  _server->on(uri, toRequestMethod(method), [this, handler](AsyncWebServerRequest* req){
+    ESP32FwTransportLock lock(this);
+    ESP32FwAsyncRequest request(req);
+    handler(request);
+  });
+}
+
+void ESP32FwAsyncTransport::on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler upload){
+  _server->on(uri, toRequestMethod(method), [this, handler](AsyncWebServerRequest* req){
+    handleRequest(req, handler);
+  }, [this, upload](AsyncWebServerRequest* req, const String& filename, size_t index, uint8_t* data, size_t len, bool final){
+    receiveBody(req, upload, index, data, len, final);
+  });
+}
+
+void ESP32FwAsyncTransport::onRaw(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler body){
+  _server->on(uri, toRequestMethod(method), [this, handler](AsyncWebServerRequest* req){
+    handleRequest(req, handler);
+  }, nullptr, [this, body](AsyncWebServerRequest* req, uint8_t* data, size_t len, size_t index, size_t total){
+    receiveBody(req, body, index, data, len, index + len >= total);
+  });
+}
+
+void ESP32FwAsyncTransport::handleRequest(AsyncWebServerRequest* req, const ESP32FwRequestHandler& handler){
+  ESP32FwTransportLock lock(this);
+  if (isRejected(req)) {
+    return;
+  }
+  ESP32FwAsyncRequest request(req);
+  handler(request);
+}
+
+void ESP32FwAsyncTransport::receiveBody(AsyncWebServerRequest* req, const ESP32FwUploadHandler& upload,
+                                        size_t index, uint8_t* data, size_t len, bool final){
+  ESP32FwTransportLock lock(this);
+  ESP32FwAsyncRequest request(req);
+  if (index == 0) {
+    req->_tempObject = calloc(1, sizeof(ESP32FwAsyncBody));
+    req->onDisconnect([this, req, upload](){
+      ESP32FwTransportLock lock(this);
+      ESP32FwAsyncBody* body = (ESP32FwAsyncBody*)req->_tempObject;
+      if (body && !body->complete && !isRejected(req)) {
+        ESP32FwAsyncRequest request(req);
+        upload(request, ESP32FW_UPLOAD_ABORTED, nullptr, 0);
+      }
+    });
+    upload(request, ESP32FW_UPLOAD_START, nullptr, 0);
+  }
+  if (len > 0 && !isRejected(req)) {
+    upload(request, ESP32FW_UPLOAD_WRITE, data, len);
+  }
+  if (final && !isRejected(req)) {
+    ESP32FwAsyncBody* body = (ESP32FwAsyncBody*)req->_tempObject;
+    if (body) {
+      body->complete = true;
+    }
+    upload(request, ESP32FW_UPLOAD_END, nullptr, 0);
+  }
+}
+
+void ESP32FwAsyncTransport::setCredentials(const char* username, const char* password){
+  _username = username ? username : "";
+  _password = password ? password : "";
+  if (_events) {
+    _events->setAuthentication(_username.c_str(), _password.c_str());
+  }
+}
+
+void ESP32FwAsyncTransport::onEventStream(const char* uri, std::function<void()> connected){
+  _events = new AsyncEventSource(uri);
+  _events->setAuthentication(_username.c_str(), _password.c_str());
+  _connected = connected;
+  _events->onConnect([this](AsyncEventSourceClient* client){
+    _connectPending = true;
+  });
+  _server->addHandler(_events);
+}
+
+void ESP32FwAsyncTransport::sendEvent(const char* event, const char* data){
+  if (_events && _events->count() > 0) {
+    _events->send(data, event, millis());
+  }
+}
+
+void ESP32FwAsyncTransport::loop(){
+  if (_connectPending) {
+    _connectPending = false;
+    if (_connected) {
+      _connected();
+    }
+  }
+}
+
+void ESP32FwAsyncTransport::lock(){
+  if (_lock) {
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+  }
+}
+
+void ESP32FwAsyncTransport::unlock(){
+  if (_lock) {
+    xSemaphoreGiveRecursive(_lock);
+  }
+}
+
+void ESP32FwAsyncTransport::end(){
+  if (_events) {
+    _events->close();
+  }
+}
+#endif
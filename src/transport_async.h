@@ -0,0 +1,83 @@
+#ifndef transport_async_h
+#define transport_async_h
+
+#include "transport.h"
+
+#if defined(ESP32FW_ASYNC_WEBSERVER)
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Headers a response can carry besides the ones the server adds
+#define ESP32FW_ASYNC_MAX_HEADERS 4
+
+// What the uploader knows about a request body, kept in the request's
+// _tempObject, which the request frees
+struct ESP32FwAsyncBody{
+  bool complete;   // a disconnect before this is an aborted upload
+  bool rejected;   // the rest of the body and the request handler are skipped
+};
+
+class ESP32FwAsyncRequest : public ESP32FwRequest{
+  public:
+    ESP32FwAsyncRequest(AsyncWebServerRequest* request) : _request(request) {}
+    const void* id() override { return _request; }
+    bool hasArg(const char* name) override;
+    String arg(const char* name) override;
+    String header(const char* name) override;
+    size_t contentLength() override;
+    bool authenticate(const char* username, const char* password) override;
+    void requestAuthentication() override;
+    void reject() override;
+    void sendHeader(const char* name, const String& value) override;
+    void send(int code, const char* contentType = nullptr, const String& content = String()) override;
+    void send_P(int code, const char* contentType, const uint8_t* content, size_t length) override;
+
+  private:
+    AsyncWebServerRequest* _request;
+    String _headerNames[ESP32FW_ASYNC_MAX_HEADERS];
+    String _headerValues[ESP32FW_ASYNC_MAX_HEADERS];
+    size_t _headerCount = 0;
+
+    void send(AsyncWebServerResponse* response);
+};
+
+// Backend for ESPAsyncWebServer. Handlers run in the async TCP task, so
+// uploads no longer hold up the application's loop(), and request bodies
+// arrive in TCP-segment sized pieces instead of through the synchronous
+// server's small upload buffer. Every callback takes a recursive mutex,
+// which the uploader also holds while loop() touches upload state. Event
+// streams are an AsyncEventSource; a new listener is greeted from loop(),
+// because the event source calls back with its own lock held.
+class ESP32FwAsyncTransport : public ESP32FwTransport{
+  public:
+    ESP32FwAsyncTransport();
+    ~ESP32FwAsyncTransport();
+    void setServer(AsyncWebServer* server) { _server = server; }
+    void on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler) override;
+    void on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler upload) override;
+    void onRaw(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler body) override;
+    void setCredentials(const char* username, const char* password) override;
+    void onEventStream(const char* uri, std::function<void()> connected) override;
+    void sendEvent(const char* event, const char* data) override;
+    void loop() override;
+    void end() override;
+    void lock() override;
+    void unlock() override;
+
+  private:
+    AsyncWebServer* _server = nullptr;
+    AsyncEventSource* _events = nullptr;
+    String _username;
+    String _password;
+    SemaphoreHandle_t _lock = nullptr;
+    std::function<void()> _connected;
+    volatile bool _connectPending = false;
+
+    void handleRequest(AsyncWebServerRequest* req, const ESP32FwRequestHandler& handler);
+    void receiveBody(AsyncWebServerRequest* req, const ESP32FwUploadHandler& upload,
+                     size_t index, uint8_t* data, size_t len, bool final);
+};
+#endif
+
+#endif
@@ -0,0 +1,291 @@
+#include "transport_sync.h"
+#include <vector>
+
+#if !defined(ESP32FW_ASYNC_WEBSERVER)
+#if defined(ESP32)
+  #include <lwip/sockets.h>
+#endif
+
+static const char STREAM_HEADER[] PROGMEM = "HTTP/1.1 200 OK\r\n"
+                                            "Content-Type: text/event-stream\r\n"
+                                            "Cache-Control: no-cache\r\n"
+                                            "Connection: keep-alive\r\n\r\n"
+                                            "retry: 2000\n\n";
+
+// Writes what the connection takes right now: the bytes sent, 0 when its
+// send buffer is full, -1 when it is gone
+static int sendNow(WiFiClient& client, const char* data, size_t len){
+  if (!client.connected()) {
+    return -1;
+  }
+  #if defined(ESP8266)
+    size_t room = client.availableForWrite();
+    return room == 0 ? 0 : (int)client.write((const uint8_t*)data, min(len, room));
+  #else
+    // WiFiClient::write() retries until everything is sent
+    int sent = lwip_send(client.fd(), data, len, MSG_DONTWAIT);
+    if (sent < 0) {
+      return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    }
+    return sent;
+  #endif
+}
+static HTTPMethod toHTTPMethod(ESP32Fw_Method method){
+  switch (method) {
+    case ESP32FW_HTTP_POST:
+      return HTTP_POST;
+    case ESP32FW_HTTP_PUT:
+      return HTTP_PUT;
+    default:
+      return HTTP_GET;
+  }
+}
+
+bool ESP32FwSyncRequest::hasArg(const char* name){
+  return _server->hasArg(name);
+}
+
+String ESP32FwSyncRequest::arg(const char* name){
+  return _server->arg(name);
+}
+
+String ESP32FwSyncRequest::header(const char* name){
+  return _server->header(name);
+}
+
+size_t ESP32FwSyncRequest::contentLength(){
+  int length = _server->clientContentLength();
+  return length > 0 ? length : 0;
+}
+
+bool ESP32FwSyncRequest::authenticate(const char* username, const char* password){
+  return _server->authenticate(username, password);
+}
+
+void ESP32FwSyncRequest::requestAuthentication(){
+  _server->requestAuthentication();
+}
+
+void ESP32FwSyncRequest::reject(){
+  if (_rejected) {
+    *_rejected = true;
+  }
+}
+
+void ESP32FwSyncRequest::sendHeader(const char* name, const String& value){
+  _server->sendHeader(name, value);
+}
+
+void ESP32FwSyncRequest::send(int code, const char* contentType, const String& content){
+  if (contentType) {
+    _server->send(code, contentType, content);
+  } else {
+    _server->send(code);
+  }
+}
+
+void ESP32FwSyncRequest::send_P(int code, const char* contentType, const uint8_t* content, size_t length){
+  _server->send_P(code, contentType, (PGM_P)content, length);
+}
+
+ESP32FwSyncTransport::ESP32FwSyncTransport(){}
+
+ESP32FwSyncTransport::~ESP32FwSyncTransport(){
+  end();
+}
+
+void ESP32FwSyncTransport::collectHeaders(const char** names, size_t count){
+  // Content-Type tells raw bodies from forms on raw routes
+  std::vector<const char*> all(names, names + count);
+  all.push_back("Content-Type");
+  _server->collectHeaders(all.data(), all.size());
+}
+
+void ESP32FwSyncTransport::on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler){
+  _server->on(uri, toHTTPMethod(method), [this, handler](){
+    ESP32FwSyncRequest request(_server, requestId());
+    handler(request);
+    nextRequest();
+  });
+}
+
+void ESP32FwSyncTransport::on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler upload){
+  _server->on(uri, toHTTPMethod(method), [this, handler](){
+    if (!_rejected) {
+      ESP32FwSyncRequest request(_server, requestId());
+      handler(request);
+    }
+    nextRequest();
+  }, [this, upload](){
+    // The server calls this for a raw body as well, with no upload to read
+    if (!_server->header("Content-Type").startsWith("multipart/")) {
+      return;
+    }
+    HTTPUpload& part = _server->upload();
+    ESP32FwSyncRequest request(_server, requestId(), &_rejected);
+    if (part.status == UPLOAD_FILE_ABORTED) {
+      // The handler does not run for a body that ended early
+      if (!_rejected) {
+        upload(request, ESP32FW_UPLOAD_ABORTED, nullptr, 0);
+      }
+      nextRequest();
+    } else if (_rejected) {
+      // The rest of a rejected body is read and dropped
+    } else if (part.status == UPLOAD_FILE_START) {
+      upload(request, ESP32FW_UPLOAD_START, nullptr, 0);
+    } else if (part.status == UPLOAD_FILE_WRITE) {
+      upload(request, ESP32FW_UPLOAD_WRITE, part.buf, part.currentSize);
+    } else if (part.status == UPLOAD_FILE_END) {
+      upload(request, ESP32FW_UPLOAD_END, nullptr, 0);
+    }
+  });
+}
+
+void ESP32FwSyncTransport::onRaw(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler body){
+  _server->on(uri, toHTTPMethod(method), [this, handler](){
+    if (!_rejected) {
+      ESP32FwSyncRequest request(_server, requestId());
+      handler(request);
+    }
+    nextRequest();
+  }, [this, body](){
+    // The server reads a raw body in HTTP_RAW_BUFLEN pieces but also calls
+    // this for the parts of a multipart form, which are not raw and dropped
+    if (_server->header("Content-Type").startsWith("multipart/")) {
+      return;
+    }
+    HTTPRaw& raw = _server->raw();
+    ESP32FwSyncRequest request(_server, requestId(), &_rejected);
+    if (raw.status == RAW_ABORTED) {
+      // The handler does not run for a body that ended early
+      if (!_rejected) {
+        body(request, ESP32FW_UPLOAD_ABORTED, nullptr, 0);
+      }
+      nextRequest();
+    } else if (_rejected) {
+      // The rest of a rejected body is read and dropped
+    } else if (raw.status == RAW_START) {
+      body(request, ESP32FW_UPLOAD_START, nullptr, 0);
+    } else if (raw.status == RAW_WRITE) {
+      body(request, ESP32FW_UPLOAD_WRITE, raw.buf, raw.currentSize);
+    } else if (raw.status == RAW_END) {
+      body(request, ESP32FW_UPLOAD_END, nullptr, 0);
+    }
+  });
+}
+
+void ESP32FwSyncTransport::nextRequest(){
+  _request++;
+  _rejected = false;
+}
+
+void ESP32FwSyncTransport::setCredentials(const char* username, const char* password){
+  _username = username ? username : "";
+  _password = password ? password : "";
+}
+
+void ESP32FwSyncTransport::onEventStream(const char* uri, std::function<void()> connected){
+  _server->on(uri, HTTP_GET, [this, connected]() mutable {
+    if (_username.length() > 0 && !_server->authenticate(_username.c_str(), _password.c_str())) {
+      return _server->requestAuthentication();
+    }
+    subscribe(connected);
+  });
+}
+
+void ESP32FwSyncTransport::subscribe(std::function<void()>& connected){
+  for (size_t i = 0; i < ESP32FW_PROGRESS_CLIENTS; i++) {
+    Listener& listener = _listeners[i];
+    if (listener.client && listener.client.connected()) {
+      continue;
+    }
+    drop(listener);
+    listener.buffer = (char*)malloc(ESP32FW_STREAM_BUFFER_SIZE);
+    if (!listener.buffer) {
+      break;
+    }
+    // The response is written by hand: the stream never ends, so it can
+    // have neither a length nor the web server's own completion
+    listener.client = _server->client();
+    listener.client.setNoDelay(true);
+    listener.length = strlen_P(STREAM_HEADER);
+    memcpy_P(listener.buffer, STREAM_HEADER, listener.length);
+    flush(listener);
+    _lastSent = millis();
+    if (connected) {
+      connected();
+    }
+    return;
+  }
+  _server->send(503, "text/plain", "Too many event listeners");
+}
+
+void ESP32FwSyncTransport::sendEvent(const char* event, const char* data){
+  char message[ESP32FW_STREAM_EVENT_SIZE];
+  int len = snprintf(message, sizeof(message), "event: %s\ndata: %s\n\n", event, data);
+  write(message, min(len, (int)sizeof(message) - 1));
+}
+
+void ESP32FwSyncTransport::loop(){
+  for (size_t i = 0; i < ESP32FW_PROGRESS_CLIENTS; i++) {
+    flush(_listeners[i]);
+  }
+  if (millis() - _lastSent >= ESP32FW_STREAM_HEARTBEAT_MS) {
+    write(":\n\n", 3);
+  }
+}
+
+void ESP32FwSyncTransport::end(){
+  for (size_t i = 0; i < ESP32FW_PROGRESS_CLIENTS; i++) {
+    if (_listeners[i].client) {
+      _listeners[i].client.stop();
+    }
+    drop(_listeners[i]);
+  }
+}
+
+void ESP32FwSyncTransport::write(const char* data, size_t len){
+  _lastSent = millis();
+  for (size_t i = 0; i < ESP32FW_PROGRESS_CLIENTS; i++) {
+    if (queue(_listeners[i], data, len)) {
+      flush(_listeners[i]);
+    }
+  }
+}
+
+bool ESP32FwSyncTransport::queue(Listener& listener, const char* data, size_t len){
+  if (!listener.buffer) {
+    return false;
+  }
+  // A listener that cannot keep up is dropped rather than waited for
+  if (len > ESP32FW_STREAM_BUFFER_SIZE - listener.length) {
+    listener.client.stop();
+    drop(listener);
+    return false;
+  }
+  memcpy(listener.buffer + listener.length, data, len);
+  listener.length += len;
+  return true;
+}
+
+void ESP32FwSyncTransport::flush(Listener& listener){
+  if (!listener.buffer || listener.length == 0) {
+    return;
+  }
+  int sent = sendNow(listener.client, listener.buffer, listener.length);
+  if (sent < 0) {
+    listener.client.stop();
+    drop(listener);
+  } else if (sent > 0) {
+    listener.length -= sent;
+    memmove(listener.buffer, listener.buffer + sent, listener.length);
+  }
+}
+
+void ESP32FwSyncTransport::drop(Listener& listener){
+  free(listener.buffer);
+  listener.buffer = nullptr;
+  listener.length = 0;
+  listener.client = WiFiClient();
+}
+#endif
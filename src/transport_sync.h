@@ -0,0 +1,104 @@
+#ifndef transport_sync_h
+#define transport_sync_h
+
+#include "transport.h"
+
+#if !defined(ESP32FW_ASYNC_WEBSERVER)
+#if defined(ESP8266)
+  #include <ESP8266WiFi.h>
+  #include <ESP8266WebServer.h>
+  typedef ESP8266WebServer ESP32FwSyncServer;
+#elif defined(ESP32)
+  #include <WiFi.h>
+  #include <WebServer.h>
+  typedef WebServer ESP32FwSyncServer;
+#endif
+
+// Number of browsers that can follow an event stream at the same time
+#ifndef ESP32FW_PROGRESS_CLIENTS
+  #define ESP32FW_PROGRESS_CLIENTS 2
+#endif
+
+// Longest event written to a stream, including the SSE framing
+#define ESP32FW_STREAM_EVENT_SIZE 288
+
+// Idle listeners get a comment line this often so dead connections are noticed
+#define ESP32FW_STREAM_HEARTBEAT_MS 15000
+
+// Output held for each listener while its connection cannot take more. A
+// listener that falls this far behind is dropped.
+#ifndef ESP32FW_STREAM_BUFFER_SIZE
+  #define ESP32FW_STREAM_BUFFER_SIZE 1024
+#endif
+
+class ESP32FwSyncRequest : public ESP32FwRequest{
+  public:
+    ESP32FwSyncRequest(ESP32FwSyncServer* server, const void* id, bool* rejected = nullptr)
+      : _server(server), _id(id), _rejected(rejected) {}
+    const void* id() override { return _id; }
+    bool hasArg(const char* name) override;
+    String arg(const char* name) override;
+    String header(const char* name) override;
+    size_t contentLength() override;
+    bool authenticate(const char* username, const char* password) override;
+    void requestAuthentication() override;
+    void reject() override;
+    void sendHeader(const char* name, const String& value) override;
+    void send(int code, const char* contentType = nullptr, const String& content = String()) override;
+    void send_P(int code, const char* contentType, const uint8_t* content, size_t length) override;
+
+  private:
+    ESP32FwSyncServer* _server;
+    const void* _id;
+    bool* _rejected;
+};
+
+// Backend for the synchronous WebServer / ESP8266WebServer. Handlers run
+// inside the application's server.handleClient(). Event streams keep the
+// request's connection open after the handler returns, so events reach the
+// browser while another request is handled. They are queued per listener
+// and sent only as far as the connection takes them without waiting; loop()
+// sends the rest, so a slow browser never stalls an upload.
+class ESP32FwSyncTransport : public ESP32FwTransport{
+  public:
+    ESP32FwSyncTransport();
+    ~ESP32FwSyncTransport();
+    void setServer(ESP32FwSyncServer* server) { _server = server; }
+    void collectHeaders(const char** names, size_t count) override;
+    void on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler) override;
+    void on(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler upload) override;
+    void onRaw(const char* uri, ESP32Fw_Method method, ESP32FwRequestHandler handler, ESP32FwUploadHandler body) override;
+    void setCredentials(const char* username, const char* password) override;
+    void onEventStream(const char* uri, std::function<void()> connected) override;
+    void sendEvent(const char* event, const char* data) override;
+    void loop() override;
+    void end() override;
+
+  private:
+    ESP32FwSyncServer* _server = nullptr;
+    String _username;
+    String _password;
+    struct Listener{
+      WiFiClient client;
+      char* buffer = nullptr;
+      size_t length = 0;
+    };
+    Listener _listeners[ESP32FW_PROGRESS_CLIENTS];
+    unsigned long _lastSent = 0;
+    // The server handles one request at a time. Each gets a number of its
+    // own, so the uploader never takes a new request for the one before it.
+    uintptr_t _request = 1;
+    // The current request was refused from its body callback
+    bool _rejected = false;
+
+    const void* requestId() const { return (const void*)_request; }
+    void nextRequest();
+    void subscribe(std::function<void()>& connected);
+    void write(const char* data, size_t len);
+    bool queue(Listener& listener, const char* data, size_t len);
+    void flush(Listener& listener);
+    void drop(Listener& listener);
+};
+#endif
+
+#endif
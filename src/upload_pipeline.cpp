@@ -0,0 +1,159 @@
+#include "upload_pipeline.h"
+
+#if defined(ESP32)
+
+// How long the receive side waits for a free slot / the writer to drain
+#define PIPELINE_WAIT_TIMEOUT_MS 10000
+#define PIPELINE_STOP_SLOT -1
+
+ESP32FwPipeline::ESP32FwPipeline(){}
+
+ESP32FwPipeline::~ESP32FwPipeline(){
+  end();
+}
+
+bool ESP32FwPipeline::begin(Output output, ESP32FwHistogram* writeLatency, size_t slotCount, size_t slotSize){
+  end();
+  _output = output;
+  _writeLatency = writeLatency;
+  _slotCount = slotCount;
+  _slotSize = slotSize;
+  _failed = false;
+  _fillSlot = -1;
+  _fillLen = 0;
+
+  _buffers = (uint8_t*)malloc(slotCount * slotSize);
+  _lengths = (size_t*)malloc(slotCount * sizeof(size_t));
+  _freeSlots = xQueueCreate(slotCount, sizeof(int));
+  _filledSlots = xQueueCreate(slotCount + 1, sizeof(int));
+  if (!_buffers || !_lengths || !_freeSlots || !_filledSlots) {
+    end();
+    return false;
+  }
+  for (int i = 0; i < (int)slotCount; i++) {
+    xQueueSend(_freeSlots, &i, 0);
+  }
+
+  // Run the writer on the core that is not serving the HTTP request
+#if portNUM_PROCESSORS > 1
+  BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+#else
+  BaseType_t core = tskNO_AFFINITY;
+#endif
+  if (xTaskCreatePinnedToCore(writerTask, "fwu_writer", 4096, this, uxTaskPriorityGet(NULL), &_task, core) != pdPASS) {
+    _task = nullptr;
+    end();
+    return false;
+  }
+  return true;
+}
+
+bool ESP32FwPipeline::write(const uint8_t* data, size_t len){
+  while (len > 0) {
+    if (_failed) {
+      return false;
+    }
+    if (_fillSlot < 0) {
+      // Backpressure: wait until the writer hands a slot back
+      if (xQueueReceive(_freeSlots, &_fillSlot, pdMS_TO_TICKS(PIPELINE_WAIT_TIMEOUT_MS)) != pdTRUE) {
+        _fillSlot = -1;
+        _failed = true;
+        return false;
+      }
+      _fillLen = 0;
+    }
+    size_t n = min(len, _slotSize - _fillLen);
+    memcpy(_buffers + _fillSlot * _slotSize + _fillLen, data, n);
+    _fillLen += n;
+    data += n;
+    len -= n;
+    if (_fillLen == _slotSize && !submitFillSlot()) {
+      return false;
+    }
+  }
+  return !_failed;
+}
+
+bool ESP32FwPipeline::flush(){
+  if (!_task) {
+    return false;
+  }
+  if (_fillSlot >= 0 && _fillLen > 0 && !submitFillSlot()) {
+    return false;
+  }
+  // All slots back in the free queue means everything has been written
+  unsigned long start = millis();
+  while (uxQueueMessagesWaiting(_freeSlots) + (_fillSlot >= 0 ? 1 : 0) < _slotCount) {
+    if (millis() - start > PIPELINE_WAIT_TIMEOUT_MS) {
+      _failed = true;
+      break;
+    }
+    vTaskDelay(1);
+  }
+  return !_failed;
+}
+
+void ESP32FwPipeline::end(){
+  if (_task) {
+    // Let the writer finish the slot in progress, then stop it
+    int stop = PIPELINE_STOP_SLOT;
+    xQueueSend(_filledSlots, &stop, portMAX_DELAY);
+    while (eTaskGetState(_task) != eSuspended) {
+      vTaskDelay(1);
+    }
+    vTaskDelete(_task);
+    _task = nullptr;
+  }
+  if (_freeSlots) {
+    vQueueDelete(_freeSlots);
+    _freeSlots = nullptr;
+  }
+  if (_filledSlots) {
+    vQueueDelete(_filledSlots);
+    _filledSlots = nullptr;
+  }
+  free(_buffers);
+  _buffers = nullptr;
+  free(_lengths);
+  _lengths = nullptr;
+  _fillSlot = -1;
+  _fillLen = 0;
+}
+
+bool ESP32FwPipeline::submitFillSlot(){
+  _lengths[_fillSlot] = _fillLen;
+  if (xQueueSend(_filledSlots, &_fillSlot, pdMS_TO_TICKS(PIPELINE_WAIT_TIMEOUT_MS)) != pdTRUE) {
+    _failed = true;
+    return false;
+  }
+  _fillSlot = -1;
+  _fillLen = 0;
+  return true;
+}
+
+void ESP32FwPipeline::writerTask(void* arg){
+  ESP32FwPipeline* self = (ESP32FwPipeline*)arg;
+  int slot;
+  for (;;) {
+    xQueueReceive(self->_filledSlots, &slot, portMAX_DELAY);
+    if (slot == PIPELINE_STOP_SLOT) {
+      break;
+    }
+    // After a failure keep draining so the receive side never deadlocks
+    if (!self->_failed) {
+      uint8_t* buf = self->_buffers + slot * self->_slotSize;
+      size_t len = self->_lengths[slot];
+      uint32_t start = micros();
+      if (!self->_output(buf, len)) {
+        self->_failed = true;
+      }
+      if (self->_writeLatency) {
+        self->_writeLatency->record(micros() - start);
+      }
+    }
+    xQueueSend(self->_freeSlots, &slot, portMAX_DELAY);
+  }
+  // Park here; end() deletes the task once it sees it suspended
+  vTaskSuspend(NULL);
+}
+#endif
@@ -0,0 +1,61 @@
+#ifndef upload_pipeline_h
+#define upload_pipeline_h
+
+#include <Arduino.h>
+#include <functional>
+#include "metrics.h"
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+// Default ring geometry: four flash-sector sized slots
+#ifndef ESP32FW_PIPELINE_SLOTS
+  #define ESP32FW_PIPELINE_SLOTS 4
+#endif
+#ifndef ESP32FW_PIPELINE_SLOT_SIZE
+  #define ESP32FW_PIPELINE_SLOT_SIZE 4096
+#endif
+
+// Decouples network receive from flash writes. Received data is copied into a
+// fixed ring of buffers and a writer task, pinned to the other core, drains
+// them into the output callback (Update, or the sector writer). write()
+// blocks while the ring is full (backpressure) and fails once the output has
+// failed. The writer records the latency of each output call into the given
+// histogram.
+class ESP32FwPipeline{
+  public:
+    typedef std::function<bool(uint8_t* data, size_t len)> Output;
+
+    ESP32FwPipeline();
+    ~ESP32FwPipeline();
+    bool begin(Output output, ESP32FwHistogram* writeLatency, size_t slotCount = ESP32FW_PIPELINE_SLOTS, size_t slotSize = ESP32FW_PIPELINE_SLOT_SIZE);
+    bool write(const uint8_t* data, size_t len);
+    bool flush();
+    void end();
+    bool isRunning() const { return _task != nullptr; }
+    bool hasFailed() const { return _failed; }
+
+  private:
+    uint8_t* _buffers = nullptr;
+    size_t* _lengths = nullptr;
+    size_t _slotCount = 0;
+    size_t _slotSize = 0;
+    QueueHandle_t _freeSlots = nullptr;
+    QueueHandle_t _filledSlots = nullptr;
+    TaskHandle_t _task = nullptr;
+    Output _output;
+    ESP32FwHistogram* _writeLatency = nullptr;
+    volatile bool _failed = false;
+
+    // Slot currently being filled by the receive side
+    int _fillSlot = -1;
+    size_t _fillLen = 0;
+
+    bool submitFillSlot();
+    static void writerTask(void* arg);
+};
+#endif
+
+#endif
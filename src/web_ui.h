@@ -35,8 +35,15 @@ extern const char* DARK_UPLOAD_AREA_DRAGOVER_COLOR;
 extern const char* DARK_FILE_INFO_BACKGROUND_COLOR;
 extern const char* DARK_FILE_INFO_TEXT_COLOR;
 
-// Function to get HTML content based on current mode
-const char* getWebUIHTML();
+// Pre-built web UI page stored in flash (gzip-compressed)
+struct WebUIAsset {
+    const uint8_t* data;   // gzip-compressed HTML (PROGMEM)
+    size_t length;
+    const char* etag;      // quoted ETag value
+};
+
+// Function to get the page for the current mode
+const WebUIAsset& getWebUIAsset();
 
 #endif
 
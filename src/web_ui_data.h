@@ -0,0 +1,927 @@
+// AUTO-GENERATED by tools/build_web_ui.py from tools/web_ui/index.html.
+// Do not edit by hand; re-run the script after changing the template,
+// the WEB_UI_* texts in web_ui.h or the color definitions in web_ui.cpp.
+
+#ifndef web_ui_data_h
+#define web_ui_data_h
+
+// light mode: 28696 bytes of HTML, 7262 bytes gzip-compressed
+#define WEB_UI_LIGHT_ETAG "\"25fd1e4d39852a45\""
+static const uint8_t WEB_UI_LIGHT_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3d, 0x6b, 0x73, 0xdb, 0x46,
+  0x92, 0xdf, 0xf3, 0x2b, 0x26, 0xda, 0x8a, 0x09, 0xc6, 0x14, 0x04, 0xf0, 0x4d, 0x51, 0x92, 0xcf,
+  0xcf, 0x38, 0x97, 0x87, 0x5d, 0x96, 0x9d, 0xec, 0x9e, 0x57, 0x97, 0x1a, 0x00, 0x03, 0x12, 0x6b,
+  0x10, 0xe0, 0x02, 0xa0, 0x64, 0x25, 0xab, 0xab, 0xba, 0xdf, 0x70, 0x3f, 0xe0, 0xfe, 0xe2, 0xfd,
+  0x84, 0xeb, 0xee, 0x19, 0x80, 0x78, 0x0c, 0x48, 0xca, 0x4e, 0xb6, 0xee, 0x98, 0x5a, 0x0b, 0x8f,
+  0x99, 0xee, 0x9e, 0xee, 0x9e, 0x7e, 0xcd, 0x0c, 0xf6, 0xec, 0xcb, 0x67, 0xaf, 0x9e, 0xbe, 0xfd,
+  0xcb, 0xeb, 0xe7, 0x6c, 0x99, 0xad, 0xc2, 0x8b, 0x2f, 0xce, 0xf0, 0x0f, 0x0b, 0x79, 0xb4, 0x38,
+  0x3f, 0x12, 0xd1, 0x11, 0x3e, 0x10, 0xdc, 0xbb, 0xf8, 0x82, 0xc1, 0xef, 0x6c, 0x25, 0x32, 0xce,
+  0xdc, 0x25, 0x4f, 0x52, 0x91, 0x9d, 0x1f, 0xbd, 0x7b, 0xfb, 0xe2, 0x78, 0x7a, 0x54, 0x7e, 0x15,
+  0xf1, 0x95, 0x38, 0x3f, 0xba, 0x0e, 0xc4, 0xcd, 0x3a, 0x4e, 0xb2, 0x23, 0xe6, 0xc6, 0x51, 0x26,
+  0x22, 0x68, 0x7a, 0x13, 0x78, 0xd9, 0xf2, 0xdc, 0x13, 0xd7, 0x81, 0x2b, 0x8e, 0xe9, 0xa6, 0xc7,
+  0x82, 0x28, 0xc8, 0x02, 0x1e, 0x1e, 0xa7, 0x2e, 0x0f, 0xc5, 0xb9, 0x6d, 0x5a, 0x39, 0xa8, 0x2c,
+  0xc8, 0x42, 0x71, 0xf1, 0xfc, 0xf2, 0xf5, 0xa0, 0xcf, 0x5e, 0x04, 0xc9, 0xea, 0x86, 0x27, 0x82,
+  0xbd, 0x5b, 0x87, 0x31, 0xf7, 0x44, 0x72, 0x76, 0x22, 0x5f, 0xcb, 0xa6, 0x69, 0x76, 0x9b, 0x5f,
+  0xe3, 0xef, 0x6b, 0xf6, 0x5b, 0x71, 0x8d, 0xbf, 0x15, 0x4f, 0x16, 0x41, 0x74, 0xca, 0xac, 0x79,
+  0xe5, 0xf1, 0x9a, 0x7b, 0x5e, 0x10, 0x2d, 0x1a, 0xcf, 0x9d, 0xf8, 0xe3, 0x71, 0x1a, 0xfc, 0x4a,
+  0xaf, 0x9c, 0x38, 0x01, 0x6c, 0xc7, 0xf0, 0x68, 0xdb, 0xe6, 0xae, 0xb8, 0xfa, 0x62, 0xdb, 0xc5,
+  0xbb, 0xad, 0x21, 0xf5, 0x61, 0xd0, 0xc7, 0x3e, 0x5f, 0x05, 0xe1, 0xed, 0x29, 0xeb, 0x5c, 0x8a,
+  0x45, 0x0c, 0xd4, 0x7f, 0xdb, 0xe9, 0xb1, 0xb7, 0x7c, 0x19, 0xaf, 0x78, 0x8f, 0x7d, 0x23, 0x22,
+  0x71, 0x0d, 0x7f, 0x7f, 0x12, 0x89, 0xc7, 0x23, 0xb8, 0x48, 0x79, 0x94, 0x1e, 0xa7, 0x22, 0x09,
+  0xfc, 0x1a, 0x3d, 0xdc, 0xfd, 0xb0, 0x48, 0xe2, 0x4d, 0xe4, 0x9d, 0xb2, 0x30, 0x88, 0x04, 0x4f,
+  0x8e, 0x17, 0x09, 0xf7, 0x02, 0x60, 0xa9, 0x61, 0x0f, 0x46, 0x9e, 0x58, 0xf4, 0xd8, 0x9f, 0xc6,
+  0xe3, 0x89, 0x10, 0x9c, 0x59, 0x5f, 0xc1, 0xf5, 0x64, 0x3c, 0x74, 0x78, 0x9f, 0xd9, 0x96, 0xf5,
+  0x55, 0xb7, 0x0a, 0x6a, 0x15, 0x44, 0xc7, 0x4b, 0x11, 0x2c, 0x96, 0xd9, 0x29, 0xbe, 0xbe, 0x5e,
+  0x56, 0x5f, 0x7b, 0x41, 0xba, 0x0e, 0x39, 0xd0, 0xeb, 0x87, 0xe2, 0x63, 0xf5, 0x15, 0x0f, 0x83,
+  0x45, 0x74, 0x1c, 0x64, 0x62, 0x95, 0x9e, 0x32, 0x17, 0x50, 0x8b, 0xa4, 0xda, 0xe0, 0x6f, 0x9b,
+  0x34, 0x0b, 0xfc, 0xdb, 0x63, 0x25, 0x6c, 0x7d, 0xa3, 0x82, 0xe5, 0x7d, 0x6b, 0xbd, 0x9b, 0xa3,
+  0x26, 0xc2, 0xe1, 0x30, 0xda, 0xa4, 0xc6, 0xd7, 0x32, 0x37, 0xfe, 0xf4, 0x82, 0x7e, 0x75, 0xf1,
+  0x91, 0xc8, 0x90, 0x43, 0x9b, 0xb4, 0x8e, 0xa9, 0x90, 0xef, 0x92, 0x7b, 0xf1, 0x0d, 0x88, 0x9e,
+  0xde, 0xb3, 0x21, 0xfe, 0x93, 0x2c, 0x1c, 0x6e, 0x58, 0x3d, 0xfa, 0xcf, 0xb4, 0xbb, 0x2d, 0x94,
+  0x0f, 0x1b, 0xf0, 0x56, 0xfc, 0xa3, 0x54, 0xe6, 0x53, 0x36, 0xb2, 0x1a, 0x6f, 0xd5, 0x1b, 0x14,
+  0x46, 0xf5, 0x45, 0x26, 0x3e, 0x66, 0xc7, 0xc4, 0xd6, 0x26, 0xaf, 0x74, 0x0c, 0x09, 0xe3, 0x45,
+  0xac, 0xd3, 0x31, 0x50, 0x55, 0x01, 0xc3, 0x34, 0x47, 0x62, 0x35, 0x6f, 0xbe, 0xbd, 0x51, 0xd2,
+  0x76, 0xe2, 0xd0, 0xab, 0xbe, 0x76, 0xe3, 0x30, 0x4e, 0x80, 0x87, 0x96, 0x35, 0x79, 0x52, 0xe7,
+  0xa1, 0x9c, 0x31, 0xa0, 0xf6, 0x59, 0x16, 0xaf, 0x90, 0xf8, 0x7d, 0xd2, 0x4a, 0x37, 0x0e, 0x4d,
+  0xc8, 0x1a, 0x81, 0x39, 0x8e, 0x01, 0xfd, 0x76, 0xe2, 0x18, 0x34, 0x38, 0x57, 0x1a, 0x9d, 0x6d,
+  0xda, 0xe5, 0xd1, 0xe9, 0x28, 0xd8, 0x90, 0x65, 0x38, 0x06, 0x23, 0xc1, 0xeb, 0x1a, 0x43, 0x0a,
+  0x01, 0x18, 0x40, 0xc6, 0x1e, 0x4f, 0x97, 0xc2, 0x63, 0x7f, 0xf2, 0x3c, 0x6f, 0xa7, 0xd6, 0xd8,
+  0xa3, 0x3a, 0x35, 0x15, 0x05, 0xd0, 0x68, 0x55, 0x6e, 0x64, 0x70, 0x1c, 0x75, 0x8b, 0x92, 0x25,
+  0x30, 0xb5, 0xc1, 0xcc, 0xc5, 0xf0, 0x9e, 0x87, 0x21, 0xb3, 0xcc, 0x41, 0xca, 0x04, 0x4f, 0x45,
+  0x4d, 0x22, 0x9b, 0x24, 0x45, 0x76, 0xad, 0xe3, 0x40, 0x33, 0x75, 0xe2, 0x1c, 0x42, 0x22, 0x42,
+  0x9e, 0x05, 0xd7, 0xe2, 0x60, 0x7e, 0x9c, 0x2e, 0xe3, 0xeb, 0xe6, 0x3c, 0x92, 0x03, 0xde, 0xa5,
+  0x05, 0xdb, 0xa9, 0x56, 0x34, 0xf3, 0xa7, 0xfe, 0xcc, 0xf7, 0x0f, 0xc6, 0x6c, 0x7a, 0x09, 0x5f,
+  0xfc, 0x7e, 0xc8, 0x2d, 0x7f, 0xe8, 0xfb, 0x1a, 0xd6, 0xfa, 0x71, 0x02, 0x1a, 0x44, 0x1e, 0xc4,
+  0x00, 0x0f, 0xd2, 0xef, 0x1e, 0x44, 0x60, 0x00, 0x26, 0xa6, 0x7d, 0x42, 0x0d, 0xea, 0xd3, 0x29,
+  0xa7, 0xa2, 0xa1, 0x3a, 0xf5, 0xc9, 0x32, 0xda, 0x37, 0x59, 0x14, 0x7e, 0x34, 0x00, 0xf7, 0x98,
+  0x2f, 0xed, 0xd3, 0xe1, 0x93, 0x88, 0xf0, 0x83, 0x50, 0x1c, 0x07, 0xd1, 0x7a, 0x53, 0xa7, 0xa1,
+  0x70, 0x02, 0x51, 0x1c, 0xed, 0xd1, 0x31, 0x27, 0x8b, 0x76, 0x59, 0x67, 0x9d, 0x58, 0xf3, 0x11,
+  0xb6, 0x5b, 0xee, 0x3a, 0xe2, 0xca, 0xe4, 0xc3, 0x71, 0x69, 0x4c, 0x45, 0xdd, 0xe6, 0x8f, 0x0e,
+  0xb7, 0x25, 0x7b, 0x27, 0xde, 0x81, 0x93, 0x37, 0x9f, 0xff, 0x76, 0xd3, 0x32, 0x80, 0x5c, 0x72,
+  0x2f, 0xb0, 0xdf, 0xef, 0x01, 0x4f, 0xb5, 0xf3, 0xb5, 0xa4, 0xe8, 0x74, 0x09, 0x36, 0x40, 0xfc,
+  0xc5, 0x38, 0xee, 0xaf, 0x3f, 0x76, 0x77, 0xb9, 0x37, 0x3b, 0xb7, 0x56, 0xd2, 0xbd, 0xd9, 0x56,
+  0xbf, 0x07, 0x54, 0x8c, 0x7b, 0xac, 0x3f, 0x18, 0xf6, 0x70, 0x2c, 0xdd, 0xfd, 0xe4, 0x80, 0x46,
+  0x70, 0x27, 0x04, 0xb3, 0x59, 0xa5, 0x28, 0x5e, 0x73, 0x37, 0xc8, 0x40, 0x51, 0x2c, 0x73, 0xac,
+  0xe7, 0x67, 0x14, 0xa3, 0x87, 0x0b, 0xe3, 0x1b, 0xe1, 0xb5, 0xce, 0xda, 0xfd, 0x5a, 0xb6, 0x4e,
+  0xe2, 0x45, 0x22, 0xd2, 0xf4, 0xb8, 0x2d, 0x24, 0xc8, 0x59, 0xdf, 0xd7, 0x98, 0xde, 0x7b, 0x68,
+  0x73, 0x81, 0xc7, 0xe1, 0x75, 0x0c, 0xad, 0x4e, 0x3c, 0x0f, 0xa6, 0x34, 0x51, 0x86, 0xd6, 0x7e,
+  0xc1, 0x7f, 0xbb, 0xfd, 0x4e, 0x03, 0x0e, 0xaa, 0x82, 0x1f, 0xa2, 0x30, 0x97, 0x81, 0xe7, 0x89,
+  0xe8, 0x33, 0x1d, 0x75, 0x31, 0x48, 0x98, 0xff, 0x61, 0x6d, 0x94, 0xa5, 0xc8, 0xf0, 0xab, 0xf9,
+  0xfd, 0xa6, 0xb5, 0x62, 0x50, 0x23, 0xc6, 0x29, 0xcd, 0x1d, 0x6a, 0xa2, 0x9b, 0x3d, 0x3b, 0xc9,
+  0xfc, 0x74, 0x23, 0x69, 0x99, 0xb3, 0x7d, 0x31, 0x43, 0x9a, 0xf1, 0x6c, 0x93, 0xde, 0x43, 0x9b,
+  0x2a, 0x76, 0xe8, 0x9e, 0x82, 0xbc, 0x87, 0x26, 0x4a, 0xba, 0x20, 0xa8, 0x72, 0x5d, 0xe0, 0x41,
+  0xab, 0x89, 0x2d, 0x14, 0xcb, 0x1b, 0x0a, 0xcf, 0xe3, 0x7a, 0x43, 0x6b, 0x8f, 0x46, 0x93, 0xfe,
+  0x50, 0x6f, 0x68, 0x6d, 0x18, 0x61, 0x1a, 0x87, 0x01, 0x04, 0x44, 0xee, 0x40, 0x8c, 0x5d, 0xe7,
+  0x20, 0xb2, 0x44, 0x92, 0xc4, 0xc9, 0x7e, 0xa2, 0xfc, 0xa9, 0x37, 0x69, 0x23, 0x6a, 0xd2, 0xb7,
+  0xdd, 0x03, 0x88, 0xf2, 0x47, 0xee, 0x5e, 0xa2, 0x56, 0xb1, 0x27, 0x20, 0x6b, 0x0a, 0x85, 0x9b,
+  0xc5, 0x87, 0x1a, 0x86, 0xfd, 0x70, 0x42, 0xee, 0x88, 0xb0, 0xcd, 0x31, 0x06, 0x11, 0xa6, 0x61,
+  0xc7, 0x4e, 0x18, 0xbb, 0x1f, 0xf4, 0x4e, 0xc0, 0xd2, 0x28, 0xc8, 0x4e, 0x27, 0xd3, 0xa6, 0xd3,
+  0xfb, 0x29, 0x25, 0x17, 0xfe, 0x3e, 0xbb, 0x5d, 0x43, 0xca, 0x8d, 0xca, 0x17, 0x1f, 0x5d, 0xf5,
+  0x0e, 0x69, 0xeb, 0x2e, 0x85, 0xfb, 0x01, 0x7c, 0xc5, 0xd1, 0x95, 0x96, 0x69, 0xc7, 0x89, 0xb4,
+  0x05, 0x87, 0xc6, 0x11, 0x7e, 0x7c, 0x88, 0x46, 0x40, 0xf0, 0xc8, 0xef, 0x39, 0x6d, 0x76, 0x4c,
+  0xb9, 0xc2, 0xe5, 0x8e, 0x3e, 0xcb, 0xee, 0xd3, 0x08, 0xb0, 0x66, 0xa1, 0x0b, 0x06, 0xf7, 0xe7,
+  0x4f, 0x07, 0xe4, 0x36, 0x87, 0x31, 0x11, 0xcd, 0xd6, 0x1f, 0x65, 0xea, 0xfe, 0x65, 0x25, 0xbc,
+  0x80, 0x33, 0xa3, 0x94, 0xab, 0x8e, 0x31, 0x57, 0xed, 0xd6, 0x10, 0xb6, 0xa6, 0xdd, 0x3b, 0xb2,
+  0xf7, 0xfd, 0x11, 0xd0, 0x5d, 0xe5, 0xae, 0x8a, 0x50, 0x93, 0xd6, 0xd6, 0x53, 0xdb, 0x7a, 0xb8,
+  0xb6, 0x0b, 0x5c, 0x7b, 0x1a, 0x58, 0x19, 0x01, 0x65, 0x69, 0x4d, 0x8d, 0xba, 0xab, 0xf1, 0xf0,
+  0xec, 0x44, 0x95, 0x96, 0xce, 0x4e, 0x64, 0xfd, 0xeb, 0x0c, 0x2b, 0x3d, 0xaa, 0xea, 0xe4, 0x05,
+  0xd7, 0xcc, 0x0d, 0x79, 0x9a, 0xc2, 0x64, 0xca, 0xb9, 0x76, 0xb4, 0xad, 0x42, 0x95, 0xdf, 0xe3,
+  0x20, 0x8f, 0x64, 0x2d, 0xeb, 0xc5, 0xcd, 0xb6, 0x86, 0x05, 0x2d, 0xf4, 0xed, 0xf3, 0x74, 0xfa,
+  0xe8, 0xe2, 0x15, 0xb8, 0xff, 0xe3, 0xb7, 0x4b, 0x71, 0xfc, 0x38, 0x48, 0xd8, 0xbb, 0xb5, 0x07,
+  0x51, 0x1f, 0xbb, 0xbc, 0x4d, 0x33, 0xb1, 0xaa, 0x75, 0xd7, 0xc2, 0xa9, 0x4c, 0xff, 0x12, 0x6d,
+  0xd4, 0x8e, 0x6c, 0xdc, 0x45, 0x83, 0x47, 0x67, 0x32, 0x29, 0x28, 0x5b, 0x14, 0x55, 0xd1, 0x43,
+  0x68, 0x47, 0xec, 0x9a, 0x87, 0x1b, 0xb8, 0xe1, 0x9b, 0x0c, 0x5e, 0x90, 0x15, 0x11, 0x5e, 0x13,
+  0xca, 0x63, 0x78, 0x5d, 0x45, 0x77, 0xa2, 0xc1, 0xf7, 0x99, 0x34, 0xf8, 0xaa, 0x2c, 0x78, 0xd4,
+  0x84, 0x90, 0x57, 0x0c, 0xff, 0x09, 0x34, 0x84, 0x22, 0x25, 0x81, 0x68, 0xa9, 0xc8, 0x5f, 0xfe,
+  0x73, 0xe8, 0x68, 0x23, 0x61, 0x37, 0xf6, 0xfb, 0x6b, 0x12, 0x0b, 0x3c, 0x50, 0xd2, 0xdb, 0xc8,
+  0x7d, 0xb5, 0xc6, 0xe0, 0x2e, 0x3d, 0x62, 0x34, 0x4f, 0xce, 0x8f, 0xaa, 0x66, 0xf7, 0x53, 0x34,
+  0xae, 0xf0, 0x4b, 0x84, 0xc3, 0x03, 0x8c, 0x99, 0x78, 0x07, 0x0e, 0x17, 0x98, 0xe8, 0x69, 0x86,
+  0xf7, 0x8c, 0x1a, 0x30, 0x1a, 0x3d, 0xe6, 0x1b, 0xe0, 0xe3, 0x58, 0xb6, 0x84, 0x07, 0x60, 0xaf,
+  0x45, 0xf2, 0xf9, 0xe3, 0x2e, 0xd9, 0x13, 0x49, 0x91, 0x7c, 0xf0, 0x18, 0xef, 0x6b, 0xa3, 0x6b,
+  0xf6, 0xc2, 0x0a, 0xc3, 0xd1, 0xc5, 0xff, 0xfc, 0xf7, 0x7f, 0xfd, 0x67, 0x0d, 0x55, 0x4b, 0x7b,
+  0x0c, 0x76, 0xcb, 0x58, 0xde, 0xe2, 0xfd, 0xc5, 0xb3, 0x84, 0x2f, 0xd8, 0x03, 0xf6, 0x2c, 0x89,
+  0xd7, 0x24, 0xcd, 0x33, 0x27, 0xb9, 0x88, 0x13, 0xfc, 0xf7, 0x69, 0x18, 0xb8, 0x1f, 0x58, 0x16,
+  0xb3, 0x4b, 0x12, 0x8c, 0x7c, 0xab, 0xc1, 0x54, 0xe6, 0x2f, 0x72, 0xea, 0x28, 0xc7, 0xbb, 0x2d,
+  0x02, 0x48, 0xb4, 0x78, 0xff, 0xad, 0xbc, 0xe5, 0x10, 0x7b, 0xae, 0xb3, 0xf3, 0x23, 0xd3, 0x09,
+  0xa2, 0x9e, 0xb9, 0xf8, 0xb5, 0x67, 0x0a, 0xff, 0xc6, 0x39, 0xba, 0x1f, 0xf7, 0x8a, 0xe0, 0xa0,
+  0x0c, 0x1e, 0xee, 0xda, 0x39, 0x51, 0x38, 0xe3, 0x6d, 0x8f, 0x1f, 0xf1, 0xee, 0x62, 0x0f, 0x07,
+  0x0b, 0x0f, 0xba, 0xed, 0x77, 0x89, 0x77, 0xf5, 0x7e, 0xad, 0x54, 0x3b, 0x1b, 0xf0, 0xd5, 0x51,
+  0x0e, 0x0e, 0xd2, 0xde, 0xb2, 0x20, 0x9e, 0xe0, 0x6d, 0x9e, 0x06, 0x5f, 0x5c, 0x66, 0x3c, 0xc9,
+  0xd4, 0x52, 0xc4, 0xd9, 0x89, 0xec, 0xb8, 0x87, 0x11, 0xcd, 0x1c, 0x56, 0x82, 0xcf, 0x9f, 0x3f,
+  0xd5, 0x38, 0x90, 0x56, 0x18, 0x90, 0x9f, 0x6a, 0x66, 0x82, 0xb6, 0x29, 0x66, 0x79, 0x55, 0x4c,
+  0x2f, 0xf0, 0x89, 0x96, 0x9b, 0xbb, 0x19, 0x5c, 0xc9, 0xc8, 0xaa, 0x20, 0xa5, 0x9a, 0x5a, 0x5f,
+  0x1d, 0xca, 0xea, 0xb2, 0xa3, 0xa3, 0x94, 0x42, 0xd9, 0x13, 0x79, 0x5d, 0xa6, 0x4d, 0x5d, 0xaa,
+  0x55, 0x1e, 0x37, 0x09, 0xd6, 0xd9, 0x16, 0x20, 0xb0, 0x32, 0xcd, 0xd8, 0x76, 0x3e, 0xb2, 0x73,
+  0xe6, 0xc5, 0xee, 0x66, 0x25, 0xa2, 0xcc, 0x5c, 0x88, 0xec, 0x79, 0x28, 0xf0, 0xf2, 0xc9, 0xed,
+  0xb7, 0x9e, 0xd1, 0xd9, 0xb6, 0xea, 0x94, 0x0a, 0x1e, 0x12, 0x42, 0xa1, 0xf4, 0xbb, 0x00, 0x14,
+  0x8d, 0x9a, 0xfd, 0x0b, 0x15, 0xd9, 0x4f, 0x00, 0x34, 0x6a, 0xf6, 0x6f, 0xe8, 0xc0, 0x2e, 0x38,
+  0x8d, 0xc6, 0xed, 0xf0, 0x50, 0xd2, 0x87, 0x80, 0xc2, 0x76, 0xed, 0x50, 0x50, 0xb8, 0x87, 0x40,
+  0xc1, 0x76, 0x4d, 0x28, 0x2a, 0xc3, 0xde, 0xd1, 0x5f, 0xb6, 0x68, 0x93, 0x0a, 0xa4, 0x15, 0x7b,
+  0x85, 0xe2, 0xc7, 0xfa, 0xde, 0x68, 0x37, 0xf6, 0xf5, 0xc6, 0x36, 0xfa, 0xde, 0x68, 0x3d, 0xf6,
+  0xf5, 0xc6, 0x36, 0x6d, 0xfa, 0xb0, 0x8f, 0x6f, 0xdb, 0x56, 0x65, 0x08, 0xc5, 0x05, 0x78, 0x35,
+  0x26, 0xdd, 0xad, 0xf0, 0xd0, 0xac, 0x03, 0xa8, 0x68, 0x13, 0x86, 0xdb, 0x96, 0x27, 0x27, 0xd2,
+  0xb5, 0x33, 0xf4, 0xcc, 0xa7, 0xec, 0xfd, 0x6f, 0x10, 0xdc, 0xe2, 0x7a, 0x2a, 0xd2, 0xc5, 0xee,
+  0xae, 0xd8, 0x4d, 0x90, 0x2d, 0x99, 0x5c, 0x6a, 0xa5, 0x37, 0x69, 0xb1, 0x6e, 0x80, 0x0e, 0x43,
+  0xe3, 0x22, 0xeb, 0x18, 0xd3, 0x06, 0x4a, 0x6a, 0x01, 0x4e, 0x1f, 0x22, 0x68, 0x78, 0xe7, 0xf3,
+  0xb0, 0x5c, 0xc5, 0x29, 0x2e, 0xfc, 0x4d, 0xe4, 0x62, 0x50, 0x80, 0x09, 0x6f, 0x02, 0xc3, 0xfd,
+  0x01, 0xe8, 0x33, 0xea, 0x79, 0x46, 0x22, 0xb2, 0x4d, 0x12, 0x6d, 0xb9, 0xf3, 0xf7, 0x8d, 0x48,
+  0x6e, 0x2f, 0x55, 0x78, 0x61, 0x74, 0x64, 0xa2, 0x5a, 0x8a, 0x72, 0xae, 0x4e, 0x55, 0xa4, 0xd9,
+  0xe9, 0x9a, 0x14, 0xf0, 0xec, 0xcc, 0x76, 0x14, 0x6f, 0xd4, 0x70, 0x90, 0x16, 0xca, 0x07, 0x5c,
+  0x72, 0x97, 0xe2, 0x1a, 0x10, 0x16, 0x4d, 0xb7, 0x86, 0xc1, 0x84, 0xdc, 0xe0, 0x39, 0xbe, 0xfb,
+  0x1e, 0x63, 0x0d, 0x98, 0x59, 0x46, 0x87, 0x3a, 0x74, 0x7a, 0x0c, 0xc8, 0x3f, 0xbf, 0xa8, 0x67,
+  0x87, 0xb9, 0x41, 0x30, 0xa9, 0x95, 0x51, 0xae, 0xa3, 0xea, 0x04, 0x0a, 0x34, 0x29, 0x47, 0xee,
+  0xa1, 0x23, 0x27, 0x2a, 0xd2, 0xc3, 0xc8, 0xc8, 0x17, 0x51, 0x90, 0x12, 0xa1, 0x21, 0x45, 0x98,
+  0xeb, 0x84, 0xe0, 0x3d, 0x13, 0x3e, 0xdf, 0x84, 0x99, 0x51, 0xab, 0x08, 0x97, 0x80, 0x93, 0xd9,
+  0x45, 0xc8, 0x88, 0xa6, 0x04, 0x79, 0x1f, 0xf5, 0x7b, 0xe9, 0x0b, 0x05, 0xbf, 0x16, 0x2d, 0xac,
+  0xd2, 0xe2, 0x4f, 0xc4, 0x0a, 0x30, 0xff, 0x7e, 0x24, 0xc4, 0x6b, 0xc0, 0xce, 0x51, 0x3d, 0x7f,
+  0x47, 0x26, 0xed, 0x22, 0x12, 0x7f, 0x81, 0xcf, 0x8c, 0xaa, 0x9a, 0x9f, 0x9f, 0x9f, 0x33, 0xb2,
+  0x0d, 0x60, 0xd2, 0x34, 0x09, 0xa8, 0xb4, 0x10, 0xd0, 0x3c, 0x09, 0x68, 0x82, 0x3d, 0x4e, 0x12,
+  0x7e, 0x6b, 0xfa, 0x49, 0xbc, 0x32, 0x84, 0x09, 0xc9, 0x1d, 0x7f, 0x4b, 0x95, 0x71, 0x91, 0x98,
+  0xb4, 0xd4, 0x0e, 0xfc, 0xc4, 0xbf, 0x34, 0x1c, 0xbc, 0x30, 0x6f, 0x84, 0xf3, 0x21, 0xc8, 0xbe,
+  0x11, 0xd9, 0xe3, 0xf4, 0x39, 0x00, 0xb9, 0x35, 0xba, 0x5d, 0x2c, 0x1e, 0x64, 0xc0, 0x03, 0x03,
+  0xa1, 0xde, 0x52, 0x53, 0x79, 0x35, 0x6f, 0xc1, 0xee, 0xab, 0xc9, 0xfd, 0xfe, 0x6a, 0xae, 0x49,
+  0xbb, 0x13, 0x18, 0x51, 0x41, 0xe4, 0x2d, 0x8b, 0xfd, 0x9c, 0x5a, 0xdd, 0x70, 0x68, 0x67, 0xc0,
+  0x0d, 0x0f, 0x32, 0x98, 0xd0, 0xdc, 0x93, 0x14, 0x51, 0x3f, 0x69, 0x87, 0x52, 0x0d, 0x0d, 0x77,
+  0x8d, 0x27, 0x4b, 0x1e, 0x79, 0xa1, 0x78, 0x41, 0xd6, 0x48, 0x9a, 0x00, 0xa3, 0xad, 0xb3, 0x34,
+  0x1b, 0xbb, 0xaa, 0x01, 0xd5, 0x21, 0xd6, 0x78, 0x4a, 0x8f, 0x9b, 0x12, 0xa4, 0xc7, 0x66, 0x28,
+  0xa2, 0x05, 0x98, 0xcc, 0x0b, 0x66, 0xe9, 0x46, 0xaa, 0x88, 0x44, 0xa3, 0x5f, 0x22, 0xf1, 0xbd,
+  0x75, 0xd5, 0x6d, 0xad, 0x20, 0xb4, 0x58, 0x81, 0x9a, 0x65, 0xaa, 0x9a, 0xa3, 0xad, 0x55, 0xd1,
+  0x58, 0x23, 0xa0, 0x61, 0x21, 0xda, 0x8c, 0xc0, 0xbd, 0x55, 0x51, 0xc3, 0xf6, 0x8a, 0x36, 0x42,
+  0x90, 0x0b, 0x3e, 0x4b, 0xf2, 0xac, 0x27, 0x99, 0x44, 0x68, 0x0d, 0xe9, 0x69, 0x4e, 0x95, 0x73,
+  0x79, 0x0d, 0xd7, 0xf4, 0x52, 0xe9, 0xe6, 0x1b, 0xe5, 0x65, 0xf0, 0x39, 0xfb, 0xc7, 0x3f, 0x68,
+  0x44, 0x26, 0x5a, 0xf2, 0xae, 0xd4, 0x89, 0x53, 0xe5, 0xa1, 0xba, 0xdd, 0x3a, 0xe7, 0x98, 0x00,
+  0x87, 0x42, 0xe3, 0xa8, 0x22, 0xbf, 0xaf, 0x64, 0xaa, 0xbd, 0x3f, 0x45, 0x44, 0x6f, 0x97, 0xa2,
+  0x70, 0x85, 0xca, 0x4d, 0xb2, 0x20, 0x25, 0xa7, 0x99, 0xc4, 0x90, 0x63, 0xc2, 0xa4, 0xc0, 0x6b,
+  0xe5, 0x5d, 0x69, 0x3c, 0xb5, 0x2c, 0xbf, 0x70, 0x82, 0x25, 0x26, 0x25, 0x25, 0xce, 0x74, 0x1b,
+  0x85, 0x3e, 0x8a, 0xb9, 0x20, 0xaf, 0x40, 0xb5, 0x2d, 0xb7, 0x34, 0x21, 0xa1, 0x0e, 0x32, 0xa3,
+  0x73, 0xd2, 0xd9, 0xce, 0x74, 0x6c, 0x47, 0xb2, 0xa0, 0x8b, 0xb9, 0xce, 0xb3, 0x42, 0x7b, 0xf6,
+  0x90, 0x51, 0xcb, 0x12, 0x03, 0x6d, 0xf6, 0x48, 0x22, 0x31, 0x53, 0x70, 0x5a, 0xc2, 0xb0, 0xbb,
+  0xec, 0x54, 0x3e, 0xe8, 0x9a, 0x7f, 0x8b, 0x83, 0x88, 0xd0, 0xec, 0x73, 0xad, 0x4f, 0xe3, 0x90,
+  0xb2, 0x4d, 0x8a, 0x21, 0x68, 0xa2, 0x41, 0x56, 0x1d, 0xdf, 0x30, 0x4e, 0x9e, 0x6d, 0x5d, 0xb0,
+  0xac, 0xe8, 0x23, 0xad, 0x72, 0xc1, 0x92, 0x16, 0x53, 0xa1, 0xd1, 0x67, 0x7a, 0x6f, 0x06, 0x18,
+  0xa1, 0x8a, 0x76, 0x6b, 0xea, 0xcb, 0xf0, 0x48, 0xda, 0xa1, 0x48, 0xdc, 0xb0, 0xd7, 0xa0, 0xc0,
+  0x41, 0x2a, 0x0c, 0xe0, 0x78, 0x1a, 0x87, 0xd7, 0xa2, 0x07, 0x28, 0xff, 0x06, 0x14, 0x6f, 0x6d,
+  0x23, 0xa9, 0x46, 0xe3, 0xb5, 0xc6, 0xe0, 0x48, 0x05, 0x5c, 0x6f, 0xd2, 0xa5, 0x4e, 0xed, 0x15,
+  0x2c, 0x08, 0x92, 0x48, 0xa6, 0x35, 0x05, 0xff, 0x74, 0xf3, 0x85, 0x1c, 0xa2, 0x34, 0x40, 0x22,
+  0x70, 0xe1, 0x3e, 0x13, 0x6f, 0xe8, 0x61, 0xdd, 0x6d, 0x91, 0xc1, 0x9e, 0xcf, 0xdb, 0xb9, 0xe3,
+  0xf0, 0xcc, 0x5d, 0x1e, 0xce, 0x1e, 0x89, 0xda, 0xcc, 0x65, 0x04, 0x76, 0xff, 0x10, 0x36, 0xa1,
+  0xb0, 0x08, 0x51, 0xae, 0x6a, 0x68, 0x7b, 0xac, 0x36, 0x8f, 0xe1, 0x00, 0xf4, 0x0f, 0x87, 0x78,
+  0x86, 0x92, 0x37, 0x72, 0x97, 0x41, 0xe8, 0xe1, 0xc4, 0x23, 0x34, 0x87, 0xfa, 0x22, 0xea, 0x75,
+  0xa8, 0x2f, 0xba, 0xdb, 0xa5, 0xf7, 0x85, 0xf6, 0xb6, 0x7a, 0x2b, 0x8d, 0xfe, 0x56, 0xcc, 0x57,
+  0x2b, 0x4b, 0xf6, 0x6b, 0x45, 0x3d, 0x2c, 0xd7, 0xf8, 0xb1, 0x3c, 0x99, 0x31, 0x31, 0x3d, 0x7f,
+  0x2a, 0xf7, 0xe0, 0xe5, 0x2d, 0x73, 0x0a, 0x1e, 0xb2, 0x8e, 0x7c, 0xd0, 0x69, 0xf6, 0xc5, 0x54,
+  0xa6, 0xde, 0x37, 0x4e, 0x56, 0x3c, 0x7b, 0xa1, 0x5e, 0xaa, 0xc1, 0x24, 0xc2, 0xdb, 0x80, 0xe1,
+  0x30, 0x22, 0xe0, 0x2a, 0x29, 0x4c, 0x04, 0x60, 0x7d, 0x9a, 0x4f, 0x26, 0x96, 0x5f, 0x7a, 0x30,
+  0xc6, 0xee, 0x5c, 0x13, 0x29, 0xfb, 0xb1, 0x49, 0x35, 0x42, 0x53, 0x95, 0x08, 0x01, 0x41, 0x87,
+  0x56, 0xd0, 0x3a, 0xba, 0x38, 0x0c, 0x12, 0x65, 0xb3, 0xd8, 0x76, 0xd0, 0xc8, 0x35, 0xc8, 0xec,
+  0x07, 0x9e, 0xb8, 0xa4, 0xdc, 0xd1, 0xe8, 0xde, 0x33, 0x19, 0x90, 0x22, 0x4c, 0x5a, 0x65, 0x5b,
+  0x75, 0xf2, 0x75, 0x91, 0xd5, 0xb2, 0x32, 0x6c, 0x72, 0xb0, 0x28, 0xc8, 0x11, 0x7e, 0x2a, 0xf3,
+  0x89, 0xbf, 0xff, 0x47, 0x79, 0x8b, 0xc9, 0xb2, 0x24, 0x39, 0x83, 0xec, 0xb0, 0xc9, 0xd9, 0xda,
+  0x70, 0x9c, 0xdb, 0x4c, 0x3f, 0x63, 0xe8, 0x45, 0x3e, 0x55, 0x72, 0x57, 0x66, 0xb1, 0x27, 0xf8,
+  0xb8, 0x33, 0xd7, 0x98, 0xca, 0x0f, 0x30, 0x02, 0xdb, 0xaa, 0xaf, 0x25, 0xab, 0xe2, 0x03, 0xa0,
+  0xa2, 0x40, 0xb7, 0x23, 0xfb, 0xf7, 0x58, 0xe7, 0xbb, 0x27, 0xf8, 0xef, 0x0f, 0xf4, 0xef, 0x37,
+  0x4f, 0x3a, 0x57, 0xba, 0x6e, 0x01, 0x74, 0xf9, 0x01, 0x3d, 0xaf, 0x1f, 0xc6, 0x90, 0x8c, 0xd2,
+  0x65, 0x18, 0x2f, 0x72, 0xa2, 0x4f, 0x58, 0xf1, 0xe4, 0x43, 0x57, 0xef, 0x7c, 0xd7, 0xb8, 0x35,
+  0xfa, 0x05, 0xf0, 0x3a, 0x33, 0xd4, 0x88, 0x54, 0xa7, 0x75, 0x7c, 0x63, 0x7c, 0xe8, 0xb1, 0x00,
+  0xa2, 0xf6, 0x2c, 0x7e, 0x11, 0x7c, 0x14, 0x9e, 0xd1, 0xef, 0x76, 0x69, 0x62, 0xa2, 0xbb, 0x26,
+  0x82, 0xdf, 0x07, 0x57, 0xfb, 0x78, 0x2e, 0x4b, 0x8f, 0xac, 0x28, 0x59, 0xb6, 0xa5, 0xb5, 0x28,
+  0xe9, 0xfb, 0x65, 0xb5, 0xf7, 0x8e, 0x22, 0xb1, 0x43, 0xc5, 0x3c, 0xb5, 0x99, 0x66, 0x8c, 0x01,
+  0xa8, 0x41, 0xad, 0xf9, 0x5e, 0xab, 0xbc, 0x0d, 0x0b, 0xcb, 0x1d, 0x75, 0x68, 0xe4, 0xa0, 0xf1,
+  0x6d, 0xb5, 0xe9, 0x7d, 0xc3, 0xbf, 0xa7, 0xcb, 0x4d, 0xf4, 0x41, 0x78, 0xe8, 0xf0, 0xd2, 0xcd,
+  0x0a, 0xe7, 0x89, 0x02, 0x0d, 0x73, 0x9f, 0xf4, 0x3b, 0xad, 0x55, 0x7c, 0x9e, 0xbe, 0x7c, 0xf7,
+  0xe3, 0x77, 0xbf, 0x5c, 0x7e, 0xfb, 0x6f, 0xcf, 0x41, 0x75, 0xc6, 0x43, 0xf6, 0x75, 0x4d, 0x25,
+  0x65, 0xab, 0x1f, 0x1e, 0xff, 0xf9, 0x97, 0x37, 0xcf, 0xdf, 0xbe, 0xf9, 0xf6, 0xf9, 0x25, 0x29,
+  0xad, 0x1e, 0xf9, 0x6b, 0x55, 0x4f, 0xcb, 0x57, 0xb0, 0x9b, 0x73, 0x29, 0x5d, 0xc6, 0x37, 0x79,
+  0x2b, 0x83, 0x96, 0x12, 0x81, 0xd4, 0x2c, 0xce, 0x78, 0xd8, 0x83, 0xe0, 0x24, 0xe3, 0x41, 0xd8,
+  0x12, 0x5d, 0x8a, 0x04, 0xf7, 0x19, 0x3f, 0x8d, 0x57, 0x6b, 0x5a, 0x33, 0x39, 0x97, 0x9d, 0x30,
+  0xae, 0x86, 0xb0, 0x90, 0xf4, 0x73, 0x05, 0x21, 0xa0, 0x84, 0x08, 0x1a, 0xab, 0x40, 0x42, 0x8c,
+  0x88, 0xe3, 0xb1, 0x58, 0x73, 0x03, 0x7d, 0xa9, 0x80, 0xa8, 0x0c, 0x90, 0xdc, 0xe4, 0x73, 0xde,
+  0xc0, 0x05, 0x1a, 0xfe, 0x55, 0x47, 0xdf, 0x1b, 0x4b, 0x60, 0x35, 0xe3, 0x47, 0xb4, 0xd0, 0xde,
+  0x01, 0xa3, 0x06, 0xa8, 0x2b, 0x21, 0x61, 0x68, 0x2b, 0x87, 0x0a, 0x94, 0x77, 0xd8, 0x5f, 0x37,
+  0x96, 0xe5, 0x4c, 0x68, 0x0a, 0xa9, 0xa7, 0xa7, 0xac, 0xb3, 0x3f, 0x90, 0x7d, 0x92, 0xc4, 0x37,
+  0xa9, 0x48, 0x8e, 0x53, 0x30, 0x77, 0x05, 0x39, 0x3d, 0xb6, 0x49, 0x61, 0xf8, 0x71, 0x14, 0xde,
+  0xb2, 0x9b, 0x25, 0x1a, 0xb7, 0x52, 0xa8, 0x9f, 0x66, 0x10, 0x5b, 0xac, 0x30, 0x17, 0xd8, 0x44,
+  0xfc, 0x1a, 0x10, 0xa1, 0x72, 0x68, 0x24, 0x24, 0x32, 0xbd, 0x80, 0x74, 0x26, 0xef, 0xcb, 0x1c,
+  0xf3, 0xa5, 0x04, 0x0e, 0x39, 0x53, 0xf5, 0x09, 0x05, 0x63, 0xb7, 0x68, 0x8f, 0x05, 0xfb, 0x12,
+  0x66, 0x23, 0x4d, 0xe7, 0xcb, 0x78, 0x03, 0x8c, 0x31, 0x5f, 0xbd, 0x7e, 0xfe, 0xa3, 0x6e, 0x2a,
+  0xb4, 0xeb, 0x48, 0x77, 0x7e, 0x78, 0xd0, 0x83, 0x35, 0x2b, 0x79, 0x58, 0xa3, 0xc2, 0x22, 0x86,
+  0x19, 0x22, 0x3b, 0x01, 0x68, 0x27, 0xf9, 0xa3, 0x53, 0x26, 0xed, 0x1c, 0x7a, 0x50, 0xe0, 0x5e,
+  0x16, 0x33, 0x3f, 0xe4, 0xe9, 0x92, 0xc1, 0x6d, 0x19, 0x1a, 0xb2, 0x72, 0x23, 0x17, 0xb1, 0xd7,
+  0x4b, 0x9e, 0x42, 0xb4, 0x90, 0xca, 0x5a, 0x24, 0x6e, 0xb9, 0xf3, 0x62, 0xb5, 0x84, 0x97, 0x66,
+  0xf1, 0x9a, 0xf1, 0x8c, 0xf6, 0xa1, 0x35, 0x64, 0x50, 0x06, 0x07, 0x72, 0x48, 0x33, 0xac, 0x72,
+  0xdf, 0x24, 0x01, 0xce, 0x4b, 0x06, 0xf1, 0xe2, 0x35, 0x1e, 0xa0, 0xb8, 0x2d, 0x3b, 0x21, 0xa9,
+  0xfd, 0xaf, 0x5f, 0x3e, 0xbe, 0xa4, 0x89, 0xf7, 0x1b, 0xa4, 0x2b, 0xb4, 0x4f, 0xa1, 0xf3, 0x3a,
+  0x11, 0x60, 0xa9, 0xa1, 0x29, 0x18, 0x43, 0x84, 0x00, 0xa1, 0x7b, 0xe7, 0x67, 0x09, 0x09, 0x9e,
+  0x48, 0x40, 0xf0, 0xe8, 0xa7, 0x1c, 0x22, 0x3c, 0x14, 0xb8, 0x03, 0xae, 0xf3, 0x22, 0x88, 0x78,
+  0x48, 0x27, 0x44, 0x3a, 0x3d, 0xad, 0xb1, 0x93, 0x5b, 0x50, 0xe2, 0x08, 0x21, 0x3e, 0x83, 0x3f,
+  0xd8, 0x13, 0x77, 0x4d, 0x61, 0x5f, 0xd0, 0x1a, 0xe1, 0x75, 0xd0, 0xb8, 0x38, 0x90, 0x4b, 0xc2,
+  0x93, 0x37, 0x74, 0x81, 0xc0, 0xd8, 0x5d, 0xb5, 0xd8, 0x5a, 0xd3, 0x8c, 0x7a, 0x3d, 0xb6, 0xa9,
+  0x78, 0xf1, 0x5a, 0x44, 0xaf, 0x2b, 0x9d, 0x0c, 0xad, 0xca, 0xdd, 0x04, 0x91, 0x17, 0xdf, 0x98,
+  0x25, 0x4d, 0xfa, 0xb4, 0xc0, 0xb4, 0x49, 0x20, 0xe4, 0x17, 0x25, 0xa8, 0x90, 0x4f, 0x96, 0xb5,
+  0xa4, 0x5e, 0x3e, 0xab, 0xe9, 0x79, 0xd3, 0x55, 0x15, 0x1d, 0x5b, 0x8a, 0x1e, 0x25, 0xe3, 0x06,
+  0xc8, 0xff, 0xf5, 0xf2, 0xd5, 0x8f, 0x26, 0xf9, 0x5e, 0x55, 0x4c, 0xd3, 0x38, 0x17, 0xd0, 0x9a,
+  0xc7, 0x79, 0xc6, 0x0e, 0x49, 0x29, 0x68, 0x40, 0x8c, 0x39, 0x77, 0xa1, 0xda, 0x60, 0x6f, 0xe4,
+  0xeb, 0x20, 0x03, 0x1f, 0xe2, 0x6b, 0xfd, 0xdd, 0x97, 0x52, 0x97, 0xde, 0xaf, 0x4d, 0x52, 0xe2,
+  0x2b, 0x9c, 0xb2, 0x79, 0x5d, 0xbc, 0x34, 0x7b, 0x8b, 0x25, 0x9a, 0x5a, 0x70, 0x86, 0x73, 0x58,
+  0x85, 0x67, 0x6d, 0xce, 0x52, 0xc7, 0x79, 0x7d, 0x8a, 0x44, 0xf9, 0xf8, 0x6a, 0x8d, 0xf8, 0x60,
+  0xde, 0xc1, 0x74, 0x83, 0x69, 0x12, 0x66, 0x9c, 0x05, 0x2b, 0xbe, 0x80, 0xe9, 0x44, 0x6a, 0xcd,
+  0x56, 0x71, 0x82, 0x53, 0x88, 0xd3, 0xd2, 0xf8, 0x2d, 0x40, 0x77, 0x45, 0x70, 0x2d, 0x5a, 0x38,
+  0x89, 0x6a, 0x8b, 0x16, 0x5c, 0x0e, 0x4e, 0xfa, 0x7f, 0x02, 0xd3, 0x29, 0x7b, 0x89, 0xb5, 0x89,
+  0xcf, 0x40, 0x4c, 0x3d, 0x68, 0xa9, 0x00, 0x7a, 0x54, 0x4d, 0x30, 0xc9, 0xcc, 0xb4, 0x15, 0x1f,
+  0x13, 0x9e, 0xb5, 0x41, 0x7f, 0xf0, 0x00, 0x41, 0xe1, 0x7b, 0xe9, 0x91, 0x2a, 0x76, 0xbd, 0x16,
+  0x40, 0xca, 0x86, 0xe4, 0x0d, 0x4e, 0xd2, 0x0e, 0x99, 0xfb, 0xf9, 0x6e, 0x23, 0x88, 0xc3, 0xea,
+  0xe5, 0xd4, 0xf5, 0x58, 0x5d, 0x84, 0x0f, 0x89, 0xb2, 0xba, 0x71, 0xdc, 0xed, 0x42, 0x74, 0xb3,
+  0xad, 0xa5, 0xa0, 0x14, 0x7f, 0x10, 0x91, 0x34, 0x9b, 0x19, 0xd5, 0x96, 0xd2, 0x94, 0xa6, 0x6b,
+  0x52, 0x52, 0xc5, 0x20, 0x2a, 0x34, 0x67, 0x0e, 0xda, 0x87, 0x4b, 0x67, 0x91, 0x97, 0xe2, 0x63,
+  0x18, 0x7b, 0xdd, 0x88, 0xba, 0x90, 0x87, 0xc1, 0x4c, 0x09, 0x20, 0x76, 0x07, 0x57, 0x25, 0x2b,
+  0x53, 0xe2, 0xef, 0x1b, 0x91, 0x66, 0x58, 0xa6, 0x02, 0xdb, 0xe9, 0xc7, 0xb8, 0xef, 0xba, 0x62,
+  0x4d, 0xd4, 0x8a, 0x13, 0x91, 0xd2, 0x6a, 0x4a, 0x00, 0xfe, 0x25, 0x18, 0x39, 0x86, 0x4a, 0xa0,
+  0x20, 0x92, 0x56, 0xa9, 0x22, 0x80, 0x5c, 0x56, 0xfa, 0x4d, 0x2e, 0xda, 0xf5, 0xe8, 0xdc, 0xdb,
+  0x5d, 0xd3, 0x0c, 0xa9, 0x8e, 0xc6, 0x4a, 0x64, 0xcb, 0x18, 0x1c, 0xcf, 0x26, 0x09, 0x65, 0xdb,
+  0x1e, 0xc0, 0xcd, 0x39, 0xd6, 0xb2, 0x24, 0xb4, 0xb7, 0x42, 0xd1, 0x66, 0x01, 0x3e, 0x2e, 0x13,
+  0x65, 0x80, 0xfe, 0xfc, 0xc3, 0xf7, 0x2f, 0xb3, 0x6c, 0xfd, 0x46, 0x51, 0xd1, 0x52, 0xaf, 0x68,
+  0xa7, 0x24, 0xff, 0x01, 0x44, 0xb5, 0x9f, 0xec, 0x20, 0xd3, 0xb4, 0x05, 0x08, 0xe6, 0x47, 0xfa,
+  0xdc, 0xee, 0x41, 0x05, 0x70, 0xc4, 0xd3, 0x44, 0x80, 0x10, 0x5a, 0xa2, 0xf4, 0x6a, 0xc0, 0x9b,
+  0x4b, 0x14, 0xc1, 0x2c, 0x44, 0xf6, 0x46, 0xa4, 0x6b, 0x60, 0x88, 0x78, 0x29, 0xeb, 0x45, 0x9d,
+  0x3f, 0x1f, 0xcb, 0x74, 0xe1, 0x98, 0xda, 0x81, 0xc9, 0x01, 0x13, 0x55, 0xea, 0x38, 0x6f, 0x31,
+  0x40, 0xc4, 0x78, 0xe3, 0x37, 0xb5, 0x82, 0x7b, 0x4a, 0xd0, 0xcb, 0x62, 0x97, 0x4f, 0x12, 0x85,
+  0x8c, 0x56, 0x3b, 0x75, 0x25, 0x2f, 0xdd, 0x33, 0xfd, 0x78, 0xc9, 0x41, 0x16, 0x03, 0x96, 0x02,
+  0x37, 0xc8, 0x9f, 0xe0, 0x0b, 0xa3, 0xf3, 0xa3, 0xc8, 0x6e, 0xe2, 0xe4, 0x83, 0x74, 0xa4, 0x2c,
+  0x76, 0x29, 0x4d, 0xf1, 0xcc, 0x4e, 0xb7, 0x7b, 0x30, 0x8a, 0x2c, 0x58, 0x89, 0x78, 0x93, 0xed,
+  0x40, 0xa2, 0x74, 0x86, 0x61, 0x4b, 0x98, 0x04, 0x9b, 0x6c, 0x07, 0x7c, 0x9c, 0xfe, 0x65, 0x15,
+  0x6f, 0xd1, 0xb3, 0x12, 0xaf, 0x77, 0x29, 0x5a, 0x8a, 0x92, 0x23, 0xe4, 0x2d, 0x82, 0xeb, 0x95,
+  0xa5, 0x76, 0xb0, 0x5e, 0xa5, 0x30, 0x99, 0x0d, 0x94, 0xd7, 0xfd, 0x4c, 0x1b, 0x98, 0x81, 0x97,
+  0xfc, 0xba, 0x12, 0xfb, 0x2e, 0x31, 0x9e, 0xbb, 0x41, 0xdb, 0x82, 0x25, 0xb6, 0x4d, 0x94, 0xaa,
+  0xd0, 0x8c, 0x2b, 0x7f, 0x89, 0x65, 0x60, 0xf4, 0x80, 0xeb, 0xc0, 0xa5, 0xe4, 0x29, 0x8d, 0xcb,
+  0xd0, 0xc0, 0xf7, 0x90, 0x4b, 0xc2, 0xce, 0x3c, 0xa4, 0x88, 0x56, 0x02, 0x71, 0xe1, 0x8d, 0x83,
+  0xb6, 0xc6, 0x8d, 0x17, 0x11, 0x98, 0x76, 0x0f, 0xc0, 0x8a, 0x48, 0x45, 0x8a, 0x32, 0xcd, 0xc5,
+  0x70, 0x6d, 0x9b, 0x72, 0xe5, 0xc6, 0xa5, 0xf3, 0xcd, 0xf3, 0xb7, 0x98, 0xc6, 0x53, 0x84, 0x01,
+  0xa0, 0x22, 0x19, 0xa1, 0xa1, 0x5d, 0xeb, 0x9a, 0x2e, 0x56, 0x09, 0x0d, 0x35, 0x77, 0xb4, 0x79,
+  0xde, 0x36, 0x58, 0x0f, 0x85, 0x58, 0x1b, 0xab, 0xfb, 0xd8, 0x23, 0x02, 0x0b, 0x02, 0x7b, 0x2b,
+  0xf5, 0x69, 0x6b, 0xa6, 0x00, 0xca, 0x5e, 0xbe, 0x16, 0xe6, 0xd5, 0xc5, 0x34, 0x73, 0x9e, 0x4f,
+  0xb5, 0x54, 0x9a, 0x56, 0x1c, 0x77, 0xec, 0xfb, 0x00, 0xbc, 0xc6, 0x7b, 0xb0, 0x72, 0xab, 0x15,
+  0x7a, 0x5c, 0xaf, 0xad, 0xae, 0x8e, 0xa2, 0xa6, 0xd4, 0xd5, 0x50, 0xfe, 0xa5, 0xa7, 0x20, 0xc1,
+  0x84, 0x0d, 0x63, 0x47, 0x9f, 0x14, 0xa2, 0x5f, 0x7d, 0x06, 0xa1, 0x92, 0x32, 0x9d, 0x2f, 0xd4,
+  0xad, 0xa6, 0xcc, 0x4c, 0xcf, 0x4d, 0xbe, 0x5e, 0xa3, 0x46, 0x75, 0x88, 0xf8, 0x8e, 0x82, 0xac,
+  0xab, 0xa2, 0xc0, 0x84, 0xc0, 0x32, 0x14, 0x49, 0x47, 0xd1, 0x73, 0x42, 0x9d, 0x1e, 0xa9, 0xbb,
+  0x73, 0xaa, 0x78, 0x28, 0x4f, 0x08, 0x7e, 0xfc, 0x81, 0x24, 0x96, 0x1e, 0xcb, 0xcb, 0xb9, 0xb6,
+  0x34, 0x9e, 0x16, 0xc5, 0xec, 0x42, 0x13, 0x5e, 0xbf, 0x43, 0x4d, 0x20, 0x2f, 0x93, 0x13, 0x0a,
+  0x53, 0x5c, 0x99, 0x60, 0x25, 0xab, 0xc2, 0x36, 0x2b, 0xee, 0x3e, 0x64, 0x79, 0x5a, 0x54, 0xae,
+  0x15, 0xc8, 0x1a, 0x9b, 0x66, 0x95, 0x17, 0xba, 0xe6, 0xc7, 0x45, 0x30, 0x66, 0xe9, 0x43, 0x3e,
+  0x0c, 0x76, 0xb4, 0xf6, 0x74, 0x68, 0xcd, 0xda, 0xe3, 0xe8, 0x72, 0x78, 0x8a, 0xfd, 0x68, 0x52,
+  0x9a, 0xba, 0x91, 0x56, 0x67, 0xb2, 0x5a, 0x8f, 0x52, 0x9a, 0x20, 0x4d, 0x16, 0xa6, 0x58, 0xf8,
+  0x0c, 0x06, 0x8a, 0x0a, 0x94, 0x25, 0x98, 0x9e, 0x80, 0x02, 0x41, 0x2a, 0x84, 0x09, 0xd4, 0x52,
+  0x84, 0x6b, 0x0d, 0xef, 0xc0, 0x72, 0xe6, 0x21, 0x3a, 0x59, 0xbb, 0x9c, 0x0a, 0x1c, 0x89, 0xd1,
+  0x79, 0xf9, 0xf6, 0xed, 0x6b, 0x0a, 0xb5, 0xb6, 0x83, 0xaa, 0x33, 0x02, 0x00, 0x98, 0x3e, 0xc7,
+  0x9a, 0xc1, 0x39, 0xcb, 0x92, 0x4d, 0xad, 0x6a, 0x98, 0x2d, 0x21, 0x9f, 0xc6, 0x36, 0xfb, 0x66,
+  0xc0, 0xe3, 0xf4, 0x43, 0x45, 0xb9, 0xa1, 0x97, 0x0f, 0xf9, 0x1f, 0x48, 0x74, 0x11, 0x67, 0x98,
+  0xa6, 0xca, 0xc2, 0x0b, 0x98, 0x16, 0x3f, 0x83, 0x70, 0x1c, 0x0c, 0x0c, 0xe4, 0x4c, 0x9b, 0xd2,
+  0x5e, 0xde, 0x9a, 0xe2, 0xd3, 0xe6, 0x91, 0x57, 0xc4, 0xc8, 0x5c, 0xf5, 0xf5, 0xca, 0xae, 0x55,
+  0x9e, 0xb2, 0x19, 0xc9, 0x15, 0x55, 0x0e, 0x5f, 0xa7, 0xa9, 0xca, 0xc0, 0xec, 0x54, 0x90, 0x2f,
+  0xa5, 0x82, 0xe8, 0x54, 0x41, 0xf2, 0xe8, 0x33, 0x44, 0x70, 0xf7, 0xc5, 0xa7, 0x6a, 0x56, 0x8b,
+  0x35, 0x7a, 0xf9, 0xf8, 0xb8, 0x3f, 0x1a, 0xd3, 0x52, 0xcb, 0x9a, 0x52, 0x86, 0x54, 0x24, 0xd7,
+  0xe8, 0xfb, 0xf0, 0x08, 0x22, 0xe4, 0x2b, 0x10, 0x7f, 0x22, 0x59, 0x3d, 0x34, 0xcb, 0x90, 0x45,
+  0xfc, 0x2c, 0x9c, 0xa7, 0xc9, 0xed, 0x1a, 0x64, 0xb4, 0xb7, 0x08, 0xb2, 0xe4, 0x00, 0xf8, 0x05,
+  0x0f, 0x43, 0x3c, 0x0a, 0x62, 0x50, 0x3e, 0xa6, 0x95, 0xca, 0x77, 0x4a, 0x29, 0xdf, 0x05, 0x51,
+  0x36, 0xe8, 0xd3, 0x1a, 0xb4, 0xf1, 0xbe, 0xc1, 0x39, 0xeb, 0xe3, 0xb0, 0x3f, 0xe5, 0x7d, 0x7f,
+  0x36, 0xed, 0xc1, 0xf5, 0xc4, 0x1e, 0x4c, 0x86, 0xc3, 0x99, 0x8d, 0xd7, 0xce, 0xc8, 0xb5, 0x7c,
+  0xc7, 0xf5, 0xf1, 0x5a, 0xcc, 0x9c, 0x91, 0xe7, 0xf0, 0x11, 0x5e, 0x0f, 0x66, 0xa3, 0xb1, 0xdb,
+  0x1f, 0x39, 0x78, 0x3d, 0x9a, 0xf9, 0xb6, 0x6d, 0xfb, 0xd4, 0x7e, 0xd6, 0x1f, 0xf8, 0xd3, 0x3e,
+  0xc7, 0xe3, 0x8f, 0x1f, 0xb9, 0x63, 0xbb, 0x23, 0xe1, 0x8d, 0x7a, 0x1a, 0x7c, 0xde, 0xd4, 0x9a,
+  0x70, 0x2e, 0xf1, 0xd9, 0xfd, 0xe9, 0x60, 0xe4, 0x58, 0xd4, 0xbf, 0x3f, 0x1c, 0xd8, 0xd3, 0x91,
+  0x23, 0x08, 0xee, 0xc8, 0x72, 0x27, 0x9e, 0x3b, 0x20, 0x9a, 0xfa, 0x8e, 0x18, 0x79, 0x13, 0x82,
+  0x3b, 0xb5, 0x3c, 0xe1, 0xd8, 0x3e, 0xb5, 0x99, 0x39, 0x9e, 0x6b, 0x8d, 0xf9, 0x04, 0xaf, 0x5d,
+  0x7b, 0xe6, 0xf8, 0x36, 0xb4, 0xd1, 0xe0, 0x13, 0xc3, 0x99, 0x33, 0x9e, 0xb9, 0x84, 0x43, 0xf8,
+  0x8e, 0x18, 0x4e, 0xa6, 0x63, 0xbc, 0xb6, 0x7c, 0xe8, 0xe5, 0xb9, 0x63, 0x89, 0xdb, 0x72, 0xb9,
+  0xed, 0xba, 0x74, 0xed, 0x89, 0x59, 0xdf, 0x1d, 0xd3, 0xb8, 0x87, 0x7c, 0x32, 0x9c, 0x0e, 0x39,
+  0x27, 0x9a, 0x5c, 0xc7, 0xe2, 0xd0, 0x81, 0x68, 0x1a, 0x03, 0xc3, 0xa6, 0x1e, 0xd7, 0xe1, 0x9b,
+  0x4d, 0x07, 0x62, 0x64, 0x8f, 0xfa, 0xc4, 0x87, 0xe9, 0xc0, 0x76, 0xc7, 0x63, 0x8f, 0xf8, 0x69,
+  0x59, 0x83, 0xfe, 0xc4, 0xa5, 0x71, 0x3b, 0xfe, 0x68, 0x36, 0xf1, 0x5d, 0x49, 0xfb, 0x58, 0x40,
+  0x3a, 0xe6, 0xd3, 0x58, 0xbd, 0x11, 0x9f, 0xcc, 0xec, 0x21, 0x3d, 0xb7, 0xc6, 0x2e, 0x1f, 0x0f,
+  0x46, 0x44, 0xb7, 0x3d, 0xec, 0xcf, 0xfa, 0xb3, 0xf1, 0x44, 0x87, 0xaf, 0x3f, 0x71, 0x26, 0x16,
+  0x9f, 0x92, 0x6c, 0xfa, 0xc2, 0x76, 0xfa, 0xf6, 0x80, 0x70, 0x0c, 0x3d, 0x18, 0x85, 0xe7, 0x13,
+  0xbd, 0xa3, 0xc1, 0x00, 0x58, 0x67, 0x13, 0x8e, 0xf1, 0xc8, 0xe2, 0x93, 0xc1, 0x68, 0x28, 0xc7,
+  0x31, 0xe6, 0x16, 0x77, 0x48, 0x96, 0x53, 0xdb, 0xed, 0xbb, 0xb3, 0xbe, 0xe4, 0x6d, 0x7f, 0xd2,
+  0xef, 0xbb, 0x53, 0xad, 0xfc, 0x78, 0xdf, 0xf1, 0xc5, 0x94, 0xdb, 0x72, 0x7c, 0x36, 0x1f, 0x8f,
+  0x87, 0xd4, 0xdf, 0xed, 0x0f, 0x9d, 0x29, 0x90, 0x42, 0xd7, 0x93, 0xb1, 0x3b, 0xb2, 0xb9, 0x1c,
+  0x93, 0x0d, 0x40, 0xa7, 0xf6, 0x8c, 0xae, 0xc7, 0xb3, 0x99, 0x35, 0xee, 0x13, 0x6e, 0x7f, 0x68,
+  0x89, 0xc1, 0x48, 0xd2, 0x6d, 0x83, 0x20, 0xb9, 0x05, 0x7d, 0x35, 0xf8, 0xec, 0x19, 0x1f, 0xba,
+  0xb6, 0x4d, 0x72, 0xb2, 0xc5, 0x00, 0x20, 0x5b, 0x34, 0xbe, 0x3e, 0x88, 0x66, 0x32, 0x19, 0xd2,
+  0xf8, 0x06, 0x43, 0xc7, 0x72, 0x5c, 0x47, 0xe9, 0xa7, 0xed, 0x5a, 0xae, 0x43, 0xb8, 0x87, 0xc2,
+  0x9b, 0x72, 0x3e, 0x94, 0xf2, 0x73, 0x66, 0xae, 0xcb, 0x87, 0x24, 0xd7, 0xf1, 0xb4, 0x2f, 0xc6,
+  0x3e, 0xf0, 0x5c, 0x83, 0x0f, 0xc0, 0x82, 0x1e, 0x0b, 0xe2, 0xc3, 0x64, 0xca, 0x47, 0xe3, 0x81,
+  0xd4, 0x85, 0xe9, 0xd0, 0x9d, 0x4e, 0xa6, 0xb6, 0xd4, 0x43, 0xd7, 0x9d, 0x58, 0x7d, 0x49, 0xc7,
+  0xcc, 0x72, 0x84, 0xef, 0xfb, 0x84, 0x83, 0x0f, 0x47, 0x20, 0x36, 0x41, 0xfc, 0x80, 0xa7, 0x33,
+  0x3e, 0xf0, 0x95, 0x8c, 0x27, 0xf6, 0x64, 0xea, 0xf7, 0xaf, 0xb4, 0x3e, 0xfd, 0xa5, 0x6e, 0xa6,
+  0x02, 0x91, 0xdc, 0x9a, 0x89, 0xf1, 0x98, 0x00, 0x38, 0xce, 0x78, 0xc2, 0x85, 0x64, 0xd6, 0x00,
+  0x34, 0xc6, 0x1f, 0x4c, 0xa4, 0x82, 0x8d, 0x86, 0xbe, 0x3f, 0x1a, 0xf0, 0x1d, 0xf5, 0xb2, 0xfa,
+  0xf8, 0x46, 0xb6, 0x25, 0x46, 0xfd, 0x89, 0x2f, 0xe7, 0x90, 0x35, 0x1a, 0x4f, 0xa7, 0xc4, 0x43,
+  0xdb, 0x9f, 0x0e, 0xbc, 0x19, 0x97, 0xf3, 0xda, 0x11, 0x96, 0x0b, 0x82, 0xd3, 0xd3, 0x2b, 0xeb,
+  0xdb, 0xe7, 0xcc, 0x20, 0xeb, 0xb3, 0x5d, 0x06, 0x9d, 0xc1, 0xff, 0xc6, 0x83, 0x2e, 0xbb, 0xb8,
+  0x60, 0xe3, 0x2e, 0x3b, 0x3b, 0x63, 0x63, 0x5d, 0xef, 0x55, 0xba, 0x28, 0x8d, 0x77, 0x2a, 0x87,
+  0xab, 0xab, 0xa1, 0x42, 0x43, 0x0c, 0xdf, 0x0d, 0x4d, 0xc9, 0x09, 0x5e, 0xbd, 0x2f, 0xe1, 0xbe,
+  0x02, 0x80, 0x68, 0x1c, 0x74, 0xe8, 0xf0, 0x7b, 0x39, 0x0a, 0x1f, 0x06, 0x30, 0x3f, 0xc1, 0xad,
+  0x81, 0x90, 0x9d, 0x8d, 0xef, 0x8b, 0xa4, 0x06, 0x17, 0x1b, 0x23, 0x4e, 0x29, 0x09, 0x49, 0x15,
+  0x3b, 0x66, 0x20, 0xe7, 0xd2, 0xca, 0x55, 0x79, 0xd0, 0x27, 0xa8, 0x88, 0x96, 0xfc, 0x75, 0x0f,
+  0x03, 0x06, 0x0a, 0x54, 0x01, 0xf1, 0x35, 0x9b, 0x22, 0xcb, 0x70, 0x1b, 0x8e, 0x8e, 0xfe, 0x9f,
+  0x35, 0xca, 0x31, 0x1e, 0x6a, 0x9b, 0x26, 0x71, 0x86, 0x91, 0x88, 0xf1, 0x11, 0xbc, 0xa9, 0xdc,
+  0x53, 0xf4, 0x91, 0x00, 0xc3, 0xcd, 0x3f, 0xf0, 0x1a, 0x24, 0x62, 0x0c, 0xfa, 0x40, 0x42, 0xd4,
+  0xd5, 0x6d, 0x77, 0xc0, 0x62, 0x06, 0x78, 0x37, 0xe4, 0xe5, 0x9c, 0x2e, 0xce, 0xa4, 0xa4, 0xe5,
+  0xcd, 0x43, 0x5c, 0x82, 0xe9, 0x6a, 0x8f, 0x94, 0xa9, 0xbe, 0x81, 0xec, 0x19, 0x40, 0x3f, 0x7b,
+  0x0c, 0x7f, 0x1f, 0x3e, 0x6c, 0x4b, 0xcc, 0x7e, 0x7e, 0x1f, 0xa0, 0xc8, 0x88, 0x41, 0x8b, 0x82,
+  0x41, 0x84, 0x05, 0xba, 0x7f, 0xcd, 0x86, 0xdd, 0x83, 0xb7, 0x31, 0xe4, 0x88, 0x09, 0x23, 0x60,
+  0x1e, 0x0f, 0x77, 0x62, 0x56, 0x2b, 0x98, 0x16, 0xee, 0x06, 0x02, 0x6e, 0x19, 0x40, 0x09, 0xf0,
+  0xc3, 0x1e, 0x5d, 0xf5, 0xd8, 0xa4, 0xcb, 0xfe, 0xbd, 0xf1, 0xd0, 0x9e, 0xe2, 0xd3, 0xed, 0x13,
+  0xe2, 0xe7, 0xa0, 0x3b, 0xdf, 0x05, 0xdc, 0xae, 0x02, 0xef, 0x23, 0x98, 0x3a, 0x70, 0x7a, 0x38,
+  0x2b, 0xc1, 0xee, 0x4b, 0xd0, 0xb6, 0xd5, 0x02, 0x5b, 0xb1, 0x4c, 0x11, 0x32, 0xc6, 0xca, 0x1a,
+  0x8c, 0xe2, 0xa1, 0x7a, 0x30, 0xa1, 0x7b, 0xfb, 0x10, 0xae, 0x21, 0xc3, 0xde, 0x83, 0xb1, 0x82,
+  0x79, 0x0e, 0xd3, 0x1e, 0x3c, 0x13, 0x18, 0x3a, 0xb0, 0x05, 0x8b, 0x1e, 0xa3, 0x69, 0xf4, 0x72,
+  0x7e, 0x90, 0x80, 0x0f, 0x62, 0x73, 0x86, 0x9c, 0x40, 0xc3, 0x60, 0xd0, 0xc8, 0x01, 0xd1, 0xb8,
+  0x60, 0x03, 0xdc, 0xd8, 0x76, 0xf9, 0xae, 0x3f, 0xa2, 0x15, 0x5b, 0xc3, 0x10, 0xec, 0x01, 0xee,
+  0x81, 0x00, 0xce, 0xfc, 0x07, 0x5e, 0x2e, 0xe8, 0xf1, 0x77, 0x38, 0x7c, 0x1a, 0xed, 0xd5, 0x2e,
+  0xde, 0x67, 0x7d, 0xd4, 0x7f, 0x02, 0x09, 0x43, 0xec, 0x17, 0xf0, 0xe1, 0xc6, 0x1e, 0x94, 0xef,
+  0xfa, 0x7d, 0x85, 0x8d, 0x03, 0x0a, 0x87, 0xb0, 0xe1, 0x95, 0x4b, 0x57, 0x0e, 0x5d, 0xb5, 0x08,
+  0x02, 0x97, 0xe1, 0x16, 0x73, 0x46, 0x5b, 0xb5, 0xe7, 0x0c, 0x67, 0x8b, 0x98, 0x33, 0xac, 0xbd,
+  0x1a, 0x1e, 0x00, 0xcc, 0x6c, 0x35, 0x97, 0xf5, 0x9d, 0x71, 0x63, 0x80, 0x3b, 0x67, 0x2e, 0xfc,
+  0x71, 0xe6, 0xcc, 0xc1, 0xa8, 0x79, 0xce, 0x30, 0x49, 0x34, 0x80, 0x57, 0xd0, 0xbb, 0xdf, 0xda,
+  0xbb, 0x29, 0xc8, 0x97, 0xef, 0xad, 0x2b, 0x9c, 0x95, 0x00, 0xe1, 0xe5, 0x7b, 0x9b, 0x2e, 0x1d,
+  0xbc, 0xec, 0xd3, 0xa5, 0x8b, 0x97, 0x03, 0xba, 0xf4, 0xe6, 0x9a, 0xbe, 0x43, 0x7a, 0x25, 0xb0,
+  0xd5, 0x88, 0x2e, 0x7d, 0xbc, 0x1c, 0xd3, 0xe5, 0x02, 0x2f, 0x27, 0x74, 0xb9, 0xdc, 0xbf, 0xab,
+  0x2a, 0xa6, 0x13, 0x1e, 0x35, 0x7b, 0x3e, 0xe8, 0x6b, 0x2d, 0x14, 0xb4, 0xfd, 0x49, 0x63, 0x8f,
+  0xb1, 0x20, 0xa4, 0xb5, 0xc7, 0x2f, 0x4d, 0x50, 0xbe, 0xe7, 0x1c, 0x6b, 0x0e, 0xd7, 0xb8, 0xbe,
+  0x4f, 0xf5, 0x40, 0x09, 0xa3, 0x64, 0x59, 0xc9, 0x64, 0xf4, 0xd8, 0x75, 0xcb, 0xb6, 0x01, 0xe8,
+  0xb0, 0xb7, 0x28, 0x23, 0x3e, 0x16, 0x21, 0xbb, 0xda, 0x85, 0x88, 0xd5, 0x97, 0x5e, 0x7e, 0x10,
+  0x93, 0x39, 0xb7, 0xe5, 0xd4, 0x0a, 0x5c, 0x3b, 0x96, 0xfe, 0x21, 0xdd, 0x91, 0xd5, 0x83, 0xb4,
+  0xb4, 0x02, 0xd7, 0x5a, 0x46, 0xa0, 0xb8, 0x1d, 0x10, 0x69, 0x77, 0xbf, 0xa8, 0x35, 0x02, 0x59,
+  0x31, 0x90, 0x99, 0x14, 0xed, 0x4d, 0xe1, 0xc8, 0xcd, 0x27, 0xc4, 0x1a, 0x43, 0xcb, 0x51, 0x2f,
+  0x58, 0x60, 0x61, 0xed, 0x9c, 0xa9, 0xb5, 0x27, 0x57, 0x66, 0x11, 0x0f, 0x40, 0x83, 0xe9, 0x8a,
+  0x3e, 0x21, 0x15, 0x0a, 0xf6, 0xa8, 0xa1, 0x03, 0x35, 0x89, 0x49, 0xa4, 0x95, 0x4e, 0xa6, 0x04,
+  0x6e, 0x74, 0x14, 0x6b, 0x20, 0x9f, 0x23, 0x5f, 0xdc, 0x65, 0xa7, 0x9a, 0x45, 0x81, 0x4a, 0x5a,
+  0x52, 0x03, 0x2e, 0xbb, 0x69, 0xa5, 0x53, 0xda, 0x1c, 0x2b, 0xd1, 0x81, 0x7b, 0x74, 0x48, 0xd0,
+  0x8e, 0x99, 0xc5, 0x97, 0x19, 0x2e, 0x24, 0x1a, 0xf6, 0xb8, 0x0b, 0x89, 0x98, 0x47, 0x27, 0xc4,
+  0x0c, 0x08, 0x7c, 0x3a, 0x56, 0xa7, 0x9b, 0x6f, 0xad, 0xec, 0x1c, 0xb6, 0x97, 0x46, 0x55, 0xbd,
+  0xea, 0x9b, 0x94, 0x6a, 0x52, 0x2a, 0xed, 0x75, 0x68, 0x17, 0x13, 0x1e, 0x9d, 0x28, 0x9f, 0x41,
+  0xf9, 0x8c, 0x53, 0x16, 0x8d, 0x93, 0xd6, 0xda, 0xbd, 0x44, 0xcd, 0xa2, 0xc0, 0xbe, 0xc5, 0xb0,
+  0x96, 0x9d, 0x4a, 0xe5, 0x82, 0x8d, 0x25, 0x37, 0xf0, 0xe9, 0xb6, 0x3f, 0xe9, 0x37, 0x2a, 0x35,
+  0x4b, 0xe3, 0xd5, 0xc5, 0x8e, 0xc6, 0x58, 0x70, 0xa3, 0xfb, 0x6f, 0xba, 0xa5, 0x35, 0x3c, 0xfc,
+  0x68, 0x2e, 0x7e, 0xcd, 0x57, 0xd3, 0xf0, 0x0b, 0x84, 0x41, 0xe4, 0xe3, 0xa7, 0x77, 0xbc, 0x7c,
+  0xd9, 0x45, 0xcd, 0x34, 0x59, 0x0b, 0x95, 0xfb, 0x03, 0xca, 0x8b, 0xcf, 0x55, 0x81, 0xb8, 0x6a,
+  0xa9, 0x0e, 0x25, 0x58, 0xda, 0x11, 0x06, 0xfa, 0xf3, 0x7d, 0x7c, 0x23, 0x92, 0xa7, 0x1c, 0x32,
+  0xf8, 0xae, 0x29, 0x22, 0x2f, 0xfd, 0x39, 0xc8, 0x96, 0x46, 0x07, 0x70, 0x77, 0xba, 0xb8, 0x14,
+  0xb6, 0xf8, 0x35, 0x58, 0xd3, 0x32, 0x17, 0x9e, 0xab, 0xed, 0xb4, 0x2d, 0xae, 0x49, 0xdd, 0x2e,
+  0x26, 0x66, 0x6d, 0x26, 0xb7, 0x2c, 0x86, 0x3a, 0x1b, 0x54, 0x34, 0xe6, 0xc2, 0x0c, 0xc6, 0x33,
+  0x09, 0x68, 0x24, 0xe2, 0x9b, 0x88, 0x74, 0x27, 0xa5, 0xa5, 0x9f, 0x40, 0xae, 0xca, 0xe7, 0x16,
+  0x86, 0x2f, 0x40, 0x8e, 0x68, 0x22, 0x23, 0x41, 0x5b, 0x87, 0xe9, 0xf3, 0x2e, 0x2d, 0x04, 0x01,
+  0xdb, 0x02, 0xb7, 0x69, 0x74, 0x4b, 0x76, 0x43, 0xee, 0x43, 0x06, 0x11, 0x0f, 0xbb, 0x55, 0x1b,
+  0xd2, 0x7a, 0x7c, 0x41, 0xd1, 0x7b, 0xce, 0xe4, 0x94, 0xa3, 0x19, 0xf9, 0x74, 0xc9, 0x93, 0xa7,
+  0xb8, 0x5f, 0xc9, 0x34, 0x4d, 0xc2, 0xa9, 0xf6, 0x2d, 0x3d, 0x7f, 0xf1, 0xf3, 0x93, 0x56, 0x6e,
+  0x51, 0x5d, 0x59, 0x53, 0x4c, 0x7c, 0x75, 0xd9, 0x2c, 0x08, 0x51, 0xdb, 0x47, 0xc8, 0x13, 0x2a,
+  0x06, 0x19, 0x8a, 0x08, 0x90, 0x8c, 0xbc, 0x42, 0xd9, 0xe0, 0x5b, 0x5a, 0x91, 0x7c, 0x80, 0x9a,
+  0x4a, 0xed, 0x0a, 0xbd, 0x65, 0x0f, 0x0f, 0xcd, 0x7b, 0xe8, 0xd7, 0x79, 0x50, 0xd2, 0x14, 0x82,
+  0x54, 0xd6, 0x1c, 0x42, 0x41, 0xb2, 0x95, 0x95, 0x29, 0xba, 0xd4, 0x16, 0xa6, 0x8a, 0x6d, 0x75,
+  0x48, 0xfe, 0x01, 0xe5, 0x29, 0x5d, 0x89, 0x4a, 0xf6, 0xd5, 0x14, 0xa9, 0xca, 0x40, 0x0f, 0x5b,
+  0xe8, 0x92, 0x7c, 0xe7, 0x51, 0x7a, 0x43, 0xbb, 0x9b, 0x4b, 0x65, 0xab, 0x2d, 0x92, 0x96, 0x11,
+  0xc8, 0x4e, 0xe6, 0x66, 0xfd, 0x4b, 0x16, 0xff, 0xe2, 0xd1, 0xda, 0x6f, 0xcb, 0x3e, 0xb3, 0x65,
+  0x7c, 0xa3, 0x4c, 0x42, 0xa7, 0x54, 0x37, 0xad, 0xac, 0x39, 0x64, 0x4b, 0xd0, 0x69, 0x9a, 0xd3,
+  0x26, 0xfb, 0x31, 0x86, 0x3b, 0x2c, 0x9e, 0xf2, 0x54, 0x19, 0x0d, 0x5c, 0x54, 0x02, 0xf9, 0xab,
+  0xaf, 0xef, 0x74, 0xba, 0xf3, 0xcf, 0x5c, 0xa2, 0x57, 0x73, 0xb3, 0x98, 0xf6, 0x6a, 0x28, 0xea,
+  0x41, 0x13, 0x82, 0x36, 0x12, 0x56, 0x55, 0xeb, 0x73, 0x5d, 0xc8, 0x85, 0xef, 0xb1, 0x08, 0x2c,
+  0x8f, 0x14, 0x69, 0x1a, 0x48, 0xe3, 0x94, 0x57, 0xbe, 0xcf, 0x4a, 0xe6, 0xb4, 0x4d, 0x07, 0xb4,
+  0x06, 0xb1, 0x7e, 0x88, 0xc9, 0xcb, 0xb7, 0x6a, 0xe1, 0x86, 0x80, 0xa2, 0xac, 0xbe, 0xdd, 0x0c,
+  0xd7, 0x6e, 0xb7, 0xcb, 0xbf, 0x62, 0x64, 0xca, 0x68, 0xb5, 0xaf, 0x62, 0x94, 0x0c, 0x46, 0xfe,
+  0x08, 0x1a, 0x77, 0x77, 0xc0, 0xde, 0xc9, 0x15, 0xb9, 0xbb, 0x90, 0x56, 0x8a, 0x98, 0x21, 0x92,
+  0xa4, 0xbb, 0x63, 0xc8, 0x60, 0x29, 0xdf, 0xc8, 0x9a, 0x74, 0xb1, 0x88, 0xdf, 0x5c, 0xa5, 0x51,
+  0x9b, 0x49, 0x5a, 0x81, 0xd0, 0x91, 0x86, 0xa2, 0x84, 0x0e, 0x93, 0xe9, 0xe1, 0xc3, 0x9c, 0xc0,
+  0x8b, 0xf2, 0xee, 0xc0, 0x5d, 0x84, 0xb4, 0x14, 0xda, 0xf7, 0x6b, 0x61, 0x75, 0x8b, 0xbc, 0x5c,
+  0xf4, 0x2a, 0x84, 0x67, 0x5b, 0x96, 0x05, 0xb1, 0xa9, 0xa2, 0xa6, 0x87, 0xdf, 0x31, 0xb5, 0x76,
+  0xf1, 0x75, 0xb7, 0x7e, 0x68, 0xa4, 0xaa, 0x2b, 0xd1, 0xef, 0xa0, 0x3e, 0x97, 0x8a, 0x34, 0x2e,
+  0xcf, 0x77, 0xcb, 0x66, 0x5b, 0x81, 0x57, 0xc2, 0x06, 0xfb, 0x76, 0x0f, 0x6e, 0x6e, 0x39, 0x5a,
+  0x60, 0x9b, 0xef, 0xec, 0x70, 0x77, 0x4f, 0xae, 0xeb, 0x9f, 0x36, 0x97, 0xa4, 0x76, 0x4f, 0x97,
+  0xbb, 0xfd, 0x76, 0x22, 0x3f, 0x0e, 0x43, 0x9b, 0xd3, 0xc4, 0x81, 0x9e, 0x2d, 0x6f, 0x7e, 0xf0,
+  0x62, 0xc7, 0xf6, 0x70, 0x83, 0xec, 0x58, 0x5f, 0x16, 0x83, 0x88, 0xbe, 0x78, 0x45, 0x5e, 0x83,
+  0x3c, 0xf1, 0xab, 0xef, 0x3a, 0x87, 0x58, 0x6c, 0xb5, 0xb3, 0xd9, 0x55, 0xdb, 0x3d, 0x3d, 0xa6,
+  0xac, 0x30, 0x9e, 0xb1, 0xb9, 0x35, 0xd5, 0x6e, 0x44, 0xb9, 0xd0, 0x05, 0x9c, 0xc3, 0x28, 0x7b,
+  0x9f, 0xad, 0x56, 0xfb, 0x87, 0x0f, 0x46, 0xed, 0xd3, 0xfe, 0xbc, 0x53, 0xb9, 0xe9, 0xa8, 0x3c,
+  0x0e, 0x40, 0x23, 0xb7, 0x28, 0x1c, 0xb0, 0x65, 0x79, 0xb7, 0x51, 0xd1, 0x60, 0xcd, 0x77, 0x07,
+  0x02, 0x52, 0xb4, 0x10, 0x2b, 0x18, 0x0c, 0x78, 0xa7, 0x36, 0x94, 0x77, 0x92, 0xb2, 0xf0, 0xb6,
+  0x75, 0x13, 0xf4, 0xfe, 0x3d, 0xfe, 0x07, 0x06, 0xe7, 0x9a, 0x78, 0xf3, 0xee, 0x90, 0x05, 0x6e,
+  0x0e, 0xb1, 0x5f, 0x14, 0xf8, 0x98, 0xf2, 0xe5, 0x79, 0x2a, 0x1d, 0x99, 0xe9, 0xe1, 0x75, 0x24,
+  0xb7, 0xd7, 0x6e, 0x0f, 0x90, 0xed, 0x30, 0xa2, 0xb8, 0x77, 0x20, 0x65, 0xab, 0x00, 0x14, 0x52,
+  0x6e, 0xf0, 0x94, 0xc7, 0x20, 0xbd, 0x79, 0xdb, 0x37, 0x5f, 0x28, 0x4a, 0x97, 0xdf, 0x8d, 0xa1,
+  0x20, 0x1d, 0x58, 0x15, 0xa4, 0xcb, 0x32, 0x3c, 0xb5, 0xb7, 0x17, 0xc8, 0xe0, 0xe9, 0x07, 0xda,
+  0xad, 0xda, 0x9a, 0x0b, 0x17, 0x9b, 0xd6, 0xb5, 0x67, 0x7c, 0xfe, 0xe0, 0x1c, 0xa8, 0xbc, 0x7d,
+  0x0d, 0x22, 0x64, 0x1b, 0xd4, 0x01, 0xf7, 0xfa, 0xc9, 0x2d, 0xab, 0x07, 0x67, 0x42, 0xdb, 0x13,
+  0xfb, 0x4d, 0xca, 0x7e, 0x87, 0x2c, 0x09, 0x83, 0x8f, 0x42, 0xd4, 0xe7, 0xda, 0x7d, 0x78, 0xa5,
+  0x63, 0x5c, 0x3e, 0x6a, 0x83, 0xbf, 0xeb, 0x9c, 0x40, 0x01, 0xeb, 0xa1, 0x26, 0x8d, 0x31, 0x65,
+  0xae, 0x9b, 0x9f, 0x97, 0xf0, 0x4d, 0x3c, 0x92, 0x87, 0xb7, 0x7f, 0x8d, 0x3a, 0x87, 0x87, 0x62,
+  0x39, 0x8a, 0x03, 0xf6, 0x3d, 0x94, 0x29, 0xaa, 0xec, 0x7f, 0xc8, 0x1f, 0xe2, 0x8e, 0x13, 0xe8,
+  0xff, 0x24, 0x8c, 0x1d, 0xe3, 0x7d, 0xfe, 0xf0, 0xaa, 0xc7, 0x7e, 0xa3, 0xcf, 0xed, 0xc0, 0x8c,
+  0xc6, 0x9d, 0xed, 0x27, 0xb4, 0x8e, 0xda, 0x61, 0x77, 0x5d, 0x10, 0x61, 0xde, 0xc8, 0xcc, 0xaa,
+  0x9f, 0x7e, 0xd0, 0x24, 0x27, 0xef, 0x4a, 0x7b, 0x28, 0xfc, 0x54, 0x26, 0x21, 0x72, 0xef, 0x7b,
+  0xdb, 0x57, 0x25, 0xaa, 0xdf, 0x4b, 0x82, 0x34, 0x3e, 0xcf, 0xda, 0x20, 0x53, 0x79, 0x24, 0x5f,
+  0x9e, 0xdb, 0x9d, 0xfa, 0xf6, 0xf8, 0xfb, 0xe4, 0x45, 0x39, 0x61, 0xbd, 0x0a, 0x5f, 0xfe, 0x3f,
+  0xe4, 0x1d, 0x34, 0xb5, 0x0f, 0xcf, 0x3a, 0xda, 0x36, 0x1a, 0x83, 0xf8, 0xd5, 0x07, 0x30, 0xe8,
+  0x40, 0x5c, 0x7e, 0x26, 0x57, 0x9e, 0x86, 0x43, 0x1c, 0xa6, 0x6a, 0x62, 0x06, 0x91, 0x1b, 0x6e,
+  0x3c, 0x34, 0x1e, 0xa4, 0xa7, 0xed, 0x29, 0x6d, 0xbe, 0x4e, 0x95, 0x77, 0x3c, 0xe4, 0x90, 0x9d,
+  0x3e, 0x0d, 0x48, 0xe5, 0x01, 0x0a, 0xeb, 0xb0, 0xe2, 0x78, 0x8e, 0x4f, 0x2e, 0xf0, 0x1c, 0x50,
+  0x28, 0xf7, 0xb7, 0x44, 0xee, 0x29, 0x70, 0xab, 0x73, 0x18, 0xe7, 0xcc, 0x08, 0x80, 0x76, 0x5b,
+  0xee, 0xd4, 0x45, 0xe9, 0x55, 0x71, 0xd6, 0xa6, 0xf2, 0x2e, 0x88, 0x38, 0xfa, 0x03, 0x67, 0x6c,
+  0x7e, 0x32, 0xae, 0x32, 0x63, 0xf1, 0x01, 0xe8, 0xaf, 0xb2, 0x21, 0xbb, 0x30, 0x6d, 0xaa, 0xd3,
+  0x0e, 0xdb, 0x3f, 0x42, 0xc1, 0xca, 0xd0, 0x08, 0x25, 0x4c, 0xaa, 0x84, 0x69, 0x38, 0x12, 0x4d,
+  0x8f, 0x45, 0xe4, 0x42, 0xfa, 0xff, 0xee, 0xcd, 0xb7, 0x68, 0xa1, 0xc1, 0x67, 0x46, 0x59, 0x2e,
+  0xf5, 0x16, 0xf2, 0x72, 0x71, 0x94, 0x53, 0x14, 0x36, 0xcf, 0x6f, 0xdb, 0x05, 0xb1, 0x4d, 0xf8,
+  0x52, 0xad, 0xc9, 0xbe, 0x5f, 0x98, 0xbe, 0x77, 0x3b, 0x95, 0xe2, 0x62, 0x6d, 0x3b, 0x55, 0xd9,
+  0x33, 0x91, 0xca, 0x3d, 0xac, 0x9f, 0x1f, 0xea, 0x95, 0xf5, 0xb5, 0x5b, 0x3f, 0x9f, 0x74, 0x48,
+  0xec, 0x2f, 0xfe, 0x49, 0x51, 0xbf, 0xf8, 0xbd, 0xe3, 0xfd, 0xd2, 0x8e, 0x20, 0x0c, 0x86, 0x9b,
+  0x3b, 0xc7, 0xf6, 0xd1, 0xd6, 0x72, 0x3e, 0x7a, 0x3f, 0xd6, 0xfc, 0xd3, 0x05, 0xa8, 0x9d, 0x80,
+  0xf2, 0x36, 0xa5, 0x2d, 0xea, 0x95, 0x6d, 0x54, 0x78, 0x3a, 0x9f, 0x16, 0x0c, 0xd2, 0x38, 0x0f,
+  0xc2, 0x78, 0x56, 0xec, 0xe0, 0x24, 0x59, 0x52, 0x81, 0xef, 0x90, 0x91, 0xd5, 0xf7, 0x3c, 0x0d,
+  0xf3, 0x4d, 0x71, 0x7a, 0x89, 0x1c, 0x96, 0xd6, 0x7e, 0xc6, 0xde, 0xa8, 0xcf, 0x4f, 0x80, 0x0b,
+  0x6d, 0x42, 0x93, 0xb5, 0x3b, 0x0d, 0x6e, 0xcb, 0xea, 0x22, 0x8a, 0x5c, 0x4a, 0xca, 0xff, 0x79,
+  0xa9, 0x1c, 0x84, 0xae, 0x7b, 0x12, 0x39, 0xb2, 0x50, 0xd8, 0x4e, 0x63, 0xa3, 0xf6, 0x25, 0x70,
+  0xd0, 0x4b, 0x9f, 0xbe, 0xe1, 0x8b, 0x7b, 0x27, 0x6f, 0x97, 0xa8, 0x77, 0x45, 0xea, 0x26, 0xb3,
+  0x19, 0x8d, 0xb9, 0x87, 0x08, 0x30, 0xaf, 0x8d, 0x36, 0x8f, 0xa6, 0x13, 0x07, 0x7b, 0xd8, 0x60,
+  0xdf, 0xf4, 0xa5, 0x41, 0xaa, 0x38, 0xbf, 0x0c, 0x26, 0x7f, 0xf4, 0x87, 0x26, 0x8b, 0x34, 0xd4,
+  0x5a, 0xaa, 0x98, 0xf3, 0xec, 0x8f, 0x49, 0x14, 0x09, 0xe3, 0x3d, 0xd3, 0xc4, 0xf6, 0x58, 0xbe,
+  0xf5, 0x33, 0x5e, 0xf7, 0x49, 0x21, 0xef, 0x9f, 0x3e, 0xb6, 0x24, 0x8c, 0xcb, 0xa2, 0xf8, 0xa2,
+  0x3f, 0xed, 0xaa, 0x78, 0x50, 0x0c, 0x17, 0x43, 0xeb, 0xc6, 0xb1, 0x7c, 0xf9, 0x71, 0xf2, 0xea,
+  0x41, 0x52, 0xd5, 0x63, 0xae, 0x6b, 0x49, 0x5f, 0x79, 0x52, 0xdf, 0x88, 0x53, 0x5f, 0xa1, 0x23,
+  0xc6, 0x22, 0x70, 0x6d, 0x87, 0xbd, 0x49, 0x5b, 0xcb, 0x92, 0x2d, 0x1e, 0x9d, 0x6c, 0x1b, 0x5d,
+  0x39, 0x6d, 0xd3, 0x0f, 0xe8, 0xd3, 0x58, 0x8a, 0x87, 0xb7, 0x55, 0xa6, 0xdc, 0x58, 0x49, 0xd4,
+  0x2f, 0x07, 0x3e, 0x0e, 0x43, 0xdd, 0x8a, 0x20, 0x7e, 0x75, 0x46, 0xad, 0x6c, 0xd3, 0xb7, 0x67,
+  0x9b, 0x87, 0x51, 0xe8, 0xf1, 0xce, 0xcf, 0x15, 0xb5, 0x9c, 0x60, 0xa9, 0x7c, 0xc1, 0x8e, 0x8e,
+  0x0d, 0xa4, 0xe0, 0xa4, 0x6e, 0x96, 0x71, 0x58, 0xa4, 0xf2, 0xb8, 0xd0, 0x24, 0x38, 0x7d, 0xf7,
+  0x03, 0x97, 0x9b, 0xa8, 0x64, 0xbf, 0xe7, 0xab, 0x56, 0xad, 0xa7, 0xd7, 0x9b, 0x93, 0xb1, 0xfd,
+  0x9b, 0x84, 0xdb, 0x2f, 0xdb, 0xc2, 0xf8, 0xeb, 0x12, 0x90, 0x98, 0x1e, 0xe5, 0xf2, 0xdf, 0xb1,
+  0x2a, 0x97, 0x7f, 0x03, 0x44, 0x7e, 0xd1, 0x49, 0x7e, 0x1f, 0xc9, 0x0b, 0x12, 0xe2, 0xb7, 0x3c,
+  0x07, 0xb8, 0x33, 0x15, 0x6e, 0xef, 0xaa, 0xfd, 0x04, 0x48, 0xb3, 0x9b, 0xfc, 0x86, 0x6b, 0x99,
+  0x64, 0xa2, 0xb6, 0xfa, 0x49, 0xd7, 0xce, 0x7c, 0xd7, 0xd9, 0x22, 0x3c, 0x9c, 0x1d, 0x44, 0x20,
+  0xd0, 0x97, 0x6f, 0x7f, 0xf8, 0xbe, 0x0c, 0xa9, 0xf2, 0x55, 0x5a, 0x92, 0xd6, 0x8e, 0xef, 0xd2,
+  0xd2, 0xfb, 0x8e, 0x66, 0x35, 0xfe, 0x90, 0xb5, 0xb0, 0xfb, 0x7d, 0xff, 0xb6, 0x65, 0x38, 0x3b,
+  0xbf, 0xa5, 0xd8, 0xd6, 0x70, 0x77, 0x84, 0xbd, 0xe5, 0x33, 0xad, 0x95, 0xb7, 0x14, 0x3f, 0xb6,
+  0x2d, 0x75, 0x5f, 0xe9, 0x68, 0x51, 0x9c, 0x7b, 0x14, 0x97, 0xf4, 0x01, 0x45, 0x7b, 0x39, 0xe8,
+  0x4e, 0xf3, 0x9d, 0xbd, 0xb3, 0x93, 0xfc, 0xdb, 0xaa, 0x67, 0x27, 0xf2, 0x03, 0xe7, 0x67, 0x27,
+  0xf2, 0xff, 0x07, 0xf0, 0x7f, 0x01, 0x30, 0xfe, 0x76, 0x6c, 0x18, 0x70, 0x00, 0x00,
+};
+
+// dark mode: 28696 bytes of HTML, 7274 bytes gzip-compressed
+#define WEB_UI_DARK_ETAG "\"b513bb8d348d066c\""
+static const uint8_t WEB_UI_DARK_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3d, 0x6b, 0x73, 0xdb, 0x46,
+  0x92, 0xdf, 0xf3, 0x2b, 0x26, 0xda, 0x8a, 0x09, 0xc6, 0x14, 0x04, 0xf0, 0x4d, 0x51, 0x52, 0xce,
+  0x76, 0xe4, 0x38, 0x97, 0x87, 0x5d, 0x96, 0x9d, 0xec, 0x9e, 0x57, 0x97, 0x1a, 0x00, 0x03, 0x12,
+  0x6b, 0x10, 0xe0, 0x02, 0xa0, 0x64, 0x25, 0xab, 0xab, 0xba, 0xdf, 0x70, 0x3f, 0xe0, 0xfe, 0xe2,
+  0xfd, 0x84, 0xeb, 0xee, 0x19, 0x80, 0x78, 0x0c, 0x48, 0xca, 0x4e, 0xb6, 0xee, 0xe4, 0x8a, 0x84,
+  0xc7, 0x4c, 0x77, 0x4f, 0x77, 0x4f, 0xbf, 0x66, 0x06, 0x39, 0xfb, 0xfc, 0xeb, 0x97, 0xcf, 0xde,
+  0xfc, 0xe5, 0xd5, 0x25, 0x5b, 0x66, 0xab, 0xf0, 0xe2, 0xb3, 0x33, 0xfc, 0xc3, 0x42, 0x1e, 0x2d,
+  0xce, 0x8f, 0x44, 0x74, 0x84, 0x0f, 0x04, 0xf7, 0x2e, 0x3e, 0x63, 0xf0, 0x73, 0xb6, 0x12, 0x19,
+  0x67, 0xee, 0x92, 0x27, 0xa9, 0xc8, 0xce, 0x8f, 0xde, 0xbe, 0x79, 0x7e, 0x3c, 0x3d, 0x2a, 0xbf,
+  0x8a, 0xf8, 0x4a, 0x9c, 0x1f, 0xdd, 0x04, 0xe2, 0x76, 0x1d, 0x27, 0xd9, 0x11, 0x73, 0xe3, 0x28,
+  0x13, 0x11, 0x34, 0xbd, 0x0d, 0xbc, 0x6c, 0x79, 0xee, 0x89, 0x9b, 0xc0, 0x15, 0xc7, 0x74, 0xd3,
+  0x63, 0x41, 0x14, 0x64, 0x01, 0x0f, 0x8f, 0x53, 0x97, 0x87, 0xe2, 0xdc, 0x36, 0xad, 0x1c, 0x54,
+  0x16, 0x64, 0xa1, 0xb8, 0xb8, 0xbc, 0x7a, 0x35, 0xe8, 0xb3, 0xe7, 0x41, 0xb2, 0xba, 0xe5, 0x89,
+  0x60, 0x6f, 0xd7, 0x61, 0xcc, 0x3d, 0x91, 0x9c, 0x9d, 0xc8, 0xd7, 0xb2, 0x69, 0x9a, 0xdd, 0xe5,
+  0xd7, 0xf8, 0xf3, 0x25, 0xfb, 0xad, 0xb8, 0xc6, 0x9f, 0x15, 0x4f, 0x16, 0x41, 0x74, 0xca, 0xac,
+  0x79, 0xe5, 0xf1, 0x9a, 0x7b, 0x5e, 0x10, 0x2d, 0x1a, 0xcf, 0x9d, 0xf8, 0xc3, 0x71, 0x1a, 0xfc,
+  0x4a, 0xaf, 0x9c, 0x38, 0x01, 0x6c, 0xc7, 0xf0, 0x68, 0xdb, 0xe6, 0xbe, 0xb8, 0xfa, 0x6c, 0xdb,
+  0xc5, 0xbb, 0xab, 0x21, 0xf5, 0x61, 0xd0, 0xc7, 0x3e, 0x5f, 0x05, 0xe1, 0xdd, 0x29, 0xeb, 0x5c,
+  0x89, 0x45, 0x0c, 0xd4, 0x7f, 0xdb, 0xe9, 0xb1, 0x37, 0x7c, 0x19, 0xaf, 0x78, 0x8f, 0x7d, 0x23,
+  0x22, 0x71, 0x03, 0x7f, 0x7f, 0x12, 0x89, 0xc7, 0x23, 0xb8, 0x48, 0x79, 0x94, 0x1e, 0xa7, 0x22,
+  0x09, 0xfc, 0x1a, 0x3d, 0xdc, 0x7d, 0xbf, 0x48, 0xe2, 0x4d, 0xe4, 0x9d, 0xb2, 0x30, 0x88, 0x04,
+  0x4f, 0x8e, 0x17, 0x09, 0xf7, 0x02, 0x60, 0xa9, 0x61, 0x0f, 0x46, 0x9e, 0x58, 0xf4, 0xd8, 0x9f,
+  0xfa, 0xee, 0x40, 0x8c, 0x2c, 0x66, 0x7d, 0x01, 0xd7, 0x83, 0xe1, 0x70, 0x36, 0x12, 0xcc, 0xb6,
+  0xac, 0x2f, 0xba, 0x55, 0x50, 0xab, 0x20, 0x3a, 0x5e, 0x8a, 0x60, 0xb1, 0xcc, 0x4e, 0xf1, 0xf5,
+  0xcd, 0xb2, 0xfa, 0xda, 0x0b, 0xd2, 0x75, 0xc8, 0x81, 0x5e, 0x3f, 0x14, 0x1f, 0xaa, 0xaf, 0x78,
+  0x18, 0x2c, 0xa2, 0xe3, 0x20, 0x13, 0xab, 0xf4, 0x94, 0xb9, 0x80, 0x5a, 0x24, 0xd5, 0x06, 0x7f,
+  0xdb, 0xa4, 0x59, 0xe0, 0xdf, 0x1d, 0x2b, 0x61, 0xeb, 0x1b, 0x15, 0x2c, 0xef, 0x5b, 0xeb, 0xdd,
+  0x1c, 0x35, 0x11, 0x0e, 0x87, 0xd1, 0x26, 0x35, 0xbe, 0x96, 0xb9, 0xf1, 0xa7, 0xfe, 0xb3, 0xc1,
+  0xe5, 0xa8, 0x21, 0x3e, 0x12, 0x19, 0x72, 0x68, 0x93, 0xd6, 0x31, 0x15, 0xf2, 0x5d, 0x72, 0x2f,
+  0xbe, 0x05, 0xd1, 0xd3, 0x7b, 0x36, 0xc4, 0x5f, 0xc9, 0xc2, 0xe1, 0x86, 0xd5, 0xa3, 0x7f, 0xa6,
+  0xdd, 0x6d, 0xa1, 0x7c, 0xd8, 0x80, 0xb7, 0xe2, 0x1f, 0xa4, 0x32, 0x9f, 0xb2, 0x91, 0xd5, 0x78,
+  0xab, 0xde, 0xa0, 0x30, 0xaa, 0x2f, 0x32, 0xf1, 0x21, 0x3b, 0x26, 0xb6, 0x36, 0x79, 0xa5, 0x63,
+  0x48, 0x18, 0x2f, 0x62, 0x9d, 0x8e, 0x81, 0xaa, 0x0a, 0x18, 0xa6, 0x39, 0x12, 0xab, 0x79, 0xf3,
+  0xed, 0xad, 0x92, 0xb6, 0x13, 0x87, 0x5e, 0xf5, 0xb5, 0x1b, 0x87, 0x71, 0x02, 0x3c, 0x1c, 0x3e,
+  0x99, 0x59, 0x97, 0xfd, 0xb9, 0x66, 0xc6, 0x80, 0xda, 0x67, 0x59, 0xbc, 0x42, 0xe2, 0xf7, 0x49,
+  0x2b, 0xdd, 0x38, 0x34, 0x21, 0x6b, 0x04, 0xe6, 0x38, 0x9e, 0x5b, 0xf8, 0x6f, 0x27, 0x8e, 0x41,
+  0x83, 0x73, 0xa5, 0xd1, 0xd9, 0xa6, 0x5d, 0x1e, 0x9d, 0x8e, 0x82, 0x0d, 0x59, 0x86, 0x63, 0x30,
+  0x12, 0xbc, 0xae, 0x31, 0xa4, 0x10, 0x80, 0x01, 0x64, 0xec, 0xf1, 0x74, 0x29, 0x3c, 0xf6, 0x27,
+  0xcf, 0xf3, 0x76, 0x6a, 0x8d, 0x3d, 0xaa, 0x53, 0x53, 0x51, 0x00, 0x8d, 0x56, 0xe5, 0x46, 0x06,
+  0xc7, 0x51, 0xb7, 0x28, 0x59, 0x02, 0x53, 0x1b, 0xcc, 0x5c, 0x0c, 0xef, 0x79, 0x18, 0x32, 0xcb,
+  0x1c, 0xa4, 0x4c, 0xf0, 0x54, 0xd4, 0x24, 0xb2, 0x49, 0x52, 0x64, 0xd7, 0x3a, 0x0e, 0x34, 0x53,
+  0x27, 0xce, 0x21, 0x24, 0x22, 0xe4, 0x59, 0x70, 0x23, 0x0e, 0xe6, 0xc7, 0xe9, 0x32, 0xbe, 0x69,
+  0xce, 0x23, 0x39, 0xe0, 0x5c, 0x42, 0x96, 0x35, 0x1a, 0x3f, 0x1d, 0xb4, 0x19, 0x9e, 0xa2, 0x99,
+  0x34, 0x2d, 0x07, 0x63, 0x36, 0xbd, 0x84, 0x2f, 0x7e, 0x3f, 0xe4, 0xee, 0x88, 0x4f, 0x74, 0xac,
+  0xf5, 0xe3, 0x04, 0x34, 0x88, 0x3c, 0x88, 0x01, 0x1e, 0xa4, 0xdf, 0x3d, 0x88, 0xc0, 0x00, 0x4c,
+  0x4c, 0xfb, 0x84, 0x1a, 0xd4, 0xa7, 0x53, 0x4e, 0x45, 0x43, 0x75, 0xea, 0x93, 0x65, 0xb4, 0x6f,
+  0xb2, 0x28, 0xfc, 0x68, 0x00, 0x1e, 0x30, 0x5f, 0xda, 0xa7, 0xc3, 0x47, 0x11, 0xe1, 0x07, 0xa1,
+  0x38, 0x0e, 0xa2, 0xf5, 0xa6, 0x4e, 0x43, 0xe1, 0x04, 0xa2, 0x38, 0xda, 0x23, 0x69, 0x27, 0x8b,
+  0x76, 0x59, 0x67, 0x9d, 0x58, 0x8b, 0x11, 0xd2, 0xcf, 0x5c, 0x3b, 0x51, 0xab, 0x88, 0x2b, 0x93,
+  0x0f, 0xc7, 0xa5, 0x31, 0x15, 0x75, 0x9b, 0x3f, 0x3a, 0xdc, 0x96, 0xec, 0x9d, 0x78, 0x07, 0x4e,
+  0xde, 0x7c, 0xfe, 0xdb, 0x4d, 0xcb, 0x00, 0x72, 0xc9, 0xbd, 0xc0, 0x7e, 0xbf, 0x07, 0x3c, 0xd5,
+  0xce, 0xd7, 0x92, 0xa2, 0xd3, 0x25, 0xd8, 0x00, 0xf1, 0x17, 0xe3, 0xb8, 0xbf, 0xfe, 0xd0, 0xdd,
+  0xe5, 0xde, 0xec, 0xdc, 0x5a, 0x49, 0xf7, 0x66, 0x5b, 0xfd, 0x1e, 0x50, 0x31, 0xee, 0xb1, 0xfe,
+  0x60, 0xd8, 0xc3, 0xb1, 0x74, 0xf7, 0x93, 0x03, 0x1a, 0xc1, 0x9d, 0x10, 0xcc, 0x66, 0x95, 0xa2,
+  0x78, 0xcd, 0xdd, 0x20, 0x03, 0x45, 0xb1, 0xcc, 0xb1, 0x9e, 0x9f, 0x51, 0x8c, 0x1e, 0x2e, 0x8c,
+  0x6f, 0x85, 0xd7, 0x3a, 0x6b, 0xf7, 0x6b, 0xd9, 0x3a, 0x89, 0x17, 0x89, 0x48, 0xd3, 0xe3, 0xb6,
+  0x90, 0x20, 0x67, 0x7d, 0x5f, 0x63, 0x7a, 0x1f, 0xa0, 0xcd, 0x05, 0x1e, 0x87, 0xd7, 0x31, 0xb4,
+  0x3a, 0xf1, 0x3c, 0x98, 0xd2, 0x44, 0x19, 0x4d, 0xfb, 0xe5, 0x5b, 0xf8, 0x6f, 0xb7, 0xdf, 0x69,
+  0xc0, 0x41, 0x55, 0xf0, 0x43, 0x14, 0xe6, 0x32, 0xf0, 0x3c, 0x11, 0x7d, 0xa2, 0xa3, 0x2e, 0x06,
+  0x09, 0xf3, 0x3f, 0xac, 0x8d, 0xb2, 0x14, 0x19, 0x7e, 0x31, 0x7f, 0xd8, 0xb4, 0x56, 0x0c, 0x6a,
+  0xc4, 0x38, 0xa5, 0xb9, 0x43, 0x4d, 0x74, 0xb3, 0x67, 0x27, 0x99, 0x1f, 0x6f, 0x24, 0x2d, 0x73,
+  0xb6, 0x2f, 0x66, 0x48, 0x33, 0x9e, 0x6d, 0xd2, 0x07, 0x68, 0x53, 0xc5, 0x0e, 0x3d, 0x50, 0x90,
+  0x0f, 0xd0, 0x44, 0x49, 0x17, 0x04, 0x55, 0xae, 0x0b, 0x3c, 0x68, 0x35, 0xb1, 0x85, 0x62, 0x79,
+  0x43, 0xe1, 0x79, 0x5c, 0x6f, 0x68, 0xed, 0xd1, 0x68, 0xd2, 0x1f, 0xea, 0x0d, 0xad, 0x0d, 0x23,
+  0x4c, 0xe3, 0x30, 0x80, 0x80, 0x08, 0xd2, 0x87, 0xb1, 0xeb, 0x1c, 0x44, 0x96, 0x48, 0x92, 0x38,
+  0xd9, 0x4f, 0x94, 0x3f, 0xf5, 0x26, 0x6d, 0x44, 0x4d, 0xfa, 0xb6, 0x7b, 0x00, 0x51, 0xfe, 0xc8,
+  0xdd, 0x4b, 0xd4, 0x2a, 0xf6, 0x04, 0x64, 0x4d, 0xa1, 0x70, 0xb3, 0xf8, 0x50, 0xc3, 0xb0, 0x1f,
+  0x4e, 0xc8, 0x1d, 0x11, 0xb6, 0x39, 0xc6, 0x20, 0xc2, 0x34, 0xec, 0xd8, 0x09, 0x63, 0xf7, 0xbd,
+  0xde, 0x09, 0x58, 0x1a, 0x05, 0xd9, 0xe9, 0x64, 0xda, 0x74, 0x7a, 0x3f, 0xa5, 0xe4, 0xc2, 0xdf,
+  0x65, 0x77, 0x6b, 0x48, 0xb9, 0x51, 0xf9, 0xe2, 0xa3, 0xeb, 0xde, 0x21, 0x6d, 0xdd, 0xa5, 0x70,
+  0xdf, 0x83, 0xaf, 0x38, 0xba, 0xd6, 0x32, 0xed, 0x38, 0x91, 0xb6, 0xe0, 0xd0, 0x38, 0xc2, 0x8f,
+  0xf7, 0x6b, 0xc4, 0xc0, 0x1d, 0xf2, 0x91, 0xfb, 0xc0, 0x69, 0xb3, 0x63, 0xca, 0x15, 0x2e, 0x77,
+  0xf4, 0x49, 0x76, 0x9f, 0x46, 0x80, 0x35, 0x0b, 0x5d, 0x30, 0xb8, 0x3f, 0x7f, 0x3a, 0x20, 0xb7,
+  0x39, 0x8c, 0x89, 0x68, 0xb6, 0xfe, 0x28, 0x53, 0xf7, 0x2f, 0x2b, 0xe1, 0x05, 0x9c, 0x19, 0xa5,
+  0x5c, 0x75, 0x8c, 0xb9, 0x6a, 0xb7, 0x86, 0xb0, 0x35, 0xed, 0xde, 0x91, 0xbd, 0xef, 0x8f, 0x80,
+  0xee, 0x2b, 0x77, 0x55, 0x84, 0x9a, 0xb4, 0xb6, 0x9e, 0xda, 0xd6, 0xc3, 0xb5, 0x5d, 0xe0, 0xda,
+  0xd3, 0xc0, 0xca, 0x08, 0x28, 0x4b, 0x6b, 0x6a, 0xd4, 0x7d, 0x8d, 0x87, 0x67, 0x27, 0xaa, 0xb4,
+  0x74, 0x76, 0x22, 0xeb, 0x5f, 0x67, 0x58, 0xe9, 0x51, 0x55, 0x27, 0x2f, 0xb8, 0x61, 0x6e, 0xc8,
+  0xd3, 0x14, 0x26, 0x53, 0xce, 0xb5, 0xa3, 0x6d, 0x15, 0xaa, 0xfc, 0x1e, 0x07, 0x79, 0x24, 0x6b,
+  0x59, 0xcf, 0x6f, 0xb7, 0x35, 0x2c, 0x68, 0xa1, 0x6f, 0x9f, 0xa7, 0xd3, 0x47, 0x17, 0x2f, 0xc1,
+  0xfd, 0x1f, 0xbf, 0x59, 0x8a, 0xe3, 0x27, 0x41, 0xc2, 0xde, 0xae, 0x3d, 0x88, 0xfa, 0xd8, 0xd5,
+  0x5d, 0x9a, 0x89, 0x55, 0xad, 0xbb, 0x16, 0x4e, 0x65, 0xfa, 0x97, 0x68, 0xa3, 0x76, 0x64, 0xe3,
+  0x2e, 0x1a, 0x3c, 0x3a, 0x93, 0x49, 0x41, 0xd9, 0xa2, 0xa8, 0x8a, 0x1e, 0x42, 0x3b, 0x62, 0x37,
+  0x3c, 0xdc, 0xc0, 0x0d, 0xdf, 0x64, 0xf0, 0x82, 0xac, 0x88, 0xf0, 0x9a, 0x50, 0x9e, 0xc0, 0xeb,
+  0x2a, 0xba, 0x13, 0x0d, 0xbe, 0x4f, 0xa4, 0xc1, 0x57, 0x65, 0xc1, 0xa3, 0x26, 0x84, 0xbc, 0x62,
+  0xf8, 0x4f, 0xa0, 0x21, 0x14, 0x29, 0x09, 0x44, 0x4b, 0x45, 0xfe, 0xf2, 0x9f, 0x43, 0x47, 0x1b,
+  0x09, 0xbb, 0xb1, 0x3f, 0x5c, 0x93, 0x58, 0xe0, 0x81, 0x92, 0xde, 0x45, 0xee, 0xcb, 0x35, 0x06,
+  0x77, 0xe9, 0x11, 0xa3, 0x79, 0x72, 0x7e, 0x54, 0x35, 0xbb, 0x1f, 0xa3, 0x71, 0x85, 0x5f, 0x22,
+  0x1c, 0x1e, 0x60, 0xcc, 0xc4, 0x5b, 0x70, 0xb8, 0xc0, 0x44, 0x4f, 0x33, 0xbc, 0xaf, 0xa9, 0x01,
+  0xa3, 0xd1, 0x63, 0xbe, 0x01, 0x3e, 0x8e, 0x65, 0x4b, 0x78, 0x00, 0xf6, 0x5a, 0x24, 0x9f, 0x3e,
+  0xee, 0x92, 0x3d, 0x91, 0x14, 0xc9, 0x07, 0x4f, 0xf0, 0xbe, 0x36, 0xba, 0x66, 0x2f, 0xac, 0x30,
+  0x1c, 0x5d, 0xfc, 0xcf, 0x7f, 0xff, 0xd7, 0x7f, 0xd6, 0x50, 0xb5, 0xb4, 0xc7, 0x60, 0xb7, 0x8c,
+  0xe5, 0x0d, 0xde, 0x5f, 0x7c, 0x9d, 0xf0, 0x05, 0x7b, 0xc4, 0xbe, 0x4e, 0xe2, 0x35, 0x49, 0xf3,
+  0xcc, 0x49, 0x2e, 0xe2, 0x04, 0x7f, 0x3f, 0x0b, 0x03, 0xf7, 0x3d, 0xcb, 0x62, 0x76, 0x45, 0x82,
+  0x91, 0x6f, 0x35, 0x98, 0xca, 0xfc, 0x45, 0x4e, 0x1d, 0xe5, 0x78, 0xb7, 0x45, 0x00, 0x89, 0x16,
+  0xef, 0xbf, 0x95, 0xb7, 0x1c, 0x62, 0xcf, 0x75, 0x76, 0x7e, 0x64, 0x3a, 0x41, 0xd4, 0x33, 0x17,
+  0xbf, 0xf6, 0x4c, 0xe1, 0xdf, 0x3a, 0x47, 0x0f, 0xe3, 0x5e, 0x11, 0x1c, 0x94, 0xc1, 0xc3, 0x5d,
+  0x3b, 0x27, 0x0a, 0x67, 0xbc, 0xed, 0xf1, 0x23, 0xde, 0x5d, 0xec, 0xe1, 0x60, 0xe1, 0x41, 0xb7,
+  0xfd, 0xae, 0xf0, 0xae, 0xde, 0xaf, 0x95, 0x6a, 0x67, 0x03, 0xbe, 0x3a, 0xca, 0xc1, 0x41, 0xda,
+  0x5b, 0x16, 0xc4, 0x53, 0xbc, 0xcd, 0xd3, 0xe0, 0x8b, 0xab, 0x8c, 0x27, 0x99, 0x5a, 0x8a, 0x38,
+  0x3b, 0x91, 0x1d, 0xf7, 0x30, 0xa2, 0x99, 0xc3, 0x4a, 0xf0, 0xf9, 0xf3, 0x67, 0x1a, 0x07, 0xd2,
+  0x0a, 0x03, 0xf2, 0x53, 0xcd, 0x4c, 0xd0, 0x36, 0xc5, 0x2c, 0xaf, 0x8a, 0xe9, 0x39, 0x3e, 0xd1,
+  0x72, 0x73, 0x37, 0x83, 0x2b, 0x19, 0x59, 0x15, 0xa4, 0x54, 0x53, 0xeb, 0x8b, 0x43, 0x59, 0x5d,
+  0x76, 0x74, 0x94, 0x52, 0x28, 0x7b, 0x22, 0xaf, 0xcb, 0xb4, 0xa9, 0x4b, 0xb5, 0xca, 0xe3, 0x26,
+  0xc1, 0x3a, 0xdb, 0x02, 0x04, 0x56, 0xa6, 0x19, 0xdb, 0xce, 0x47, 0x76, 0xce, 0xbc, 0xd8, 0xdd,
+  0xac, 0x44, 0x94, 0x99, 0x0b, 0x91, 0x5d, 0x86, 0x02, 0x2f, 0x9f, 0xde, 0x7d, 0xeb, 0x19, 0x9d,
+  0x6d, 0xab, 0x4e, 0xa9, 0xe0, 0x21, 0x21, 0x14, 0x4a, 0xbf, 0x0b, 0x40, 0xd1, 0xa8, 0xd9, 0xbf,
+  0x50, 0x91, 0xfd, 0x04, 0x40, 0xa3, 0x66, 0xff, 0x86, 0x0e, 0xec, 0x82, 0xd3, 0x68, 0xdc, 0x0e,
+  0x0f, 0x25, 0x7d, 0x08, 0x28, 0x6c, 0xd7, 0x0e, 0x05, 0x85, 0x7b, 0x08, 0x14, 0x6c, 0xd7, 0x84,
+  0xa2, 0x32, 0xec, 0x1d, 0xfd, 0x65, 0x8b, 0x36, 0xa9, 0x40, 0x5a, 0xb1, 0x57, 0x28, 0x7e, 0xac,
+  0xef, 0x8d, 0x76, 0x63, 0x5f, 0x6f, 0x6c, 0xa3, 0xef, 0x8d, 0xd6, 0x63, 0x5f, 0x6f, 0x6c, 0xd3,
+  0xa6, 0x0f, 0xfb, 0xf8, 0xb6, 0x6d, 0x55, 0x86, 0x50, 0x5c, 0x80, 0x57, 0x63, 0xd2, 0xdd, 0x0a,
+  0x0f, 0xcd, 0x3a, 0x80, 0x8a, 0x36, 0x61, 0xb8, 0x6d, 0x79, 0x72, 0x22, 0x5d, 0x3b, 0x43, 0xcf,
+  0x7c, 0xca, 0xde, 0xfd, 0x06, 0xc1, 0x2d, 0xae, 0xa7, 0x22, 0x5d, 0xec, 0xfe, 0x9a, 0xdd, 0x06,
+  0xd9, 0x92, 0xc9, 0xa5, 0x56, 0x7a, 0x93, 0x16, 0xeb, 0x06, 0xe8, 0x30, 0x34, 0x2e, 0xb2, 0x8e,
+  0x31, 0x6d, 0xa0, 0xa4, 0x16, 0xe0, 0xf4, 0x21, 0x82, 0x86, 0x77, 0x3e, 0x0f, 0xcb, 0x55, 0x9c,
+  0xe2, 0xc2, 0xdf, 0x44, 0x2e, 0x06, 0x05, 0x98, 0xf0, 0x26, 0x30, 0xdc, 0x1f, 0x80, 0x3e, 0xa3,
+  0x9e, 0x67, 0x24, 0x22, 0xdb, 0x24, 0xd1, 0x96, 0x3b, 0x7f, 0xdf, 0x88, 0xe4, 0xee, 0x4a, 0x85,
+  0x17, 0x46, 0x47, 0x26, 0xaa, 0xa5, 0x28, 0xe7, 0xfa, 0x54, 0x45, 0x9a, 0x9d, 0xae, 0x49, 0x01,
+  0xcf, 0xce, 0x6c, 0x47, 0xf1, 0x46, 0x0d, 0x07, 0x69, 0xa1, 0x7c, 0xc0, 0x25, 0x77, 0x29, 0x6e,
+  0x00, 0x61, 0xd1, 0x74, 0x6b, 0x18, 0x4c, 0xc8, 0x0d, 0x2e, 0xf1, 0xdd, 0xf7, 0x18, 0x6b, 0xc0,
+  0xcc, 0x32, 0x3a, 0xd4, 0xa1, 0xd3, 0x63, 0x40, 0xfe, 0xf9, 0x45, 0x3d, 0x3b, 0xcc, 0x0d, 0x82,
+  0x49, 0xad, 0x8c, 0x72, 0x1d, 0x55, 0x27, 0x50, 0xa0, 0x49, 0x39, 0x72, 0x0f, 0x1d, 0x39, 0x51,
+  0x91, 0x1e, 0x46, 0x46, 0xbe, 0x88, 0x82, 0x94, 0x08, 0x0d, 0x29, 0xc2, 0x5c, 0x27, 0x04, 0xef,
+  0x6b, 0xe1, 0xf3, 0x4d, 0x98, 0x19, 0xb5, 0x8a, 0x70, 0x09, 0x38, 0x99, 0x5d, 0x84, 0x8c, 0x68,
+  0x4a, 0x90, 0xf7, 0x51, 0xbf, 0x97, 0xbe, 0x50, 0xf0, 0x1b, 0xd1, 0xc2, 0x2a, 0x2d, 0xfe, 0x44,
+  0xac, 0x00, 0xf3, 0xef, 0x47, 0x42, 0xbc, 0x06, 0xec, 0x1c, 0xd5, 0xf3, 0x77, 0x64, 0xd2, 0x2e,
+  0x22, 0xf1, 0x27, 0xf0, 0x99, 0x51, 0x55, 0xf3, 0xf3, 0xf3, 0x73, 0x46, 0xb6, 0x01, 0x4c, 0x9a,
+  0x26, 0x01, 0x95, 0x16, 0x02, 0x9a, 0x27, 0x01, 0x4d, 0xb0, 0x27, 0x49, 0xc2, 0xef, 0x4c, 0x3f,
+  0x89, 0x57, 0x86, 0x30, 0x21, 0xb9, 0xe3, 0x6f, 0xa8, 0x32, 0x2e, 0x12, 0x93, 0x96, 0xda, 0x81,
+  0x9f, 0xf8, 0x97, 0x86, 0x83, 0x17, 0xe6, 0xad, 0x70, 0xde, 0x07, 0xd9, 0x37, 0x22, 0x7b, 0x92,
+  0x5e, 0x02, 0x90, 0x3b, 0xa3, 0xdb, 0xc5, 0xe2, 0x41, 0x06, 0x3c, 0x30, 0x10, 0xea, 0x1d, 0x35,
+  0x95, 0x57, 0xf3, 0x16, 0xec, 0xbe, 0x9a, 0xdc, 0xef, 0xae, 0xe7, 0x9a, 0xb4, 0x3b, 0x81, 0x11,
+  0x15, 0x44, 0xde, 0xb1, 0xd8, 0xcf, 0xa9, 0xd5, 0x0d, 0x87, 0x76, 0x06, 0xdc, 0xf2, 0x20, 0x83,
+  0x09, 0xcd, 0x3d, 0x49, 0x11, 0xf5, 0x93, 0x76, 0x28, 0xd5, 0xd0, 0x70, 0xdf, 0x78, 0xb2, 0xe4,
+  0x91, 0x17, 0x8a, 0xe7, 0x64, 0x8d, 0xa4, 0x09, 0x30, 0xda, 0x3a, 0x4b, 0xb3, 0xb1, 0xab, 0x1a,
+  0x50, 0x1d, 0x62, 0x8d, 0xa7, 0xf4, 0xb8, 0x29, 0x41, 0x7a, 0x6c, 0x86, 0x22, 0x5a, 0x80, 0xc9,
+  0xbc, 0x60, 0x96, 0x6e, 0xa4, 0x8a, 0x48, 0x34, 0xfa, 0x25, 0x12, 0xdf, 0x59, 0xd7, 0xdd, 0xd6,
+  0x0a, 0x42, 0x8b, 0x15, 0xa8, 0x59, 0xa6, 0xaa, 0x39, 0xda, 0x5a, 0x15, 0x8d, 0x35, 0x02, 0x1a,
+  0x16, 0xa2, 0xcd, 0x08, 0x3c, 0x58, 0x15, 0x35, 0x6c, 0xaf, 0x68, 0x23, 0x04, 0xb9, 0xe0, 0xb3,
+  0x24, 0xcf, 0x7a, 0x92, 0x49, 0x84, 0xd6, 0x90, 0x9e, 0xe6, 0x54, 0x39, 0x97, 0x57, 0x70, 0x4d,
+  0x2f, 0x95, 0x6e, 0xbe, 0x56, 0x5e, 0x06, 0x9f, 0xb3, 0x7f, 0xfc, 0x83, 0x46, 0x64, 0xa2, 0x25,
+  0xef, 0x4a, 0x9d, 0x38, 0x55, 0x1e, 0xaa, 0xdb, 0xad, 0x73, 0x8e, 0x09, 0x70, 0x28, 0x34, 0x8e,
+  0x2a, 0xf2, 0x87, 0x4a, 0xa6, 0xda, 0xfb, 0x63, 0x44, 0xf4, 0x66, 0x29, 0x0a, 0x57, 0xa8, 0xdc,
+  0x24, 0x0b, 0x52, 0x72, 0x9a, 0x49, 0x0c, 0x39, 0x26, 0x4c, 0x0a, 0xbc, 0x56, 0xde, 0x95, 0xc6,
+  0x53, 0xcb, 0xf2, 0x0b, 0x27, 0x58, 0x62, 0x52, 0x52, 0xe2, 0x4c, 0xb7, 0x51, 0xe8, 0xa3, 0x98,
+  0x0b, 0xf2, 0x0a, 0x54, 0xdb, 0x72, 0x4b, 0x13, 0x12, 0xea, 0x20, 0x33, 0x3a, 0x27, 0x9d, 0xed,
+  0x4c, 0xc7, 0x76, 0x24, 0x0b, 0xba, 0x98, 0xeb, 0x3c, 0x2b, 0xb4, 0x67, 0x8f, 0x19, 0xb5, 0x2c,
+  0x31, 0xd0, 0x66, 0x5f, 0x49, 0x24, 0x66, 0x0a, 0x4e, 0x4b, 0x18, 0x76, 0x97, 0x9d, 0xca, 0x07,
+  0x5d, 0xf3, 0x6f, 0x71, 0x10, 0x11, 0x9a, 0x7d, 0xae, 0xf5, 0x59, 0x1c, 0x52, 0xb6, 0x49, 0x31,
+  0x04, 0x4d, 0x34, 0xc8, 0xaa, 0xe3, 0x5b, 0xc6, 0xc9, 0xb3, 0xad, 0x0b, 0x96, 0x15, 0x7d, 0xa4,
+  0x55, 0x2e, 0x58, 0xd2, 0x62, 0x2a, 0x34, 0xfa, 0x4c, 0xef, 0xcd, 0x00, 0x23, 0x54, 0xd1, 0x6e,
+  0x4d, 0x7d, 0x19, 0x1e, 0x49, 0x3b, 0x14, 0x89, 0x5b, 0xf6, 0x0a, 0x14, 0x38, 0x48, 0x85, 0x01,
+  0x1c, 0x4f, 0xe3, 0xf0, 0x46, 0xf4, 0x00, 0xe5, 0xdf, 0x80, 0xe2, 0xad, 0x6d, 0x24, 0xd5, 0x68,
+  0xbc, 0xd6, 0x18, 0x1c, 0xa9, 0x80, 0xeb, 0x4d, 0xba, 0xd4, 0xa9, 0xbd, 0x82, 0x05, 0x41, 0x12,
+  0xc9, 0xb4, 0xa6, 0xe0, 0x1f, 0x6f, 0xbe, 0x90, 0x43, 0x94, 0x06, 0x48, 0x04, 0x2e, 0xdc, 0x67,
+  0xe2, 0x35, 0x3d, 0xac, 0xbb, 0x2d, 0x32, 0xd8, 0xf3, 0x79, 0x3b, 0x77, 0x1c, 0x9e, 0xb9, 0xcb,
+  0xc3, 0xd9, 0x23, 0x51, 0x9b, 0xb9, 0x8c, 0xc0, 0xee, 0x1f, 0xc2, 0x26, 0x14, 0x16, 0x21, 0xca,
+  0x55, 0x0d, 0x6d, 0x8f, 0xd5, 0xe6, 0x31, 0x1c, 0x80, 0xfe, 0xfe, 0x10, 0xcf, 0x50, 0xf2, 0x46,
+  0xee, 0x32, 0x08, 0x3d, 0x9c, 0x78, 0x84, 0xe6, 0x50, 0x5f, 0x44, 0xbd, 0x0e, 0xf5, 0x45, 0xf7,
+  0xbb, 0xf4, 0xbe, 0xd0, 0xde, 0x56, 0x6f, 0xa5, 0xd1, 0xdf, 0x8a, 0xf9, 0x6a, 0x65, 0xc9, 0x7e,
+  0xad, 0xa8, 0x87, 0xe5, 0x1a, 0x3f, 0x96, 0x27, 0x33, 0x26, 0xa6, 0xe7, 0xcf, 0xe4, 0x1e, 0xbc,
+  0xbc, 0x65, 0x4e, 0xc1, 0x63, 0xd6, 0x91, 0x0f, 0x3a, 0xcd, 0xbe, 0x98, 0xca, 0xd4, 0xfb, 0xc6,
+  0xc9, 0x8a, 0x67, 0xcf, 0xd5, 0x4b, 0x35, 0x98, 0x44, 0x78, 0x1b, 0x30, 0x1c, 0x46, 0x04, 0x5c,
+  0x25, 0x85, 0x89, 0x00, 0xac, 0x4f, 0xf3, 0xc9, 0xc4, 0xf2, 0x4b, 0x0f, 0xc6, 0xd8, 0x9d, 0x6b,
+  0x22, 0x65, 0x3f, 0x36, 0xa9, 0x46, 0x68, 0xaa, 0x12, 0x21, 0x20, 0xe8, 0xd0, 0x0a, 0x5a, 0x47,
+  0x17, 0x87, 0x41, 0xa2, 0x6c, 0x16, 0xdb, 0x0e, 0x1a, 0xb9, 0x06, 0x99, 0xfd, 0xc0, 0x13, 0x57,
+  0x94, 0x3b, 0x1a, 0xdd, 0x07, 0x26, 0x03, 0x52, 0x84, 0x49, 0xab, 0x6c, 0xab, 0x4e, 0xbe, 0x2e,
+  0xb2, 0x5a, 0x56, 0x86, 0x4d, 0x0e, 0x16, 0x05, 0x39, 0xc2, 0x8f, 0x65, 0x3e, 0xf1, 0xf7, 0xff,
+  0x28, 0x6f, 0x31, 0x59, 0x96, 0x24, 0x67, 0x90, 0x1d, 0x36, 0x39, 0x5b, 0x1b, 0x8e, 0x73, 0x97,
+  0xe9, 0x67, 0x0c, 0xbd, 0xc8, 0xa7, 0x4a, 0xee, 0xca, 0x2c, 0xf6, 0x14, 0x1f, 0x77, 0xe6, 0x1a,
+  0x53, 0xf9, 0x1e, 0x46, 0x60, 0x5b, 0xf5, 0xb5, 0x64, 0x55, 0x7c, 0x00, 0x54, 0x14, 0xe8, 0x76,
+  0x64, 0xff, 0x1e, 0xeb, 0x7c, 0xf7, 0x14, 0x7f, 0xff, 0x40, 0xbf, 0xbf, 0x79, 0xda, 0xb9, 0xd6,
+  0x75, 0x0b, 0xa0, 0xcb, 0x0f, 0xe8, 0x79, 0xfd, 0x30, 0x86, 0x64, 0x94, 0x2e, 0xc3, 0x78, 0x91,
+  0x13, 0x7d, 0xc2, 0x8a, 0x27, 0xef, 0xbb, 0x7a, 0xe7, 0xbb, 0xc6, 0xad, 0xd1, 0xcf, 0x81, 0xd7,
+  0x99, 0xa1, 0x46, 0xa4, 0x3a, 0xad, 0xe3, 0x5b, 0xe3, 0x7d, 0x8f, 0x05, 0x10, 0xb5, 0x67, 0xf1,
+  0xf3, 0xe0, 0x83, 0xf0, 0x8c, 0x7e, 0xb7, 0x4b, 0x13, 0x13, 0xdd, 0x35, 0x11, 0xfc, 0x2e, 0xb8,
+  0xde, 0xc7, 0x73, 0x59, 0x7a, 0x64, 0x45, 0xc9, 0xb2, 0x2d, 0xad, 0x45, 0x49, 0x3f, 0x2c, 0xab,
+  0x7d, 0x70, 0x14, 0x89, 0x1d, 0x2a, 0xe6, 0xa9, 0xcd, 0x34, 0x63, 0x0c, 0x40, 0x0d, 0x6a, 0xcd,
+  0xf7, 0x5a, 0xe5, 0x6d, 0x58, 0x58, 0xee, 0xa8, 0x43, 0x23, 0x07, 0x8d, 0x6f, 0xab, 0x4d, 0x1f,
+  0x1a, 0xfe, 0x3d, 0x5b, 0x6e, 0xa2, 0xf7, 0xc2, 0x43, 0x87, 0x97, 0x6e, 0x56, 0x38, 0x4f, 0x14,
+  0x68, 0x98, 0xfb, 0xa4, 0xdf, 0x69, 0xad, 0xe2, 0xf3, 0xec, 0xc5, 0xdb, 0x1f, 0xbf, 0xfb, 0xe5,
+  0xea, 0xdb, 0x7f, 0xbb, 0x04, 0xd5, 0x19, 0x0f, 0xd9, 0x97, 0x35, 0x95, 0x94, 0xad, 0x7e, 0x78,
+  0xf2, 0xe7, 0x5f, 0x5e, 0x5f, 0xbe, 0x79, 0xfd, 0xed, 0xe5, 0x15, 0x29, 0xad, 0x1e, 0xf9, 0x2b,
+  0x55, 0x4f, 0xcb, 0x57, 0xb0, 0x9b, 0x73, 0x29, 0x5d, 0xc6, 0xb7, 0x79, 0x2b, 0x83, 0x96, 0x12,
+  0x81, 0xd4, 0x2c, 0xce, 0x78, 0xd8, 0x83, 0xe0, 0x24, 0xe3, 0x41, 0xd8, 0x12, 0x5d, 0x8a, 0x04,
+  0xf7, 0x19, 0x3f, 0x8b, 0x57, 0x6b, 0x5a, 0x33, 0x39, 0x97, 0x9d, 0x30, 0xae, 0x86, 0xb0, 0x90,
+  0xf4, 0x73, 0x05, 0x21, 0xa0, 0x84, 0x08, 0x1a, 0xab, 0x40, 0x42, 0x8c, 0x88, 0xe3, 0xb1, 0x58,
+  0x73, 0x03, 0x7d, 0xa9, 0x80, 0xa8, 0x0c, 0x90, 0xdc, 0xe4, 0x73, 0xde, 0xc0, 0x05, 0x1a, 0xfe,
+  0x45, 0x47, 0xdf, 0x1b, 0x4b, 0x60, 0x35, 0xe3, 0x47, 0xb4, 0xd0, 0xde, 0x01, 0xa3, 0x06, 0xa8,
+  0x2b, 0x21, 0x61, 0x68, 0x2b, 0x87, 0x0a, 0x94, 0x77, 0xd8, 0x5f, 0x37, 0x96, 0xe5, 0x4c, 0x68,
+  0x0a, 0xa9, 0xa7, 0xa7, 0xac, 0xb3, 0x3f, 0x90, 0x7d, 0x9a, 0xc4, 0xb7, 0xa9, 0x48, 0x8e, 0x53,
+  0x30, 0x77, 0x05, 0x39, 0x3d, 0xb6, 0x49, 0x61, 0xf8, 0x71, 0x14, 0xde, 0xb1, 0xdb, 0x25, 0x1a,
+  0xb7, 0x52, 0xa8, 0x9f, 0x66, 0x10, 0x5b, 0xac, 0x30, 0x17, 0xd8, 0x44, 0xfc, 0x06, 0x10, 0xa1,
+  0x72, 0x68, 0x24, 0x24, 0x32, 0xbd, 0x80, 0x74, 0x26, 0xef, 0xf3, 0x1c, 0xf3, 0x95, 0x04, 0x0e,
+  0x39, 0x53, 0xf5, 0x09, 0x05, 0x63, 0x77, 0x68, 0x8f, 0x05, 0xfb, 0x1c, 0x66, 0x23, 0x4d, 0xe7,
+  0xab, 0x78, 0x03, 0x8c, 0x31, 0x5f, 0xbe, 0xba, 0xfc, 0x51, 0x37, 0x15, 0xda, 0x75, 0xa4, 0x3b,
+  0x3f, 0x3c, 0xe8, 0xc1, 0x9a, 0x95, 0x3c, 0xac, 0x51, 0x61, 0x11, 0xc3, 0x0c, 0x91, 0x9d, 0x00,
+  0xb4, 0x93, 0xfc, 0xd1, 0x29, 0x93, 0x76, 0x0e, 0x3d, 0x28, 0x70, 0x2f, 0x8b, 0x99, 0x1f, 0xf2,
+  0x74, 0xc9, 0xe0, 0xb6, 0x0c, 0x0d, 0x59, 0xb9, 0x91, 0x8b, 0xd8, 0xeb, 0x25, 0x4f, 0x21, 0x5a,
+  0x48, 0x65, 0x2d, 0x12, 0xb7, 0xdc, 0x79, 0xb1, 0x5a, 0xc2, 0x4b, 0xb3, 0x78, 0xcd, 0x78, 0x46,
+  0xfb, 0xd0, 0x1a, 0x32, 0x28, 0x83, 0x03, 0x39, 0xa4, 0x19, 0x56, 0xb9, 0x6f, 0x93, 0x00, 0xe7,
+  0x25, 0x83, 0x78, 0xf1, 0x06, 0x0f, 0x50, 0xdc, 0x95, 0x9d, 0x90, 0xd4, 0xfe, 0x57, 0x2f, 0x9e,
+  0x5c, 0xd1, 0xc4, 0xfb, 0x0d, 0xd2, 0x15, 0xda, 0xa7, 0xd0, 0x79, 0x95, 0x08, 0xb0, 0xd4, 0xd0,
+  0x14, 0x8c, 0x21, 0x42, 0x80, 0xd0, 0xbd, 0xf3, 0xb3, 0x84, 0x04, 0x4f, 0x24, 0x20, 0x78, 0xf4,
+  0x53, 0x0e, 0x11, 0x1e, 0x0a, 0xdc, 0x01, 0xd7, 0x79, 0x1e, 0x44, 0x3c, 0xa4, 0x13, 0x22, 0x9d,
+  0x9e, 0xd6, 0xd8, 0xc9, 0x2d, 0x28, 0x71, 0x84, 0x10, 0xbf, 0x86, 0x3f, 0xd8, 0x13, 0x77, 0x4d,
+  0x61, 0x5f, 0xd0, 0x1a, 0xe1, 0x75, 0xd0, 0xb8, 0x38, 0x90, 0x4b, 0xc2, 0x93, 0xd7, 0x74, 0x81,
+  0xc0, 0xd8, 0x7d, 0xb5, 0xd8, 0x5a, 0xd3, 0x8c, 0x7a, 0x3d, 0xb6, 0xa9, 0x78, 0xf1, 0x5a, 0x44,
+  0xaf, 0x2a, 0x9d, 0x0c, 0xad, 0xca, 0xdd, 0x06, 0x91, 0x17, 0xdf, 0x9a, 0x25, 0x4d, 0xfa, 0xb8,
+  0xc0, 0xb4, 0x49, 0x20, 0xe4, 0x17, 0x25, 0xa8, 0x90, 0x4f, 0x96, 0xb5, 0xa4, 0x5e, 0x3e, 0xab,
+  0xe9, 0x79, 0xd3, 0x55, 0x15, 0x1d, 0x5b, 0x8a, 0x1e, 0x25, 0xe3, 0x06, 0xc8, 0xff, 0xf5, 0xea,
+  0xe5, 0x8f, 0x26, 0xf9, 0x5e, 0x55, 0x4c, 0xd3, 0x38, 0x17, 0xd0, 0x9a, 0x27, 0x79, 0xc6, 0x0e,
+  0x49, 0x29, 0x68, 0x40, 0x8c, 0x39, 0x77, 0xa1, 0xda, 0x60, 0x6f, 0xe4, 0xeb, 0x20, 0x03, 0x1f,
+  0xe2, 0x6b, 0xfd, 0xdd, 0xe7, 0x52, 0x97, 0xde, 0xad, 0x4d, 0x52, 0xe2, 0x6b, 0x9c, 0xb2, 0x79,
+  0x5d, 0xbc, 0x34, 0x7b, 0x8b, 0x25, 0x9a, 0x5a, 0x70, 0x86, 0x73, 0x58, 0x85, 0x67, 0x6d, 0xce,
+  0x52, 0xc7, 0x79, 0x7d, 0x8a, 0x44, 0xf9, 0xf8, 0x6a, 0x8d, 0xf8, 0x60, 0xde, 0xc1, 0x74, 0x83,
+  0x69, 0x12, 0x66, 0x9c, 0x05, 0x2b, 0xbe, 0x80, 0xe9, 0x44, 0x6a, 0xcd, 0x56, 0x71, 0x82, 0x53,
+  0x88, 0xd3, 0xd2, 0xf8, 0x1d, 0x40, 0x77, 0x45, 0x70, 0x23, 0x5a, 0x38, 0x89, 0x6a, 0x8b, 0x16,
+  0x5c, 0x0e, 0x4e, 0xfa, 0x7f, 0x02, 0xd3, 0x29, 0x7b, 0x89, 0xb5, 0x89, 0xcf, 0x40, 0x4c, 0x3d,
+  0x68, 0xa9, 0x00, 0x7a, 0x54, 0x4d, 0x30, 0xc9, 0xcc, 0xb4, 0x15, 0x1f, 0x13, 0x9e, 0xb5, 0x41,
+  0x7f, 0xf4, 0x08, 0x41, 0xe1, 0x7b, 0xe9, 0x91, 0x2a, 0x76, 0xbd, 0x16, 0x40, 0xca, 0x86, 0xe4,
+  0x0d, 0x4e, 0xd2, 0x0e, 0x99, 0xfb, 0xf9, 0x6e, 0x23, 0x88, 0xc3, 0xea, 0xe5, 0xd4, 0xf5, 0x58,
+  0x5d, 0x84, 0x8f, 0x89, 0xb2, 0xba, 0x71, 0xdc, 0xed, 0x42, 0x74, 0xb3, 0xad, 0xa5, 0xa0, 0x14,
+  0xbf, 0x17, 0x91, 0x34, 0x9b, 0x19, 0xd5, 0x96, 0xd2, 0x94, 0xa6, 0x6b, 0x52, 0x52, 0xc5, 0x20,
+  0x2a, 0x34, 0x67, 0x0e, 0xda, 0x87, 0x4b, 0x67, 0x91, 0x97, 0xe2, 0x63, 0x18, 0x7b, 0xdd, 0x88,
+  0xba, 0x90, 0x87, 0xc1, 0x4c, 0x09, 0x20, 0x76, 0x07, 0x57, 0x25, 0x2b, 0x53, 0xe2, 0xef, 0x1b,
+  0x91, 0x66, 0x58, 0xa6, 0x02, 0xdb, 0xe9, 0xc7, 0xb8, 0xef, 0xba, 0x62, 0x4d, 0xd4, 0x8a, 0x13,
+  0x91, 0xd2, 0x6a, 0x4a, 0x00, 0xfe, 0x15, 0x18, 0x39, 0x86, 0x4a, 0xa0, 0x20, 0x92, 0x56, 0xa9,
+  0x22, 0x80, 0x5c, 0x56, 0xfa, 0x4d, 0x2e, 0xda, 0xf5, 0xe8, 0xdc, 0xdb, 0x7d, 0xd3, 0x0c, 0xa9,
+  0x8e, 0xc6, 0x4a, 0x64, 0xcb, 0x18, 0x1c, 0xcf, 0x26, 0x09, 0x65, 0xdb, 0x1e, 0xc0, 0xcd, 0x39,
+  0xd6, 0xb2, 0x24, 0xb4, 0xb7, 0x42, 0xd1, 0x66, 0x01, 0x3e, 0x2c, 0x13, 0x65, 0x80, 0xfe, 0xfc,
+  0xc3, 0xf7, 0x2f, 0xb2, 0x6c, 0xfd, 0x5a, 0x51, 0xd1, 0x52, 0xaf, 0x68, 0xa7, 0x24, 0xff, 0x01,
+  0x88, 0x6a, 0x3f, 0xd9, 0x41, 0xa6, 0x69, 0x0b, 0x10, 0xcc, 0x8f, 0xf4, 0xb9, 0xdd, 0x83, 0x0a,
+  0xe0, 0x88, 0xa7, 0x89, 0x00, 0x21, 0xb4, 0x44, 0xe9, 0xd5, 0x80, 0x37, 0x97, 0x28, 0x82, 0x59,
+  0x88, 0xec, 0xb5, 0x48, 0xd7, 0xc0, 0x10, 0xf1, 0x42, 0xd6, 0x8b, 0x3a, 0x7f, 0x3e, 0x96, 0xe9,
+  0xc2, 0x31, 0xb5, 0x03, 0x93, 0x03, 0x26, 0xaa, 0xd4, 0x71, 0xde, 0x62, 0x80, 0x88, 0xf1, 0xc6,
+  0x6f, 0x6a, 0x05, 0xf7, 0x94, 0xa0, 0x97, 0xc5, 0x2e, 0x9f, 0x24, 0x0a, 0x19, 0xad, 0x76, 0xea,
+  0x4a, 0x5e, 0xba, 0x67, 0xfa, 0xf1, 0x92, 0x83, 0x2c, 0x06, 0x2c, 0x05, 0x6e, 0x90, 0x3f, 0xc1,
+  0x17, 0x46, 0xe7, 0x47, 0x91, 0xdd, 0xc6, 0xc9, 0x7b, 0xe9, 0x48, 0x59, 0xec, 0x52, 0x9a, 0xe2,
+  0x99, 0x9d, 0x6e, 0xf7, 0x60, 0x14, 0x59, 0xb0, 0x12, 0xf1, 0x26, 0xdb, 0x81, 0x44, 0xe9, 0x0c,
+  0xc3, 0x96, 0x30, 0x09, 0x36, 0xd9, 0x0e, 0xf8, 0x38, 0xfd, 0xcb, 0x2a, 0xde, 0xa2, 0x67, 0x25,
+  0x5e, 0xef, 0x52, 0xb4, 0x14, 0x25, 0x47, 0xc8, 0x5b, 0x04, 0xd7, 0x2b, 0x4b, 0xed, 0x60, 0xbd,
+  0x4a, 0x61, 0x32, 0x1b, 0x28, 0xaf, 0x87, 0x99, 0x36, 0x30, 0x03, 0x2f, 0xf8, 0x4d, 0x25, 0xf6,
+  0x5d, 0x62, 0x3c, 0x77, 0x8b, 0xb6, 0x05, 0x4b, 0x6c, 0x9b, 0x28, 0x55, 0xa1, 0x19, 0x57, 0xfe,
+  0x12, 0xcb, 0xc0, 0xe8, 0x01, 0xd7, 0x81, 0x4b, 0xc9, 0x53, 0x1a, 0x97, 0xa1, 0x81, 0xef, 0x21,
+  0x97, 0x84, 0x9d, 0x79, 0x48, 0x11, 0xad, 0x04, 0xe2, 0xc2, 0x1b, 0x07, 0x6d, 0x8d, 0x1b, 0x2f,
+  0x22, 0x30, 0xed, 0x1e, 0x80, 0x15, 0x91, 0x8a, 0x14, 0x65, 0x9a, 0x8b, 0xe1, 0xda, 0x36, 0xe5,
+  0xca, 0x8d, 0x4b, 0xe7, 0x9b, 0xcb, 0x37, 0x98, 0xc6, 0x53, 0x84, 0x01, 0xa0, 0x22, 0x19, 0xa1,
+  0xa1, 0x5d, 0xeb, 0x9a, 0x2e, 0x56, 0x09, 0x0d, 0x35, 0x77, 0xb4, 0x79, 0xde, 0x36, 0x58, 0x0f,
+  0x85, 0x58, 0x1b, 0xab, 0x87, 0xd8, 0x23, 0x02, 0x0b, 0x02, 0x7b, 0x23, 0xf5, 0x69, 0x6b, 0xa6,
+  0x00, 0xca, 0x5e, 0xbe, 0x16, 0xe6, 0xd5, 0xc5, 0x34, 0x73, 0x9e, 0x4f, 0xb5, 0x54, 0x9a, 0x56,
+  0x1c, 0x77, 0xec, 0xfb, 0x00, 0xbc, 0xc6, 0x7b, 0xb0, 0x72, 0xab, 0x15, 0x7a, 0x5c, 0xaf, 0xad,
+  0xae, 0x8e, 0xa2, 0xa6, 0xd4, 0xd5, 0x50, 0xfe, 0xa5, 0xa7, 0x20, 0xc1, 0x84, 0x0d, 0x63, 0x47,
+  0x9f, 0x14, 0xa2, 0x5f, 0xfd, 0x1a, 0x42, 0x25, 0x65, 0x3a, 0x9f, 0xab, 0x5b, 0x4d, 0x99, 0x99,
+  0x9e, 0x9b, 0x7c, 0xbd, 0x46, 0x8d, 0xea, 0x10, 0xf1, 0x1d, 0x05, 0x59, 0x57, 0x45, 0x81, 0x09,
+  0x81, 0x65, 0x28, 0x92, 0x8e, 0xa2, 0xe7, 0x84, 0x3a, 0x7d, 0xa5, 0xee, 0xce, 0xa9, 0xe2, 0xa1,
+  0x3c, 0x21, 0xf8, 0xf1, 0x47, 0x92, 0x58, 0x7a, 0x2c, 0x2f, 0xe7, 0xda, 0xd2, 0x78, 0x5a, 0x14,
+  0xb3, 0x0b, 0x4d, 0x78, 0xf5, 0x16, 0x35, 0x81, 0xbc, 0x4c, 0x4e, 0x28, 0x4c, 0x71, 0x65, 0x82,
+  0x95, 0xac, 0x0a, 0xdb, 0xac, 0xb8, 0xfb, 0x98, 0xe5, 0x69, 0x51, 0xb9, 0x56, 0x20, 0x6b, 0x6c,
+  0x9a, 0x55, 0x5e, 0xe8, 0x9a, 0x1f, 0x17, 0xc1, 0x98, 0xa5, 0x0f, 0xf9, 0x30, 0xd8, 0xd1, 0xda,
+  0xd3, 0xa1, 0x35, 0x6b, 0x8f, 0xa3, 0xcb, 0xe1, 0x29, 0xf6, 0xa3, 0x49, 0x69, 0xea, 0x46, 0x5a,
+  0x9d, 0xc9, 0x6a, 0x3d, 0x4a, 0x69, 0x82, 0x34, 0x59, 0x98, 0x62, 0xe1, 0x33, 0x18, 0x28, 0x2a,
+  0x50, 0x96, 0x60, 0x7a, 0x02, 0x0a, 0x04, 0xa9, 0x10, 0x26, 0x50, 0x4b, 0x11, 0xae, 0x35, 0xbc,
+  0x03, 0xcb, 0x99, 0x87, 0xe8, 0x64, 0xed, 0x72, 0x2a, 0x70, 0x24, 0x46, 0xe7, 0xc5, 0x9b, 0x37,
+  0xaf, 0x28, 0xd4, 0xda, 0x0e, 0xaa, 0xce, 0x08, 0x00, 0x60, 0xfa, 0x1c, 0x6b, 0x06, 0xe7, 0x2c,
+  0x4b, 0x36, 0xb5, 0xaa, 0x61, 0xb6, 0x84, 0x7c, 0x1a, 0xdb, 0xec, 0x9b, 0x01, 0x4f, 0xd2, 0xf7,
+  0x15, 0xe5, 0x86, 0x5e, 0x3e, 0xe4, 0x7f, 0x20, 0xd1, 0x45, 0x9c, 0x61, 0x9a, 0x2a, 0x0b, 0x2f,
+  0x60, 0x5a, 0xfc, 0x0c, 0xc2, 0x71, 0x30, 0x30, 0x90, 0x33, 0x6d, 0x4a, 0x7b, 0x79, 0x6b, 0x8a,
+  0x4f, 0x9b, 0x47, 0x5e, 0x12, 0x23, 0x73, 0xd5, 0xd7, 0x2b, 0xbb, 0x56, 0x79, 0xca, 0x66, 0x24,
+  0x57, 0x54, 0x39, 0x7c, 0x9d, 0xa6, 0x2a, 0x03, 0xb3, 0x53, 0x41, 0x3e, 0x97, 0x0a, 0xa2, 0x53,
+  0x05, 0xc9, 0xa3, 0x4f, 0x10, 0xc1, 0xfd, 0x67, 0x1f, 0xab, 0x59, 0x2d, 0xd6, 0xe8, 0xc5, 0x93,
+  0xe3, 0xfe, 0x68, 0x4c, 0x4b, 0x2d, 0x6b, 0x4a, 0x19, 0x52, 0x91, 0xdc, 0xa0, 0xef, 0xc3, 0x23,
+  0x88, 0x90, 0xaf, 0x40, 0xfc, 0x89, 0x64, 0xf5, 0xd0, 0x2c, 0x43, 0x16, 0xf1, 0xb3, 0x70, 0x9e,
+  0x25, 0x77, 0x6b, 0x90, 0xd1, 0xde, 0x22, 0xc8, 0x92, 0x03, 0xe0, 0xe7, 0x3c, 0x0c, 0xf1, 0x28,
+  0x88, 0x41, 0xf9, 0x98, 0x56, 0x2a, 0xdf, 0x29, 0xa5, 0x7c, 0x1b, 0x44, 0xd9, 0xa0, 0x4f, 0x6b,
+  0xd0, 0xc6, 0xbb, 0x06, 0xe7, 0xac, 0x0f, 0xc3, 0xfe, 0x94, 0xf7, 0xfd, 0xd9, 0xb4, 0x07, 0xd7,
+  0x13, 0x7b, 0x30, 0x19, 0x0e, 0x67, 0x36, 0x5e, 0x3b, 0x23, 0xd7, 0xf2, 0x1d, 0xd7, 0xc7, 0x6b,
+  0x31, 0x73, 0x46, 0x9e, 0xc3, 0x47, 0x78, 0x3d, 0x98, 0x8d, 0xc6, 0x6e, 0x7f, 0xe4, 0xe0, 0xf5,
+  0x68, 0xe6, 0xdb, 0xb6, 0xed, 0x53, 0xfb, 0x59, 0x7f, 0xe0, 0x4f, 0xfb, 0x1c, 0x8f, 0x3f, 0x7e,
+  0xe0, 0x8e, 0xed, 0x8e, 0x84, 0x37, 0xea, 0x69, 0xf0, 0x79, 0x53, 0x6b, 0xc2, 0xb9, 0xc4, 0x67,
+  0xf7, 0xa7, 0x83, 0x91, 0x63, 0x51, 0xff, 0xfe, 0x70, 0x60, 0x4f, 0x47, 0x8e, 0x20, 0xb8, 0x23,
+  0xcb, 0x9d, 0x78, 0xee, 0x80, 0x68, 0xea, 0x3b, 0x62, 0xe4, 0x4d, 0x08, 0xee, 0xd4, 0xf2, 0x84,
+  0x63, 0xfb, 0xd4, 0x66, 0xe6, 0x78, 0xae, 0x35, 0xe6, 0x13, 0xbc, 0x76, 0xed, 0x99, 0xe3, 0xdb,
+  0xd0, 0x46, 0x83, 0x4f, 0x0c, 0x67, 0xce, 0x78, 0xe6, 0x12, 0x0e, 0xe1, 0x3b, 0x62, 0x38, 0x99,
+  0x8e, 0xf1, 0xda, 0xf2, 0xa1, 0x97, 0xe7, 0x8e, 0x25, 0x6e, 0xcb, 0xe5, 0xb6, 0xeb, 0xd2, 0xb5,
+  0x27, 0x66, 0x7d, 0x77, 0x4c, 0xe3, 0x1e, 0xf2, 0xc9, 0x70, 0x3a, 0xe4, 0x9c, 0x68, 0x72, 0x1d,
+  0x8b, 0x43, 0x07, 0xa2, 0x69, 0x0c, 0x0c, 0x9b, 0x7a, 0x5c, 0x87, 0x6f, 0x36, 0x1d, 0x88, 0x91,
+  0x3d, 0xea, 0x13, 0x1f, 0xa6, 0x03, 0xdb, 0x1d, 0x8f, 0x3d, 0xe2, 0xa7, 0x65, 0x0d, 0xfa, 0x13,
+  0x97, 0xc6, 0xed, 0xf8, 0xa3, 0xd9, 0xc4, 0x77, 0x25, 0xed, 0x63, 0x01, 0xe9, 0x98, 0x4f, 0x63,
+  0xf5, 0x46, 0x7c, 0x32, 0xb3, 0x87, 0xf4, 0xdc, 0x1a, 0xbb, 0x7c, 0x3c, 0x18, 0x11, 0xdd, 0xf6,
+  0xb0, 0x3f, 0xeb, 0xcf, 0xc6, 0x13, 0x1d, 0xbe, 0xfe, 0xc4, 0x99, 0x58, 0x7c, 0x4a, 0xb2, 0xe9,
+  0x0b, 0xdb, 0xe9, 0xdb, 0x03, 0xc2, 0x31, 0xf4, 0x60, 0x14, 0x9e, 0x4f, 0xf4, 0x8e, 0x06, 0x03,
+  0x60, 0x9d, 0x4d, 0x38, 0xc6, 0x23, 0x8b, 0x4f, 0x06, 0xa3, 0xa1, 0x1c, 0xc7, 0x98, 0x5b, 0xdc,
+  0x21, 0x59, 0x4e, 0x6d, 0xb7, 0xef, 0xce, 0xfa, 0x92, 0xb7, 0xfd, 0x49, 0xbf, 0xef, 0x4e, 0xb5,
+  0xf2, 0xe3, 0x7d, 0xc7, 0x17, 0x53, 0x6e, 0xcb, 0xf1, 0xd9, 0x7c, 0x3c, 0x1e, 0x52, 0x7f, 0xb7,
+  0x3f, 0x74, 0xa6, 0x40, 0x0a, 0x5d, 0x4f, 0xc6, 0xee, 0xc8, 0xe6, 0x72, 0x4c, 0x36, 0x00, 0x9d,
+  0xda, 0x33, 0xba, 0x1e, 0xcf, 0x66, 0xd6, 0xb8, 0x4f, 0xb8, 0xfd, 0xa1, 0x25, 0x06, 0x23, 0x49,
+  0xb7, 0x0d, 0x82, 0xe4, 0x16, 0xf4, 0xd5, 0xe0, 0xb3, 0x67, 0x7c, 0xe8, 0xda, 0x36, 0xc9, 0xc9,
+  0x16, 0x03, 0x80, 0x6c, 0xd1, 0xf8, 0xfa, 0x20, 0x9a, 0xc9, 0x64, 0x48, 0xe3, 0x1b, 0x0c, 0x1d,
+  0xcb, 0x71, 0x1d, 0xa5, 0x9f, 0xb6, 0x6b, 0xb9, 0x0e, 0xe1, 0x1e, 0x0a, 0x6f, 0xca, 0xf9, 0x50,
+  0xca, 0xcf, 0x99, 0xb9, 0x2e, 0x1f, 0x92, 0x5c, 0xc7, 0xd3, 0xbe, 0x18, 0xfb, 0xc0, 0x73, 0x0d,
+  0x3e, 0x00, 0x0b, 0x7a, 0x2c, 0x88, 0x0f, 0x93, 0x29, 0x1f, 0x8d, 0x07, 0x52, 0x17, 0xa6, 0x43,
+  0x77, 0x3a, 0x99, 0xda, 0x52, 0x0f, 0x5d, 0x77, 0x62, 0xf5, 0x25, 0x1d, 0x33, 0xcb, 0x11, 0xbe,
+  0xef, 0x13, 0x0e, 0x3e, 0x1c, 0x81, 0xd8, 0x04, 0xf1, 0x03, 0x9e, 0xce, 0xf8, 0xc0, 0x57, 0x32,
+  0x9e, 0xd8, 0x93, 0xa9, 0xdf, 0xbf, 0xd6, 0xfa, 0xf4, 0x17, 0xba, 0x99, 0x0a, 0x44, 0x72, 0x6b,
+  0x26, 0xc6, 0x63, 0x02, 0xe0, 0x38, 0xe3, 0x09, 0x17, 0x92, 0x59, 0x03, 0xd0, 0x18, 0x7f, 0x30,
+  0x91, 0x0a, 0x36, 0x1a, 0xfa, 0xfe, 0x68, 0xc0, 0x77, 0xd4, 0xcb, 0xea, 0xe3, 0x1b, 0xd9, 0x96,
+  0x18, 0xf5, 0x27, 0xbe, 0x9c, 0x43, 0xd6, 0x68, 0x3c, 0x9d, 0x12, 0x0f, 0x6d, 0x7f, 0x3a, 0xf0,
+  0x66, 0x5c, 0xce, 0x6b, 0x47, 0x58, 0x2e, 0x08, 0x4e, 0x4f, 0xaf, 0xac, 0x6f, 0x9f, 0x33, 0x83,
+  0xac, 0xcf, 0x76, 0x19, 0x74, 0x06, 0xff, 0x8d, 0x07, 0x5d, 0x76, 0x71, 0xc1, 0xc6, 0x5d, 0x76,
+  0x76, 0xc6, 0xc6, 0xba, 0xde, 0xab, 0x74, 0x51, 0x1a, 0xef, 0x54, 0x0e, 0x57, 0x57, 0x43, 0x85,
+  0x86, 0x18, 0xbe, 0x1b, 0x9a, 0x92, 0x13, 0xbc, 0x7a, 0x57, 0xc2, 0x7d, 0x0d, 0x00, 0xd1, 0x38,
+  0xe8, 0xd0, 0xe1, 0xf7, 0x72, 0x14, 0x3e, 0x0c, 0x60, 0x7e, 0x82, 0x5b, 0x03, 0x21, 0x3b, 0x1b,
+  0xdf, 0x17, 0x49, 0x0d, 0x2e, 0x36, 0x46, 0x9c, 0x52, 0x12, 0x92, 0x2a, 0x76, 0xcc, 0x40, 0xce,
+  0xa5, 0x95, 0xab, 0xf2, 0xa0, 0x4f, 0x50, 0x11, 0x2d, 0xf9, 0xd3, 0x3d, 0x0c, 0x18, 0x28, 0x50,
+  0x05, 0xc4, 0x97, 0x6c, 0x8a, 0x2c, 0xc3, 0x6d, 0x38, 0x3a, 0xfa, 0x7f, 0xd6, 0x28, 0xc7, 0x78,
+  0xa8, 0x6d, 0x9a, 0xc4, 0x19, 0x46, 0x22, 0xc6, 0x07, 0xf0, 0xa6, 0x72, 0x4f, 0xd1, 0x07, 0x02,
+  0x0c, 0x37, 0xff, 0xc0, 0x6b, 0x90, 0x88, 0x31, 0xe8, 0x03, 0x09, 0x51, 0x57, 0xb7, 0xdd, 0x01,
+  0x8b, 0x19, 0xe0, 0xdd, 0x90, 0x97, 0x73, 0xba, 0x38, 0x93, 0x92, 0x96, 0x37, 0x8f, 0x71, 0x09,
+  0xa6, 0xab, 0x3d, 0x52, 0xa6, 0xfa, 0x06, 0xb2, 0x67, 0x00, 0xfd, 0xec, 0x31, 0xfc, 0x7d, 0xfc,
+  0xb8, 0x2d, 0x31, 0xfb, 0xf9, 0x5d, 0x80, 0x22, 0x23, 0x06, 0x2d, 0x0a, 0x06, 0x11, 0x16, 0xe8,
+  0xfe, 0x25, 0x1b, 0x76, 0x0f, 0xde, 0xc6, 0x90, 0x23, 0x26, 0x8c, 0x80, 0x79, 0x3c, 0xdc, 0x89,
+  0x59, 0xad, 0x60, 0x5a, 0xb8, 0x1b, 0x08, 0xb8, 0x65, 0x00, 0x25, 0xc0, 0x0f, 0x7b, 0x74, 0xdd,
+  0x63, 0x93, 0x2e, 0xfb, 0xf7, 0xc6, 0x43, 0x7b, 0x8a, 0x4f, 0xb7, 0x4f, 0x88, 0x9f, 0x83, 0xee,
+  0x7c, 0x17, 0x70, 0xbb, 0x0a, 0xbc, 0x8f, 0x60, 0xea, 0xc0, 0xe9, 0xe1, 0xac, 0x04, 0xbb, 0x2f,
+  0x41, 0xdb, 0x56, 0x0b, 0x6c, 0xc5, 0x32, 0x45, 0xc8, 0x18, 0x2b, 0x6b, 0x30, 0x8a, 0xc7, 0xea,
+  0xc1, 0x84, 0xee, 0xed, 0x43, 0xb8, 0x86, 0x0c, 0x7b, 0x07, 0xc6, 0x0a, 0xe6, 0x39, 0x4c, 0x7b,
+  0xf0, 0x4c, 0x60, 0xe8, 0xc0, 0x16, 0x2c, 0x7a, 0x8c, 0xa6, 0xd1, 0x8b, 0xf9, 0x41, 0x02, 0x3e,
+  0x88, 0xcd, 0x19, 0x72, 0x02, 0x0d, 0x83, 0x41, 0x23, 0x07, 0x44, 0xe3, 0x82, 0x0d, 0x70, 0x63,
+  0xdb, 0xe5, 0xbb, 0xfe, 0x88, 0x56, 0x6c, 0x0d, 0x43, 0xb0, 0x47, 0xb8, 0x07, 0x02, 0x38, 0xf3,
+  0x1f, 0x78, 0xb9, 0xa0, 0xc7, 0xdf, 0xe1, 0xf0, 0x69, 0xb4, 0xd7, 0xbb, 0x78, 0x9f, 0xf5, 0x51,
+  0xff, 0x09, 0x24, 0x0c, 0xb1, 0x5f, 0xc0, 0x87, 0x1b, 0x7b, 0x50, 0xbe, 0xeb, 0xf7, 0x15, 0x36,
+  0x0e, 0x28, 0x1c, 0xc2, 0x86, 0x57, 0x2e, 0x5d, 0x39, 0x74, 0xd5, 0x22, 0x08, 0x5c, 0x86, 0x5b,
+  0xcc, 0x19, 0x6d, 0xd5, 0x9e, 0x33, 0x9c, 0x2d, 0x62, 0xce, 0xb0, 0xf6, 0x6a, 0x78, 0x00, 0x30,
+  0xb3, 0xd5, 0x5c, 0xd6, 0x77, 0xc6, 0x8d, 0x01, 0xee, 0x9c, 0xb9, 0xf0, 0xc7, 0x99, 0x33, 0x07,
+  0xa3, 0xe6, 0x39, 0xc3, 0x24, 0xd1, 0x00, 0x5e, 0x41, 0xef, 0x7e, 0x6b, 0xef, 0xa6, 0x20, 0x5f,
+  0xbc, 0xb3, 0xae, 0x71, 0x56, 0x02, 0x84, 0x17, 0xef, 0x6c, 0xba, 0x74, 0xf0, 0xb2, 0x4f, 0x97,
+  0x2e, 0x5e, 0x0e, 0xe8, 0xd2, 0x9b, 0x6b, 0xfa, 0x0e, 0xe9, 0x95, 0xc0, 0x56, 0x23, 0xba, 0xf4,
+  0xf1, 0x72, 0x4c, 0x97, 0x0b, 0xbc, 0x9c, 0xd0, 0xe5, 0x72, 0xff, 0xae, 0xaa, 0x98, 0x4e, 0x78,
+  0xd4, 0xec, 0xf9, 0xa0, 0xaf, 0xb5, 0x50, 0xd0, 0xf6, 0x27, 0x8d, 0x3d, 0xc6, 0x82, 0x90, 0xd6,
+  0x1e, 0xbf, 0x30, 0x41, 0xf9, 0x2e, 0x39, 0xd6, 0x1c, 0x6e, 0x70, 0x7d, 0x9f, 0xea, 0x81, 0x12,
+  0x46, 0xc9, 0xb2, 0x92, 0xc9, 0xe8, 0xb1, 0x9b, 0x96, 0x6d, 0x03, 0xd0, 0x61, 0x6f, 0x51, 0x46,
+  0x7c, 0x28, 0x42, 0x76, 0xb5, 0x0b, 0x11, 0xab, 0x2f, 0xbd, 0xfc, 0x20, 0x26, 0x73, 0xee, 0xca,
+  0xa9, 0x15, 0xb8, 0x76, 0x2c, 0xfd, 0x43, 0xba, 0x23, 0xab, 0x07, 0x69, 0x69, 0x05, 0xae, 0xb5,
+  0x8c, 0x40, 0x71, 0x3b, 0x20, 0xd2, 0xee, 0x7e, 0x51, 0x6b, 0x04, 0xb2, 0x62, 0x20, 0x33, 0x29,
+  0xda, 0x9b, 0xc2, 0x91, 0x9b, 0x4f, 0x89, 0x35, 0x86, 0x96, 0xa3, 0x5e, 0xb0, 0xc0, 0xc2, 0xda,
+  0x39, 0x53, 0x6b, 0x4f, 0xae, 0xcc, 0x22, 0x1e, 0x81, 0x06, 0xd3, 0x15, 0x7d, 0x42, 0x2a, 0x14,
+  0xec, 0xab, 0x86, 0x0e, 0xd4, 0x24, 0x26, 0x91, 0x56, 0x3a, 0x99, 0x12, 0xb8, 0xd1, 0x51, 0xac,
+  0x81, 0x7c, 0x8e, 0x7c, 0x71, 0x97, 0x9d, 0x6a, 0x16, 0x05, 0x2a, 0x69, 0x49, 0x0d, 0xb8, 0xec,
+  0xa6, 0x95, 0x4e, 0x69, 0x73, 0xac, 0x44, 0x07, 0xee, 0xd1, 0x21, 0x41, 0x3b, 0x66, 0x16, 0x5f,
+  0x65, 0xb8, 0x90, 0x68, 0xd8, 0xe3, 0x2e, 0x24, 0x62, 0x1e, 0x9d, 0x10, 0x33, 0x20, 0xf0, 0xe9,
+  0x58, 0x9d, 0x6e, 0xbe, 0xb5, 0xb2, 0x73, 0xd8, 0x5e, 0x1a, 0x55, 0xf5, 0xaa, 0x6f, 0x52, 0xaa,
+  0x49, 0xa9, 0xb4, 0xd7, 0xa1, 0x5d, 0x4c, 0x78, 0x74, 0xa2, 0x7c, 0x06, 0xe5, 0x13, 0x4e, 0x59,
+  0x34, 0x4e, 0x5a, 0x6b, 0xf7, 0x12, 0x35, 0x8b, 0x02, 0xfb, 0x16, 0xc3, 0x5a, 0x76, 0x2a, 0x95,
+  0x0b, 0x36, 0x96, 0xdc, 0xc0, 0xa7, 0xdb, 0xfe, 0xa4, 0xdf, 0xa8, 0xd4, 0x2c, 0x8d, 0x57, 0x17,
+  0x3b, 0x1a, 0x63, 0xc1, 0x8d, 0xee, 0xbf, 0xe9, 0x96, 0xd6, 0xf0, 0xf0, 0xa3, 0xb9, 0xf8, 0x35,
+  0x5f, 0x4d, 0xc3, 0x2f, 0x10, 0x06, 0x91, 0x8f, 0x9f, 0xde, 0xf1, 0xf2, 0x65, 0x17, 0x35, 0xd3,
+  0x64, 0x2d, 0x54, 0xee, 0x0f, 0x28, 0x2f, 0x3e, 0x57, 0x05, 0xe2, 0xaa, 0xa5, 0x3a, 0x94, 0x60,
+  0x69, 0x47, 0x18, 0xe8, 0xcf, 0xf7, 0xf1, 0xad, 0x48, 0x9e, 0x71, 0xc8, 0xe0, 0xbb, 0xa6, 0x88,
+  0xbc, 0xf4, 0xe7, 0x20, 0x5b, 0x1a, 0x1d, 0xc0, 0xdd, 0xe9, 0xe2, 0x52, 0xd8, 0xe2, 0xd7, 0x60,
+  0x4d, 0xcb, 0x5c, 0x78, 0xae, 0xb6, 0xd3, 0xb6, 0xb8, 0x26, 0x75, 0xbb, 0x98, 0x98, 0xb5, 0x99,
+  0xdc, 0xb2, 0x18, 0xea, 0x6c, 0x50, 0xd1, 0x98, 0x0b, 0x33, 0x18, 0xcf, 0x24, 0xa0, 0x91, 0x88,
+  0x6f, 0x23, 0xd2, 0x9d, 0x94, 0x96, 0x7e, 0x02, 0xb9, 0x2a, 0x9f, 0x5b, 0x18, 0xbe, 0x00, 0x39,
+  0xa2, 0x89, 0x8c, 0x04, 0x6d, 0x1d, 0xa6, 0xcf, 0xbb, 0xb4, 0x10, 0x04, 0x6c, 0x0b, 0xdc, 0xa6,
+  0xd1, 0x2d, 0xd9, 0x0d, 0xb9, 0x0f, 0x19, 0x44, 0x3c, 0xec, 0x56, 0x6d, 0x48, 0xeb, 0xf1, 0x05,
+  0x45, 0xef, 0x39, 0x93, 0x53, 0x8e, 0x66, 0xe4, 0xb3, 0x25, 0x4f, 0x9e, 0xe1, 0x7e, 0x25, 0xd3,
+  0x34, 0x09, 0xa7, 0xda, 0xb7, 0x74, 0xf9, 0xfc, 0xe7, 0xa7, 0xad, 0xdc, 0xa2, 0xba, 0xb2, 0xa6,
+  0x98, 0xf8, 0xf2, 0xaa, 0x59, 0x10, 0xa2, 0xb6, 0x5f, 0x21, 0x4f, 0xa8, 0x18, 0x64, 0x28, 0x22,
+  0x40, 0x32, 0xf2, 0x0a, 0x65, 0x83, 0x6f, 0x69, 0x45, 0xf2, 0x11, 0x6a, 0x2a, 0xb5, 0x2b, 0xf4,
+  0x96, 0x3d, 0x3e, 0x34, 0xef, 0xa1, 0x9f, 0xce, 0xa3, 0x92, 0xa6, 0x10, 0xa4, 0xb2, 0xe6, 0x10,
+  0x0a, 0x92, 0xad, 0xac, 0x4c, 0xd1, 0xa5, 0xb6, 0x30, 0x55, 0x6c, 0xab, 0x43, 0xf2, 0x0f, 0x28,
+  0x4f, 0xe9, 0x4a, 0x54, 0xb2, 0xaf, 0xa6, 0x48, 0x55, 0x06, 0x7a, 0xd8, 0x42, 0x97, 0xe4, 0x3b,
+  0x8f, 0xd2, 0x5b, 0xda, 0xdd, 0x5c, 0x2a, 0x5b, 0x6d, 0x91, 0xb4, 0x8c, 0x40, 0x76, 0x32, 0x37,
+  0xeb, 0x5f, 0xb2, 0xf8, 0x17, 0x8f, 0xd6, 0x7e, 0x5b, 0xf6, 0x99, 0x2d, 0xe3, 0x5b, 0x65, 0x12,
+  0x3a, 0xa5, 0xba, 0x69, 0x65, 0xcd, 0x21, 0x5b, 0x82, 0x4e, 0xd3, 0x9c, 0x36, 0xd9, 0x8f, 0x31,
+  0xdc, 0x61, 0xf1, 0x94, 0xa7, 0xca, 0x68, 0xe0, 0xa2, 0x12, 0xc8, 0x5f, 0x7d, 0x7d, 0xa7, 0xd3,
+  0x9d, 0x7f, 0xe2, 0x12, 0xbd, 0x9a, 0x9b, 0xc5, 0xb4, 0x57, 0x43, 0x51, 0x0f, 0x9a, 0x10, 0xb4,
+  0x91, 0xb0, 0xaa, 0x5a, 0x9f, 0xeb, 0x42, 0x2e, 0x7c, 0x8f, 0x45, 0x60, 0x79, 0xa4, 0x48, 0xd3,
+  0x40, 0x1a, 0xa7, 0xbc, 0xf2, 0x7d, 0x56, 0x32, 0xa7, 0x6d, 0x3a, 0xa0, 0x35, 0x88, 0xf5, 0x43,
+  0x4c, 0x5e, 0xbe, 0x55, 0x0b, 0x37, 0x04, 0x14, 0x65, 0xf5, 0xed, 0x66, 0xb8, 0x76, 0xbb, 0x5d,
+  0xfe, 0x29, 0x46, 0xa6, 0x8c, 0x56, 0xfb, 0x2a, 0x46, 0xc9, 0x60, 0xe4, 0x8f, 0xa0, 0x71, 0x77,
+  0x07, 0xec, 0x9d, 0x5c, 0x91, 0xbb, 0x0b, 0x69, 0xa5, 0x88, 0x19, 0x22, 0x49, 0xba, 0x3b, 0x86,
+  0x0c, 0x96, 0xf2, 0xb5, 0xac, 0x49, 0x17, 0x8b, 0xf8, 0xcd, 0x55, 0x1a, 0xb5, 0x99, 0xa4, 0x15,
+  0x08, 0x1d, 0x69, 0x28, 0x4a, 0xe8, 0x30, 0x99, 0x1e, 0x3f, 0xce, 0x09, 0xbc, 0x28, 0xef, 0x0e,
+  0xdc, 0x45, 0x48, 0x4b, 0xa1, 0x7d, 0xbf, 0x16, 0x56, 0xb7, 0xc8, 0xcb, 0x45, 0xaf, 0x42, 0x78,
+  0xb6, 0x65, 0x59, 0x10, 0x9b, 0x2a, 0x6a, 0x7a, 0xf8, 0x1d, 0x53, 0x6b, 0x17, 0x5f, 0x77, 0xeb,
+  0x87, 0x46, 0xaa, 0xba, 0x12, 0xfd, 0x0e, 0xea, 0x73, 0xa9, 0x48, 0xe3, 0x72, 0xb9, 0x5b, 0x36,
+  0xdb, 0x0a, 0xbc, 0x12, 0x36, 0xd8, 0xb7, 0x07, 0x70, 0x73, 0xcb, 0xd1, 0x02, 0xdb, 0x7c, 0x67,
+  0x87, 0xfb, 0x07, 0x72, 0x5d, 0xff, 0xb4, 0xb9, 0x24, 0xb5, 0x7b, 0xba, 0xdc, 0xef, 0xb7, 0x13,
+  0xf9, 0x71, 0x18, 0xda, 0x9c, 0x26, 0x0e, 0xf4, 0x6c, 0x79, 0xf3, 0x83, 0x17, 0x3b, 0xb6, 0x87,
+  0x1b, 0x64, 0xc7, 0xfa, 0xb2, 0x18, 0x44, 0xf4, 0xc5, 0x2b, 0xf2, 0x1a, 0xe4, 0x89, 0x5f, 0x7e,
+  0xd7, 0x39, 0xc4, 0x62, 0xab, 0x9d, 0xcd, 0xae, 0xda, 0xee, 0xe9, 0x31, 0x65, 0x85, 0xf1, 0x8c,
+  0xcd, 0x9d, 0xa9, 0x76, 0x23, 0xca, 0x85, 0x2e, 0xe0, 0x1c, 0x46, 0xd9, 0xfb, 0x6c, 0xb5, 0xda,
+  0x3f, 0x7c, 0x30, 0x6a, 0x9f, 0xf6, 0xe7, 0x9d, 0xca, 0x4d, 0x47, 0xe5, 0x71, 0x00, 0x1a, 0xb9,
+  0x45, 0xe1, 0x80, 0x2d, 0xcb, 0xbb, 0x8d, 0x8a, 0x06, 0x6b, 0xbe, 0x3b, 0x10, 0x90, 0xa2, 0x85,
+  0x58, 0xc1, 0x60, 0xc0, 0x3b, 0xb5, 0xa1, 0xbc, 0x97, 0x94, 0x85, 0x77, 0xad, 0x9b, 0xa0, 0xf7,
+  0xef, 0xf1, 0x3f, 0x30, 0x38, 0xd7, 0xc4, 0x9b, 0xf7, 0x87, 0x2c, 0x70, 0x73, 0x88, 0xfd, 0xa2,
+  0xc0, 0xc7, 0x94, 0x2f, 0xcf, 0x53, 0xe9, 0xc8, 0x4c, 0x0f, 0xaf, 0x23, 0xb9, 0xbd, 0x76, 0x7b,
+  0x80, 0x6c, 0x87, 0x11, 0xc5, 0xbd, 0x03, 0x29, 0x5b, 0x05, 0xa0, 0x90, 0x72, 0x83, 0xa7, 0x3c,
+  0x06, 0xe9, 0xcd, 0xdb, 0xbe, 0xf9, 0x42, 0x51, 0xba, 0xfc, 0x6e, 0x0c, 0x05, 0xe9, 0xc0, 0xaa,
+  0x20, 0x5d, 0x96, 0xe1, 0xa9, 0xbd, 0xbd, 0x40, 0x06, 0x4f, 0xdf, 0xd3, 0x6e, 0xd5, 0xd6, 0x5c,
+  0xb8, 0xd8, 0xb4, 0xae, 0x3d, 0xe3, 0xf3, 0x07, 0xe7, 0x40, 0xe5, 0xed, 0x6b, 0x10, 0x21, 0xdb,
+  0xa0, 0x0e, 0xb8, 0xd7, 0x4f, 0x6e, 0x59, 0x3d, 0x38, 0x13, 0xda, 0x9e, 0xd8, 0x6f, 0x52, 0xf6,
+  0x3b, 0x64, 0x49, 0x18, 0x7c, 0x14, 0xa2, 0x3e, 0xd7, 0xee, 0xc3, 0x2b, 0x1d, 0xe3, 0xf2, 0x51,
+  0x1b, 0xfc, 0x5d, 0xe7, 0x04, 0x0a, 0x58, 0x8f, 0x35, 0x69, 0x8c, 0x29, 0x73, 0xdd, 0xfc, 0xbc,
+  0x84, 0x6f, 0xe2, 0x91, 0x3c, 0xbc, 0xfd, 0x6b, 0xd4, 0x39, 0x3c, 0x14, 0xcb, 0x51, 0x1c, 0xb0,
+  0xef, 0xa1, 0x4c, 0x51, 0x65, 0xff, 0x43, 0xfe, 0x10, 0x77, 0x9c, 0x40, 0xff, 0xa7, 0x61, 0xec,
+  0x18, 0xef, 0xf2, 0x87, 0xd7, 0x3d, 0xf6, 0x1b, 0x7d, 0x6e, 0x07, 0x66, 0x34, 0xee, 0x6c, 0x3f,
+  0xa1, 0x75, 0xd4, 0x0e, 0xbb, 0xef, 0x82, 0x08, 0xf3, 0x46, 0x66, 0x56, 0xfd, 0xf4, 0x83, 0x26,
+  0x39, 0x79, 0x5b, 0xda, 0x43, 0xe1, 0xa7, 0x32, 0x09, 0x91, 0x7b, 0xdf, 0xdb, 0xbe, 0x2a, 0x51,
+  0xfd, 0x5e, 0x12, 0xa4, 0xf1, 0x79, 0xd6, 0x06, 0x99, 0xca, 0x57, 0xf2, 0xe5, 0xb9, 0xdd, 0xa9,
+  0x6f, 0x8f, 0x7f, 0x48, 0x5e, 0x94, 0x13, 0xd6, 0xab, 0xf0, 0xe5, 0xff, 0x43, 0xde, 0x41, 0x53,
+  0xfb, 0xf0, 0xac, 0xa3, 0x6d, 0xa3, 0x31, 0x88, 0x5f, 0x7d, 0x00, 0x83, 0x0e, 0xc4, 0xe5, 0x67,
+  0x72, 0xe5, 0x69, 0x38, 0xc4, 0x61, 0xaa, 0x26, 0x66, 0x10, 0xb9, 0xe1, 0xc6, 0x43, 0xe3, 0x41,
+  0x7a, 0xda, 0x9e, 0xd2, 0xe6, 0xeb, 0x54, 0x79, 0xc7, 0x43, 0x0e, 0xd9, 0xe9, 0xd3, 0x80, 0x54,
+  0x1e, 0xa0, 0xb0, 0x0e, 0x2b, 0x8e, 0xe7, 0xf8, 0xe4, 0x02, 0xcf, 0x01, 0x85, 0x72, 0x7f, 0x4b,
+  0xe4, 0x9e, 0x02, 0xb7, 0x3a, 0x87, 0x71, 0xce, 0x8c, 0x00, 0x68, 0xb7, 0xe5, 0x4e, 0x5d, 0x94,
+  0x5e, 0x15, 0x67, 0x6d, 0x2a, 0xef, 0x82, 0x88, 0xa3, 0x3f, 0x70, 0xc6, 0xe6, 0x27, 0xe3, 0x2a,
+  0x33, 0x16, 0x1f, 0x80, 0xfe, 0x2a, 0x1b, 0xb2, 0x0b, 0xd3, 0xa6, 0x3a, 0xed, 0xb0, 0xfd, 0x57,
+  0x28, 0x58, 0x19, 0x1a, 0xa1, 0x84, 0x49, 0x95, 0x30, 0x0d, 0x47, 0xa2, 0xe9, 0xb1, 0x88, 0x5c,
+  0x48, 0xff, 0xdf, 0xbe, 0xfe, 0x16, 0x2d, 0x34, 0xf8, 0xcc, 0x28, 0xcb, 0xa5, 0xde, 0x42, 0x5e,
+  0x2e, 0x8e, 0x72, 0x8a, 0xc2, 0xe6, 0xf9, 0x6d, 0xbb, 0x20, 0xb6, 0x09, 0x5f, 0xaa, 0x35, 0xd9,
+  0x0f, 0x0b, 0xd3, 0xf7, 0x6e, 0xa7, 0x52, 0x5c, 0xac, 0x6d, 0xa7, 0x2a, 0x7b, 0x26, 0x52, 0xb9,
+  0xc7, 0xf5, 0xf3, 0x43, 0xbd, 0xb2, 0xbe, 0x76, 0xeb, 0xe7, 0x93, 0x0e, 0x89, 0xfd, 0xc5, 0x3f,
+  0x29, 0xea, 0x17, 0xbf, 0x77, 0xbc, 0x5f, 0xda, 0x11, 0x84, 0xc1, 0x70, 0x73, 0xe7, 0xd8, 0x3e,
+  0xda, 0x5a, 0xce, 0x47, 0xef, 0xc7, 0x9a, 0x7f, 0xba, 0x00, 0xb5, 0x13, 0x50, 0xde, 0xa5, 0xb4,
+  0x45, 0xbd, 0xb2, 0x8d, 0x0a, 0x4f, 0xe7, 0xd3, 0x82, 0x41, 0x1a, 0xe7, 0x41, 0x18, 0xcf, 0x8a,
+  0x1d, 0x9c, 0x24, 0x4b, 0x2a, 0xf0, 0x1d, 0x32, 0xb2, 0xfa, 0x9e, 0xa7, 0x61, 0xbe, 0x29, 0x4e,
+  0x2f, 0x91, 0xc3, 0xd2, 0xda, 0x4f, 0xd8, 0x1b, 0xf5, 0xe9, 0x09, 0x70, 0xa1, 0x4d, 0x68, 0xb2,
+  0x76, 0xa7, 0xc1, 0x6d, 0x59, 0x5d, 0x44, 0x91, 0x4b, 0x49, 0xf9, 0x3f, 0x2d, 0x95, 0x83, 0xd0,
+  0x75, 0x4f, 0x22, 0x47, 0x16, 0x0a, 0xdb, 0x69, 0x6c, 0xd4, 0xbe, 0x04, 0x0e, 0x7a, 0xe9, 0xd3,
+  0x37, 0x7c, 0xf1, 0xe0, 0xe4, 0xed, 0x0a, 0xf5, 0xae, 0x48, 0xdd, 0x64, 0x36, 0xa3, 0x31, 0xf7,
+  0x10, 0x01, 0xe6, 0xb5, 0xd1, 0xe6, 0xd1, 0x74, 0xe2, 0x60, 0x0f, 0x1b, 0xec, 0x9b, 0xbe, 0x34,
+  0x48, 0x15, 0xe7, 0x97, 0xc1, 0xe4, 0x8f, 0xfe, 0xd0, 0x64, 0x91, 0x86, 0x5a, 0x4b, 0x15, 0x73,
+  0x9e, 0xfd, 0x31, 0x89, 0x22, 0x61, 0x7c, 0x60, 0x9a, 0xd8, 0x1e, 0xcb, 0xb7, 0x7e, 0xc6, 0xeb,
+  0x21, 0x29, 0xe4, 0xc3, 0xd3, 0xc7, 0x96, 0x84, 0x71, 0x59, 0x14, 0x5f, 0xf4, 0xa7, 0x5d, 0x15,
+  0x0f, 0x8a, 0xe1, 0x62, 0x68, 0xdd, 0x38, 0x96, 0x2f, 0x3f, 0x4e, 0x5e, 0x3d, 0x48, 0xaa, 0x7a,
+  0xcc, 0x75, 0x2d, 0xe9, 0x2b, 0x4f, 0xea, 0x1b, 0x71, 0xea, 0x2b, 0x74, 0xc4, 0x58, 0x04, 0xae,
+  0xed, 0xb0, 0x37, 0x69, 0x6b, 0x59, 0xb2, 0xc5, 0xa3, 0x93, 0x6d, 0xa3, 0x2b, 0xa7, 0x6d, 0xfa,
+  0x01, 0x7d, 0x1c, 0x4b, 0xf1, 0xf0, 0xb6, 0xca, 0x94, 0x1b, 0x2b, 0x89, 0xfa, 0xe5, 0xc0, 0x27,
+  0x61, 0xa8, 0x5b, 0x11, 0xc4, 0xaf, 0xce, 0xa8, 0x95, 0x6d, 0xfa, 0xf6, 0x6c, 0xf3, 0x30, 0x0a,
+  0x3d, 0xde, 0xf9, 0xb9, 0xa2, 0x96, 0x13, 0x2c, 0x95, 0x2f, 0xd8, 0xd1, 0xb1, 0x81, 0x14, 0x9c,
+  0xd4, 0xed, 0x32, 0x0e, 0x8b, 0x54, 0x1e, 0x17, 0x9a, 0x04, 0xa7, 0xef, 0x7e, 0xe0, 0x72, 0x13,
+  0x95, 0xec, 0xf7, 0x7c, 0xd5, 0xaa, 0xf5, 0xf4, 0x7a, 0x73, 0x32, 0xb6, 0x7f, 0x93, 0x70, 0xfb,
+  0x65, 0x5b, 0x18, 0x7f, 0x5d, 0x02, 0x12, 0xd3, 0x57, 0xb9, 0xfc, 0x77, 0xac, 0xca, 0xe5, 0xdf,
+  0x00, 0x91, 0x5f, 0x74, 0x92, 0xdf, 0x47, 0xf2, 0x82, 0x84, 0xf8, 0x2d, 0xcf, 0x01, 0xee, 0x4c,
+  0x85, 0xdb, 0xbb, 0x6a, 0x3f, 0x01, 0xd2, 0xec, 0x26, 0xbf, 0xe1, 0x5a, 0x26, 0x99, 0xa8, 0xad,
+  0x7e, 0xd2, 0xb5, 0x33, 0xdf, 0x75, 0xb6, 0x08, 0x0f, 0x67, 0x07, 0x11, 0x08, 0xf4, 0xc5, 0x9b,
+  0x1f, 0xbe, 0x2f, 0x43, 0xaa, 0x7c, 0x95, 0x96, 0xa4, 0xb5, 0xe3, 0xbb, 0xb4, 0xf4, 0xbe, 0xa3,
+  0x59, 0x8d, 0x3f, 0x64, 0x2d, 0xec, 0x61, 0xdf, 0xbf, 0x6d, 0x19, 0xce, 0xce, 0x6f, 0x29, 0xb6,
+  0x35, 0xdc, 0x1d, 0x61, 0x6f, 0xf9, 0x4c, 0x6b, 0xe5, 0x2d, 0xc5, 0x8f, 0x6d, 0x4b, 0xdd, 0x57,
+  0x3a, 0x5a, 0x14, 0xe7, 0x01, 0xc5, 0x25, 0x7d, 0x40, 0xd1, 0x5e, 0x0e, 0xba, 0xd7, 0x7c, 0x67,
+  0xef, 0xec, 0x24, 0xff, 0xb6, 0xea, 0xd9, 0x89, 0xfc, 0xc0, 0xf9, 0xd9, 0x89, 0xfc, 0xff, 0x00,
+  0xfe, 0x2f, 0xe9, 0x83, 0xd1, 0xdf, 0x18, 0x70, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Generate src/web_ui_data.h from tools/web_ui/index.html.
+
+The web UI is served as a pre-built, gzip-compressed blob from flash, one per
+color mode. Text and colors are read from src/web_ui.h and src/web_ui.cpp, so
+after changing WEB_UI_* texts, LIGHT_* / DARK_* colors or the HTML template,
+run:
+
+    python3 tools/build_web_ui.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+TEMPLATE = os.path.join(ROOT, "tools", "web_ui", "index.html")
+WEB_UI_H = os.path.join(ROOT, "src", "web_ui.h")
+WEB_UI_CPP = os.path.join(ROOT, "src", "web_ui.cpp")
+OUTPUT = os.path.join(ROOT, "src", "web_ui_data.h")
+
+
+def read(path):
+    with open(path, encoding="utf-8") as f:
+        return f.read()
+
+
+def load_texts():
+    texts = {}
+    for name, value in re.findall(r'#define\s+(WEB_UI_\w+)\s+"([^"]*)"', read(WEB_UI_H)):
+        texts[name] = value
+    return texts
+
+
+def load_colors(prefix):
+    colors = {}
+    pattern = r'const char\*\s+' + prefix + r'_(\w+)\s*=\s*"([^"]*)"\s*;'
+    for name, value in re.findall(pattern, read(WEB_UI_CPP)):
+        colors[name] = value
+    return colors
+
+
+def render(template, values):
+    def substitute(match):
+        key = match.group(1)
+        if key not in values:
+            sys.exit("build_web_ui.py: no value for {{%s}}" % key)
+        return values[key]
+    return re.sub(r"\{\{(\w+)\}\}", substitute, template)
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+def main():
+    template = read(TEMPLATE)
+    texts = load_texts()
+    out = [
+        "// AUTO-GENERATED by tools/build_web_ui.py from tools/web_ui/index.html.",
+        "// Do not edit by hand; re-run the script after changing the template,",
+        "// the WEB_UI_* texts in web_ui.h or the color definitions in web_ui.cpp.",
+        "",
+        "#ifndef web_ui_data_h",
+        "#define web_ui_data_h",
+        "",
+    ]
+    for mode in ("LIGHT", "DARK"):
+        values = dict(texts)
+        values.update(load_colors(mode))
+        html = render(template, values).encode("utf-8")
+        compressed = gzip.compress(html, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(html).hexdigest()[:16]
+        out.append("// %s mode: %d bytes of HTML, %d bytes gzip-compressed"
+                   % (mode.lower(), len(html), len(compressed)))
+        out.append('#define WEB_UI_%s_ETAG "\\"%s\\""' % (mode, etag))
+        out.append(c_array("WEB_UI_%s_GZ" % mode, compressed))
+        print("%s: %d -> %d bytes, ETag %s" % (mode.lower(), len(html), len(compressed), etag))
+    out.append("#endif")
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
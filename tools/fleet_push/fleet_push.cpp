@@ -0,0 +1,545 @@
+// fleet_push - push an OTA image to many ESP32FwUploader devices at once.
+//
+//   c++ -std=c++17 -O2 -Wall -o fleet_push tools/fleet_push/fleet_push.cpp
+//
+//   ./fleet_push [options] IMAGE DEVICE...
+//   ./fleet_push [options] --devices devices.txt IMAGE
+//
+// DEVICE is host[:port]. Uploads go to /ota/upload as multipart/form-data,
+// the same request as curl -F "update=@firmware.bin", or with --raw to
+// /ota/raw as a bare application/octet-stream body. Up to
+// --jobs uploads run at a time on non-blocking sockets driven by poll(), so
+// one slow board does not hold up the rest. Failed uploads are retried;
+// authentication failures are not. A JSON report with the result, MB/s and
+// latency of every device is written to stdout, progress to stderr:
+//
+//   upload_s, mb_per_s  connection established until the device's answer
+//   connect_ms          TCP connect time
+//   latency_ms          last byte handed to the socket until the answer
+//
+// Options:
+//   --jobs N          concurrent uploads (default 8)
+//   --mode MODE       firmware (default) or filesystem
+//   --raw             send the image as a raw body instead of a form
+//   --user U --password P   HTTP basic auth
+//   --sha256 HEX      expected SHA-256 of the image, checked by the device
+//   --retries N       retries per device after a failure (default 2)
+//   --timeout S       abort an upload after S seconds without progress (default 30)
+//   --devices FILE    read devices from FILE, one per line (# comments)
+//
+// POSIX only (Linux, macOS). tools/fleet_push/standin_server.py emulates a
+// fleet of devices for testing.
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char* kBoundary = "----ESP32FwUploaderFleetPush";
+const int kRetryDelayMs = 2000;
+
+struct Options {
+  int jobs = 8;
+  std::string mode = "firmware";
+  bool raw = false;
+  std::string user;
+  std::string password;
+  std::string sha256;
+  int retries = 2;
+  int timeoutSec = 30;
+};
+
+enum class State { kQueued, kWaiting, kConnecting, kSending, kReceiving, kDone };
+
+struct Device {
+  std::string address;
+  std::string host;
+  std::string port = "80";
+
+  State state = State::kQueued;
+  int fd = -1;
+  int attempts = 0;
+  Clock::time_point retryAt;
+  Clock::time_point lastActivity;
+
+  // Timing of the last attempt
+  Clock::time_point startTime;
+  Clock::time_point connectedTime;
+  Clock::time_point sentTime;
+  Clock::time_point responseTime;
+
+  // Request: header + image + trailer, sent as one stream
+  std::string head;
+  size_t sent = 0;
+  std::string response;
+
+  // Result
+  bool ok = false;
+  bool fatal = false;
+  int httpStatus = 0;
+  std::string error;
+};
+
+double msBetween(Clock::time_point a, Clock::time_point b) {
+  return std::chrono::duration<double, std::milli>(b - a).count();
+}
+
+std::string base64(const std::string& in) {
+  static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  size_t i = 0;
+  for (; i + 2 < in.size(); i += 3) {
+    uint32_t v = (uint8_t)in[i] << 16 | (uint8_t)in[i + 1] << 8 | (uint8_t)in[i + 2];
+    out += table[v >> 18];
+    out += table[(v >> 12) & 63];
+    out += table[(v >> 6) & 63];
+    out += table[v & 63];
+  }
+  if (i < in.size()) {
+    uint32_t v = (uint8_t)in[i] << 16 | (i + 1 < in.size() ? (uint8_t)in[i + 1] << 8 : 0);
+    out += table[v >> 18];
+    out += table[(v >> 12) & 63];
+    out += i + 1 < in.size() ? table[(v >> 6) & 63] : '=';
+    out += '=';
+  }
+  return out;
+}
+
+std::string jsonEscape(const std::string& s) {
+  std::string out;
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if ((unsigned char)c < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", c);
+      out += buf;
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+class FleetPush {
+ public:
+  FleetPush(const Options& options, const std::string& imageName, std::vector<uint8_t> image,
+            std::vector<Device> devices)
+      : options_(options), imageName_(imageName), image_(std::move(image)), devices_(std::move(devices)) {
+    if (options_.raw) {
+      return;
+    }
+    std::string part = std::string("--") + kBoundary + "\r\n" +
+                       "Content-Disposition: form-data; name=\"update\"; filename=\"" + imageName_ + "\"\r\n" +
+                       "Content-Type: application/octet-stream\r\n\r\n";
+    partHead_ = part;
+    partTail_ = std::string("\r\n--") + kBoundary + "--\r\n";
+  }
+
+  void run() {
+    size_t done = 0;
+    while (done < devices_.size()) {
+      Clock::time_point now = Clock::now();
+      startJobs(now);
+
+      std::vector<pollfd> fds;
+      std::vector<Device*> owners;
+      for (Device& d : devices_) {
+        if (d.state == State::kConnecting || d.state == State::kSending) {
+          fds.push_back({d.fd, POLLOUT, 0});
+          owners.push_back(&d);
+        } else if (d.state == State::kReceiving) {
+          fds.push_back({d.fd, POLLIN, 0});
+          owners.push_back(&d);
+        }
+      }
+      poll(fds.data(), fds.size(), 100);
+
+      now = Clock::now();
+      for (size_t i = 0; i < fds.size(); i++) {
+        Device& d = *owners[i];
+        if (fds[i].revents) {
+          d.lastActivity = now;
+          service(d, now);
+        } else if (msBetween(d.lastActivity, now) > options_.timeoutSec * 1000.0) {
+          finishAttempt(d, false, "Timed out", now);
+        }
+      }
+
+      done = 0;
+      for (const Device& d : devices_) {
+        done += d.state == State::kDone;
+      }
+    }
+  }
+
+  void report() const {
+    printf("[\n");
+    for (size_t i = 0; i < devices_.size(); i++) {
+      const Device& d = devices_[i];
+      // The device answers once the whole image is written, so the upload
+      // runs until the response; the socket buffer hides part of it from send()
+      double uploadMs = msBetween(d.connectedTime, d.responseTime);
+      printf("  {\"device\": \"%s\", \"result\": \"%s\", \"http_status\": %d, \"attempts\": %d, "
+             "\"bytes\": %zu, \"upload_s\": %.3f, \"mb_per_s\": %.3f, \"connect_ms\": %.1f, "
+             "\"latency_ms\": %.1f, \"error\": \"%s\"}%s\n",
+             jsonEscape(d.address).c_str(), d.ok ? "ok" : "failed", d.httpStatus, d.attempts,
+             d.ok ? image_.size() : 0, d.ok ? uploadMs / 1000.0 : 0.0,
+             d.ok && uploadMs > 0 ? image_.size() / 1048576.0 / (uploadMs / 1000.0) : 0.0,
+             d.ok ? msBetween(d.startTime, d.connectedTime) : 0.0,
+             d.ok ? msBetween(d.sentTime, d.responseTime) : 0.0,
+             jsonEscape(d.error).c_str(), i + 1 < devices_.size() ? "," : "");
+    }
+    printf("]\n");
+  }
+
+  bool allOk() const {
+    for (const Device& d : devices_) {
+      if (!d.ok) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  Options options_;
+  std::string imageName_;
+  std::vector<uint8_t> image_;
+  std::vector<Device> devices_;
+  std::string partHead_;
+  std::string partTail_;
+
+  int active() const {
+    int n = 0;
+    for (const Device& d : devices_) {
+      n += d.state == State::kConnecting || d.state == State::kSending || d.state == State::kReceiving;
+    }
+    return n;
+  }
+
+  void startJobs(Clock::time_point now) {
+    int slots = options_.jobs - active();
+    for (Device& d : devices_) {
+      if (slots <= 0) {
+        break;
+      }
+      if (d.state == State::kQueued || (d.state == State::kWaiting && now >= d.retryAt)) {
+        startAttempt(d, now);
+        slots--;
+      }
+    }
+  }
+
+  void startAttempt(Device& d, Clock::time_point now) {
+    d.attempts++;
+    d.startTime = now;
+    d.lastActivity = now;
+    d.sent = 0;
+    d.response.clear();
+    d.httpStatus = 0;
+    d.error.clear();
+
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* res = nullptr;
+    int rc = getaddrinfo(d.host.c_str(), d.port.c_str(), &hints, &res);
+    if (rc != 0) {
+      finishAttempt(d, false, std::string("Cannot resolve host: ") + gai_strerror(rc), now);
+      return;
+    }
+    d.fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (d.fd < 0) {
+      freeaddrinfo(res);
+      finishAttempt(d, false, strerror(errno), now);
+      return;
+    }
+    fcntl(d.fd, F_SETFL, fcntl(d.fd, F_GETFL) | O_NONBLOCK);
+    rc = connect(d.fd, res->ai_addr, res->ai_addrlen);
+    freeaddrinfo(res);
+    if (rc < 0 && errno != EINPROGRESS) {
+      finishAttempt(d, false, strerror(errno), now);
+      return;
+    }
+
+    std::string path = (options_.raw ? "/ota/raw?mode=" : "/ota/upload?mode=") + options_.mode;
+    size_t bodyLength = partHead_.size() + image_.size() + partTail_.size();
+    std::ostringstream head;
+    head << "POST " << path << " HTTP/1.1\r\n"
+         << "Host: " << d.host << "\r\n";
+    if (options_.raw) {
+      head << "Content-Type: application/octet-stream\r\n";
+    } else {
+      head << "Content-Type: multipart/form-data; boundary=" << kBoundary << "\r\n";
+    }
+    head << "Content-Length: " << bodyLength << "\r\n"
+         << "Connection: close\r\n";
+    if (!options_.user.empty()) {
+      head << "Authorization: Basic " << base64(options_.user + ":" + options_.password) << "\r\n";
+    }
+    if (!options_.sha256.empty()) {
+      head << "X-Firmware-SHA256: " << options_.sha256 << "\r\n";
+    }
+    head << "\r\n" << partHead_;
+    d.head = head.str();
+    d.state = State::kConnecting;
+    fprintf(stderr, "%s: uploading (attempt %d)\n", d.address.c_str(), d.attempts);
+  }
+
+  void service(Device& d, Clock::time_point now) {
+    if (d.state == State::kConnecting) {
+      int err = 0;
+      socklen_t len = sizeof(err);
+      getsockopt(d.fd, SOL_SOCKET, SO_ERROR, &err, &len);
+      if (err != 0) {
+        finishAttempt(d, false, std::string("Connect failed: ") + strerror(err), now);
+        return;
+      }
+      d.connectedTime = now;
+      d.state = State::kSending;
+    }
+    if (d.state == State::kSending) {
+      sendSome(d, now);
+    } else if (d.state == State::kReceiving) {
+      receiveSome(d, now);
+    }
+  }
+
+  // Send as much of head + image + tail as the socket takes
+  void sendSome(Device& d, Clock::time_point now) {
+    size_t total = d.head.size() + image_.size() + partTail_.size();
+    while (d.sent < total) {
+      const char* data;
+      size_t len;
+      if (d.sent < d.head.size()) {
+        data = d.head.data() + d.sent;
+        len = d.head.size() - d.sent;
+      } else if (d.sent < d.head.size() + image_.size()) {
+        size_t off = d.sent - d.head.size();
+        data = (const char*)image_.data() + off;
+        len = image_.size() - off;
+      } else {
+        size_t off = d.sent - d.head.size() - image_.size();
+        data = partTail_.data() + off;
+        len = partTail_.size() - off;
+      }
+      ssize_t n = send(d.fd, data, len, MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+          return;
+        }
+        // The device may answer and close early, e.g. 401; read what it said
+        d.state = State::kReceiving;
+        receiveSome(d, now);
+        if (d.state != State::kDone) {
+          finishAttempt(d, false, std::string("Send failed: ") + strerror(errno), now);
+        }
+        return;
+      }
+      d.sent += n;
+    }
+    d.sentTime = now;
+    d.state = State::kReceiving;
+  }
+
+  void receiveSome(Device& d, Clock::time_point now) {
+    char buf[1024];
+    for (;;) {
+      ssize_t n = recv(d.fd, buf, sizeof(buf), 0);
+      if (n > 0) {
+        if (d.response.empty()) {
+          d.responseTime = now;
+        }
+        d.response.append(buf, n);
+        continue;
+      }
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        if (!responseComplete(d)) {
+          return;
+        }
+      }
+      break;
+    }
+    parseResponse(d, now);
+  }
+
+  static bool responseComplete(const Device& d) {
+    size_t end = d.response.find("\r\n\r\n");
+    if (end == std::string::npos) {
+      return false;
+    }
+    std::string headers = d.response.substr(0, end);
+    for (auto& c : headers) {
+      c = tolower(c);
+    }
+    size_t pos = headers.find("content-length:");
+    if (pos == std::string::npos) {
+      return false;
+    }
+    size_t length = strtoul(headers.c_str() + pos + 15, nullptr, 10);
+    return d.response.size() >= end + 4 + length;
+  }
+
+  void parseResponse(Device& d, Clock::time_point now) {
+    if (d.response.compare(0, 5, "HTTP/") != 0) {
+      finishAttempt(d, false, d.response.empty() ? "Connection closed without response" : "Malformed response", now);
+      return;
+    }
+    d.httpStatus = atoi(d.response.c_str() + d.response.find(' ') + 1);
+    size_t bodyStart = d.response.find("\r\n\r\n");
+    std::string body = bodyStart == std::string::npos ? "" : d.response.substr(bodyStart + 4);
+    if (d.httpStatus == 200 && body.compare(0, 2, "OK") == 0) {
+      finishAttempt(d, true, "", now);
+    } else if (d.httpStatus == 401) {
+      d.fatal = true;
+      finishAttempt(d, false, "Authentication failed", now);
+    } else {
+      finishAttempt(d, false, "HTTP " + std::to_string(d.httpStatus) + ": " + body, now);
+    }
+  }
+
+  void finishAttempt(Device& d, bool ok, const std::string& error, Clock::time_point now) {
+    if (d.fd >= 0) {
+      close(d.fd);
+      d.fd = -1;
+    }
+    d.ok = ok;
+    d.error = error;
+    if (ok) {
+      fprintf(stderr, "%s: done\n", d.address.c_str());
+      d.state = State::kDone;
+    } else if (!d.fatal && d.attempts <= options_.retries) {
+      fprintf(stderr, "%s: %s, retrying\n", d.address.c_str(), error.c_str());
+      d.state = State::kWaiting;
+      d.retryAt = now + std::chrono::milliseconds(kRetryDelayMs * d.attempts);
+    } else {
+      fprintf(stderr, "%s: failed: %s\n", d.address.c_str(), error.c_str());
+      d.state = State::kDone;
+    }
+  }
+};
+
+Device parseDevice(const std::string& address) {
+  Device d;
+  d.address = address;
+  d.host = address;
+  // host:port, but leave bare IPv6 addresses alone
+  size_t colon = address.rfind(':');
+  if (colon != std::string::npos && address.find(':') == colon) {
+    d.host = address.substr(0, colon);
+    d.port = address.substr(colon + 1);
+  }
+  if (d.host.size() > 2 && d.host.front() == '[' && d.host.back() == ']') {
+    d.host = d.host.substr(1, d.host.size() - 2);
+  }
+  return d;
+}
+
+void usage() {
+  fprintf(stderr,
+          "usage: fleet_push [--jobs N] [--mode firmware|filesystem] [--raw] [--user U --password P]\n"
+          "                  [--sha256 HEX] [--retries N] [--timeout S] [--devices FILE]\n"
+          "                  IMAGE [DEVICE...]\n");
+  exit(2);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  signal(SIGPIPE, SIG_IGN);
+  Options options;
+  std::vector<std::string> positional;
+  std::vector<Device> devices;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto value = [&]() -> std::string {
+      if (i + 1 >= argc) {
+        usage();
+      }
+      return argv[++i];
+    };
+    if (arg == "--jobs") {
+      options.jobs = std::max(1, atoi(value().c_str()));
+    } else if (arg == "--mode") {
+      options.mode = value();
+      if (options.mode != "firmware" && options.mode != "filesystem") {
+        usage();
+      }
+    } else if (arg == "--raw") {
+      options.raw = true;
+    } else if (arg == "--user") {
+      options.user = value();
+    } else if (arg == "--password") {
+      options.password = value();
+    } else if (arg == "--sha256") {
+      options.sha256 = value();
+    } else if (arg == "--retries") {
+      options.retries = std::max(0, atoi(value().c_str()));
+    } else if (arg == "--timeout") {
+      options.timeoutSec = std::max(1, atoi(value().c_str()));
+    } else if (arg == "--devices") {
+      std::ifstream in(value());
+      if (!in) {
+        fprintf(stderr, "fleet_push: cannot read device list\n");
+        return 2;
+      }
+      std::string line;
+      while (std::getline(in, line)) {
+        line = line.substr(0, line.find('#'));
+        line.erase(0, line.find_first_not_of(" \t\r"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        if (!line.empty()) {
+          devices.push_back(parseDevice(line));
+        }
+      }
+    } else if (arg.compare(0, 2, "--") == 0) {
+      usage();
+    } else {
+      positional.push_back(arg);
+    }
+  }
+  if (positional.empty()) {
+    usage();
+  }
+  for (size_t i = 1; i < positional.size(); i++) {
+    devices.push_back(parseDevice(positional[i]));
+  }
+  if (devices.empty()) {
+    usage();
+  }
+
+  std::ifstream file(positional[0], std::ios::binary);
+  if (!file) {
+    fprintf(stderr, "fleet_push: cannot read %s\n", positional[0].c_str());
+    return 2;
+  }
+  std::vector<uint8_t> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  std::string name = positional[0].substr(positional[0].find_last_of('/') + 1);
+
+  FleetPush push(options, name, std::move(image), std::move(devices));
+  push.run();
+  push.report();
+  return push.allOk() ? 0 : 1;
+}
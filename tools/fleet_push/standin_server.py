@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""Emulate a fleet of ESP32FwUploader devices for testing fleet_push.
+
+    python3 tools/fleet_push/standin_server.py --count 20 --base-port 9000 \\
+        [--user admin --password secret] [--rate-kbps 400] [--fail-rate 0.1]
+
+Each device listens on its own port (base-port .. base-port+count-1) and
+answers like the library: GET /update, POST /ota/upload with a multipart
+body and POST or PUT /ota/raw with the bare image, optional basic auth and an
+optional expected SHA-256 (sha256 argument or X-Firmware-SHA256 header). The response is "OK" or "FAIL". --rate-kbps
+throttles reading to mimic flash write speed; --fail-rate makes that share
+of uploads fail, to exercise retries.
+"""
+
+import argparse
+import base64
+import hashlib
+import random
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+
+class DeviceHandler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    options = None
+
+    def log_message(self, fmt, *args):
+        pass
+
+    def reply(self, code, body, headers=()):
+        data = body.encode()
+        self.send_response(code)
+        for name, value in headers:
+            self.send_header(name, value)
+        self.send_header("Content-Type", "text/plain")
+        self.send_header("Content-Length", str(len(data)))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.wfile.write(data)
+        self.close_connection = True
+
+    def authorized(self):
+        if not self.options.user:
+            return True
+        expected = base64.b64encode(("%s:%s" % (self.options.user, self.options.password)).encode()).decode()
+        return self.headers.get("Authorization", "") == "Basic " + expected
+
+    def do_GET(self):
+        if urlparse(self.path).path != "/update":
+            self.reply(404, "Not found")
+        elif not self.authorized():
+            self.reply(401, "", [("WWW-Authenticate", 'Basic realm="Login Required"')])
+        else:
+            self.reply(200, "<html>stand-in device</html>")
+
+    def do_POST(self):
+        url = urlparse(self.path)
+        if url.path not in ("/ota/upload", "/ota/raw"):
+            self.reply(404, "Not found")
+            return
+        # The library checks authentication before it reads the body
+        if not self.authorized():
+            self.reply(401, "", [("WWW-Authenticate", 'Basic realm="Login Required"')])
+            return
+        args = parse_qs(url.query)
+        length = int(self.headers.get("Content-Length", 0))
+        body = bytearray()
+        began = time.monotonic()
+        while len(body) < length:
+            chunk = self.rfile.read(min(4096, length - len(body)))
+            if not chunk:
+                return
+            body += chunk
+            if self.options.rate_kbps:
+                # Sleep until the throttled rate catches up
+                due = began + len(body) / 1024 / self.options.rate_kbps
+                delay = due - time.monotonic()
+                if delay > 0:
+                    time.sleep(delay)
+
+        image = bytes(body) if url.path == "/ota/raw" else self.extract_file(bytes(body))
+        mode = args.get("mode", ["firmware"])[0]
+        expected = args.get("sha256", [self.headers.get("X-Firmware-SHA256", "")])[0].lower()
+        ok = image is not None and len(image) > 0
+        if ok and expected and hashlib.sha256(image).hexdigest() != expected:
+            ok = False
+        if ok and random.random() < self.options.fail_rate:
+            ok = False
+        print("port %d: %s %s, %d bytes" % (self.server.server_port, mode, "OK" if ok else "FAIL",
+                                            len(image or b"")), flush=True)
+        self.reply(200, "OK" if ok else "FAIL")
+
+    def do_PUT(self):
+        if urlparse(self.path).path != "/ota/raw":
+            self.reply(404, "Not found")
+            return
+        self.do_POST()
+
+    def extract_file(self, body):
+        content_type = self.headers.get("Content-Type", "")
+        if "boundary=" not in content_type:
+            return None
+        boundary = b"--" + content_type.split("boundary=", 1)[1].strip('"').encode()
+        for part in body.split(boundary):
+            head, sep, data = part.partition(b"\r\n\r\n")
+            if sep and b"filename=" in head:
+                return data[:-2] if data.endswith(b"\r\n") else data
+        return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--count", type=int, default=10, help="number of devices")
+    parser.add_argument("--base-port", type=int, default=9000)
+    parser.add_argument("--user", default="")
+    parser.add_argument("--password", default="")
+    parser.add_argument("--rate-kbps", type=float, default=0, help="upload speed limit per device")
+    parser.add_argument("--fail-rate", type=float, default=0, help="share of uploads that fail")
+    DeviceHandler.options = parser.parse_args()
+    options = DeviceHandler.options
+
+    servers = []
+    for port in range(options.base_port, options.base_port + options.count):
+        server = ThreadingHTTPServer(("127.0.0.1", port), DeviceHandler)
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        servers.append(server)
+    print("%d stand-in devices on 127.0.0.1:%d-%d" % (options.count, options.base_port,
+                                                     options.base_port + options.count - 1), flush=True)
+    try:
+        while True:
+            time.sleep(3600)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Pack firmware and file system images into one ESP32FwUploader bundle.
+
+    python3 tools/make_bundle.py --firmware firmware.bin --filesystem littlefs.bin release.efwb
+
+Upload the bundle through /update or /ota/upload like a normal firmware
+file. The device writes each image to its partition as it streams in, checks
+it against the SHA-256 stored in the bundle and reboots once at the end, so
+a release that changes both the app and its files costs one upload and one
+reboot instead of two.
+
+Sections may be compressed (.gz) or delta patches, exactly as they would be
+uploaded on their own; with a signing key set on the device each section
+must be signed. The firmware section is always written first: the file
+system is overwritten in place, so it is only touched once the firmware has
+passed its checks, and a failure after that leaves the running firmware as
+the boot image.
+
+The bundle format is described in src/bundle.h.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+
+MAGIC = b"EFWB"
+VERSION = 1
+TYPE_FIRMWARE = 0
+TYPE_FILESYSTEM = 1
+
+
+def make_bundle(sections):
+    """sections: list of (type, data) in the order they are written."""
+    out = bytearray()
+    out += MAGIC
+    out += struct.pack("<II", VERSION, len(sections))
+    for kind, data in sections:
+        out += struct.pack("<II", kind, len(data))
+        out += hashlib.sha256(data).digest()
+    for _, data in sections:
+        out += data
+    return bytes(out)
+
+
+def read_bundle(bundle):
+    """Reference implementation of the device side, used to verify output."""
+    if bundle[:4] != MAGIC:
+        raise ValueError("not a bundle")
+    version, count = struct.unpack_from("<II", bundle, 4)
+    if version != VERSION:
+        raise ValueError("unsupported bundle version")
+    entries = []
+    p = 12
+    for _ in range(count):
+        kind, size = struct.unpack_from("<II", bundle, p)
+        entries.append((kind, size, bundle[p + 8:p + 40]))
+        p += 40
+    sections = []
+    for kind, size, digest in entries:
+        data = bundle[p:p + size]
+        if len(data) != size or hashlib.sha256(data).digest() != digest:
+            raise ValueError("section hash mismatch")
+        sections.append((kind, data))
+        p += size
+    if p != len(bundle):
+        raise ValueError("unexpected data after the last section")
+    return sections
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("output", help="bundle file to write")
+    parser.add_argument("--firmware", help="firmware image (.bin, .bin.gz or delta patch)")
+    parser.add_argument("--filesystem", help="file system image (.bin or .bin.gz)")
+    args = parser.parse_args()
+    if not args.firmware and not args.filesystem:
+        parser.error("give --firmware, --filesystem or both")
+
+    sections = []
+    for kind, path in ((TYPE_FIRMWARE, args.firmware), (TYPE_FILESYSTEM, args.filesystem)):
+        if path:
+            with open(path, "rb") as f:
+                data = f.read()
+            if not data:
+                sys.exit("make_bundle.py: %s is empty" % path)
+            sections.append((kind, data))
+
+    bundle = make_bundle(sections)
+    if read_bundle(bundle) != sections:
+        sys.exit("make_bundle.py: internal error, bundle does not unpack to its sections")
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    print("%s: %d bytes, %d sections" % (args.output, len(bundle), len(sections)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Create a delta (binary patch) OTA image for ESP32FwUploader.
+
+    python3 tools/make_delta.py running.bin new.bin update.patch.gz
+
+running.bin must be the exact firmware image the device is running; new.bin
+is the firmware to install. Upload the patch through /update or /ota/upload
+like a normal firmware file. The device applies it against its running app
+partition, checks the result against the SHA-256 of new.bin and refuses the
+update on any mismatch. The patch is gzip-compressed (the device inflates it
+on the fly); --no-gzip writes it raw.
+
+The patch format (see src/delta_patch.h) is a bsdiff-style sequence of
+(diff, extra, seek) records: diff bytes are added to source bytes, which
+keeps the patch small when code moves and embedded addresses shift: the diff
+runs are mostly zero bytes, which is why the patch is compressed.
+"""
+
+import argparse
+import gzip
+import hashlib
+import struct
+import sys
+
+MAGIC = b"EFWD"
+VERSION = 1
+KEY_LEN = 16       # bytes used to look up candidate matches
+INDEX_STEP = 4     # index every 4th source position
+MIN_MATCH = 32     # shorter matches are emitted as extra bytes
+MAX_MISS_RUN = 64  # stop extending once this many bytes pass without gain
+
+
+def build_index(old):
+    index = {}
+    for i in range(0, len(old) - KEY_LEN + 1, INDEX_STEP):
+        index.setdefault(old[i:i + KEY_LEN], i)
+    return index
+
+
+def extend(old, new, op, np_):
+    """Extend an approximate match forward, bsdiff style: keep the length that
+    maximizes 2 * matching bytes - length."""
+    best_len = 0
+    best_score = 0
+    matches = 0
+    i = 0
+    limit = min(len(old) - op, len(new) - np_)
+    while i < limit:
+        if old[op + i] == new[np_ + i]:
+            matches += 1
+        i += 1
+        score = 2 * matches - i
+        if score > best_score:
+            best_score = score
+            best_len = i
+        elif i - best_len > MAX_MISS_RUN:
+            break
+    return best_len
+
+
+def find_segments(old, new):
+    """Return a list of (old_pos, new_pos, length) diff segments in new order."""
+    index = build_index(old)
+    segments = []
+    np_ = 0
+    expected = None  # source position continuing the previous segment
+    while np_ < len(new) - KEY_LEN:
+        candidates = []
+        if expected is not None and 0 <= expected < len(old):
+            candidates.append(expected)
+        for back in range(INDEX_STEP):
+            key_pos = np_ + back
+            hit = index.get(new[key_pos:key_pos + KEY_LEN])
+            if hit is not None and hit - back >= 0:
+                candidates.append(hit - back)
+        best = (0, 0)
+        for op in candidates:
+            length = extend(old, new, op, np_)
+            if length > best[1]:
+                best = (op, length)
+        if best[1] >= MIN_MATCH:
+            segments.append((best[0], np_, best[1]))
+            np_ += best[1]
+            expected = best[0] + best[1]
+        else:
+            np_ += 1
+            if expected is not None:
+                expected += 1
+    return segments
+
+
+def make_patch(old, new):
+    segments = find_segments(old, new)
+    records = []
+    src = 0
+    pos = 0
+    # Leading bytes before the first match are an extra run of an empty record
+    if not segments or segments[0][1] > 0:
+        first_new = segments[0][1] if segments else len(new)
+        first_old = segments[0][0] if segments else 0
+        records.append((b"", new[:first_new], first_old))
+        src = first_old
+        pos = first_new
+    for k, (op, np_, length) in enumerate(segments):
+        assert op == src and np_ == pos
+        diff = bytes((new[np_ + i] - old[op + i]) & 0xFF for i in range(length))
+        next_new = segments[k + 1][1] if k + 1 < len(segments) else len(new)
+        next_old = segments[k + 1][0] if k + 1 < len(segments) else op + length
+        extra = new[np_ + length:next_new]
+        records.append((diff, extra, next_old - (op + length)))
+        src = next_old
+        pos = next_new
+
+    out = bytearray()
+    out += MAGIC
+    out += struct.pack("<III", VERSION, len(old), len(new))
+    out += hashlib.sha256(old).digest()
+    out += hashlib.sha256(new).digest()
+    for diff, extra, seek in records:
+        out += struct.pack("<IIi", len(diff), len(extra), seek)
+        out += diff
+        out += extra
+    return bytes(out)
+
+
+def apply_patch(old, patch):
+    """Reference implementation of the device side, used to verify output."""
+    if patch[:4] != MAGIC:
+        raise ValueError("not a delta patch")
+    version, src_size, dst_size = struct.unpack_from("<III", patch, 4)
+    if version != VERSION or src_size != len(old):
+        raise ValueError("patch does not match source")
+    if hashlib.sha256(old).digest() != patch[16:48]:
+        raise ValueError("source hash mismatch")
+    expected = patch[48:80]
+    p = 80
+    src = 0
+    out = bytearray()
+    while len(out) < dst_size:
+        diff_len, extra_len, seek = struct.unpack_from("<IIi", patch, p)
+        p += 12
+        for i in range(diff_len):
+            out.append((old[src + i] + patch[p + i]) & 0xFF)
+        p += diff_len
+        src += diff_len
+        out += patch[p:p + extra_len]
+        p += extra_len
+        src += seek
+        if src < 0 or src > len(old):
+            raise ValueError("seek outside source")
+    if p != len(patch) or hashlib.sha256(out).digest() != expected:
+        raise ValueError("patched image mismatch")
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", help="firmware image currently running on the device")
+    parser.add_argument("target", help="new firmware image")
+    parser.add_argument("output", help="patch file to write")
+    parser.add_argument("--no-gzip", action="store_true", help="do not gzip-compress the patch")
+    args = parser.parse_args()
+
+    with open(args.source, "rb") as f:
+        old = f.read()
+    with open(args.target, "rb") as f:
+        new = f.read()
+
+    patch = make_patch(old, new)
+    if apply_patch(old, patch) != new:
+        sys.exit("make_delta.py: internal error, patch does not reproduce the target")
+    if not args.no_gzip:
+        patch = gzip.compress(patch, compresslevel=9, mtime=0)
+    with open(args.output, "wb") as f:
+        f.write(patch)
+    print("%s: %d bytes (target %d bytes, %.1f%%)"
+          % (args.output, len(patch), len(new), 100.0 * len(patch) / max(len(new), 1)))
+
+
+if __name__ == "__main__":
+    main()
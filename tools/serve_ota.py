@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Serve OTA images for ESP32FwUploader pull updates.
+
+    python3 tools/serve_ota.py [--port 8000] [--drop-after BYTES] DIRECTORY
+
+Files in DIRECTORY are served over HTTP with Range support, so the device can
+resume an interrupted download. Trigger a pull with
+
+    curl -X POST "http://DEVICE/ota/pull?url=http://HOST:8000/firmware.bin&sha256=..."
+
+or call ESP32FwUploader.updateFromURL() from the sketch. Each transfer is
+logged with its throughput. --drop-after closes every connection after that
+many bytes of body, to exercise resuming.
+"""
+
+import argparse
+import os
+import re
+import time
+from http.server import SimpleHTTPRequestHandler, ThreadingHTTPServer
+
+CHUNK_SIZE = 8192
+
+
+class OtaHandler(SimpleHTTPRequestHandler):
+    drop_after = 0
+
+    def do_GET(self):
+        path = self.translate_path(self.path)
+        if not os.path.isfile(path):
+            self.send_error(404)
+            return
+        size = os.path.getsize(path)
+        start, end = 0, size - 1
+        match = re.fullmatch(r"bytes=(\d+)-(\d*)", self.headers.get("Range", ""))
+        if match:
+            start = int(match.group(1))
+            if match.group(2):
+                end = min(int(match.group(2)), size - 1)
+            if start > end:
+                self.send_response(416)
+                self.send_header("Content-Range", "bytes */%d" % size)
+                self.end_headers()
+                return
+            self.send_response(206)
+            self.send_header("Content-Range", "bytes %d-%d/%d" % (start, end, size))
+        else:
+            self.send_response(200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(end - start + 1))
+        self.send_header("Accept-Ranges", "bytes")
+        self.end_headers()
+
+        sent = 0
+        began = time.monotonic()
+        with open(path, "rb") as f:
+            f.seek(start)
+            remaining = end - start + 1
+            while remaining > 0:
+                n = min(CHUNK_SIZE, remaining)
+                if self.drop_after:
+                    n = min(n, self.drop_after - sent)
+                    if n <= 0:
+                        self.log_message("dropping connection after %d bytes", sent)
+                        self.close_connection = True
+                        break
+                data = f.read(n)
+                try:
+                    self.wfile.write(data)
+                except (BrokenPipeError, ConnectionResetError):
+                    break
+                sent += len(data)
+                remaining -= len(data)
+        elapsed = max(time.monotonic() - began, 1e-6)
+        self.log_message("sent bytes %d-%d of %d: %.1f KB/s",
+                         start, start + sent - 1, size, sent / 1024 / elapsed)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("directory", help="directory with the images to serve")
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--drop-after", type=int, default=0, metavar="BYTES",
+                        help="close each connection after BYTES of body")
+    args = parser.parse_args()
+
+    OtaHandler.drop_after = args.drop_after
+    handler = lambda *a, **kw: OtaHandler(*a, directory=args.directory, **kw)
+    server = ThreadingHTTPServer(("", args.port), handler)
+    print("Serving %s on port %d" % (os.path.abspath(args.directory), args.port))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
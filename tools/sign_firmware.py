@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Sign OTA images for ESP32FwUploader.setSigningKey().
+
+    python3 tools/sign_firmware.py genkey private.pem
+    python3 tools/sign_firmware.py sign --key private.pem firmware.bin firmware.signed.bin
+
+genkey creates an ECDSA P-256 key pair and prints the public key as a C
+string to pass to setSigningKey(). Keep private.pem off the device and out
+of version control.
+
+sign appends the signature trailer (see src/signature.h):
+
+    image | DER ECDSA signature of SHA-256(image) | signature length (u32 LE)
+
+Sign the file exactly as it will be uploaded: compress or make the delta
+patch first, then sign the result. The openssl command line tool is used for
+the cryptography.
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+
+def openssl(*args, data=None):
+    try:
+        result = subprocess.run(("openssl",) + args, input=data,
+                                stdout=subprocess.PIPE, stderr=subprocess.PIPE, check=True)
+    except FileNotFoundError:
+        sys.exit("sign_firmware.py: the openssl command line tool is required")
+    except subprocess.CalledProcessError as e:
+        sys.exit("sign_firmware.py: openssl %s failed:\n%s" % (args[0], e.stderr.decode(errors="replace")))
+    return result.stdout
+
+
+def public_key(private_key):
+    return openssl("pkey", "-in", private_key, "-pubout").decode()
+
+
+def print_c_string(pem):
+    print("const char* signingKey =")
+    lines = pem.strip().splitlines()
+    for i, line in enumerate(lines):
+        print('  "%s\\n"%s' % (line, ";" if i == len(lines) - 1 else ""))
+
+
+def genkey(args):
+    if os.path.exists(args.private_key):
+        sys.exit("sign_firmware.py: %s already exists" % args.private_key)
+    openssl("ecparam", "-name", "prime256v1", "-genkey", "-noout", "-out", args.private_key)
+    os.chmod(args.private_key, 0o600)
+    print_c_string(public_key(args.private_key))
+
+
+def sign(args):
+    with open(args.input, "rb") as f:
+        image = f.read()
+    signature = openssl("dgst", "-sha256", "-sign", args.key, data=image)
+
+    # Check the signature before writing, as the device will
+    with tempfile.TemporaryDirectory() as tmp:
+        pub = os.path.join(tmp, "public.pem")
+        sig = os.path.join(tmp, "signature.der")
+        with open(pub, "w") as f:
+            f.write(public_key(args.key))
+        with open(sig, "wb") as f:
+            f.write(signature)
+        openssl("dgst", "-sha256", "-verify", pub, "-signature", sig, data=image)
+
+    with open(args.output, "wb") as f:
+        f.write(image)
+        f.write(signature)
+        f.write(struct.pack("<I", len(signature)))
+    print("%s: %d bytes + %d byte signature" % (args.output, len(image), len(signature)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    p = commands.add_parser("genkey", help="create a signing key pair")
+    p.add_argument("private_key", help="private key file to create (PEM)")
+    p.set_defaults(func=genkey)
+
+    p = commands.add_parser("sign", help="append a signature to an image")
+    p.add_argument("--key", required=True, help="private key (PEM)")
+    p.add_argument("input", help="image to sign, as it will be uploaded")
+    p.add_argument("output", help="signed image to write")
+    p.set_defaults(func=sign)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
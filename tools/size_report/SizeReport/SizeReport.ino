@@ -0,0 +1,72 @@
+// Sketch built by tools/size_report/size_report.py: a headless node that
+// turns on every feature the library was built with, so each configuration
+// is measured in use. With -D SIZE_REPORT_BASELINE the library is left out
+// and only WiFi and the web server are built, the cost every sketch pays.
+
+#if defined(ESP8266)
+  #include <ESP8266WiFi.h>
+  #include <ESP8266WebServer.h>
+  ESP8266WebServer server(80);
+#else
+  #include <WiFi.h>
+  #include <WebServer.h>
+  WebServer server(80);
+#endif
+
+#if !defined(SIZE_REPORT_BASELINE)
+  #include <ESP32FwUploader.h>
+#endif
+
+#if !defined(SIZE_REPORT_BASELINE) && ESP32FW_FEATURE_SIGNING
+  // A throwaway key, only there so the signature check is built in use
+  static const char SIGNING_KEY[] =
+    "-----BEGIN PUBLIC KEY-----\n"
+    "MFkwEwYHKoZIzj0CAQYIKoZIzj0DAQcDQgAE8ZJC8VX05Irehy7bnDJavqHt0HsU\n"
+    "HlmyBdT4M2PVxhmV56GqHGfQlaEjbcMlQgI/aP+WkLJxGKN0ecebdRWbFQ==\n"
+    "-----END PUBLIC KEY-----\n";
+#endif
+
+void setup() {
+  Serial.begin(115200);
+  WiFi.begin("ssid", "password");
+
+#if !defined(SIZE_REPORT_BASELINE)
+  #if ESP32FW_FEATURE_AUTH
+    ESP32FwUploader.setAuth("admin", "password");
+  #endif
+  #if ESP32FW_FEATURE_EVENT_LOG
+    ESP32FwUploader.setDebug(true);
+  #endif
+  #if ESP32FW_FEATURE_CALLBACKS
+    ESP32FwUploader.onError([](ESP32Fw_Error error, const String& message) {
+      Serial.println(message);
+    });
+  #endif
+  #if ESP32FW_FEATURE_FILESYSTEM
+    #if defined(ESP8266)
+      LittleFS.begin();
+      ESP32FwUploader.setFileSystem(LittleFS);
+    #else
+      SPIFFS.begin();
+      ESP32FwUploader.setFileSystem(SPIFFS);
+    #endif
+  #endif
+  #if ESP32FW_FEATURE_ESPOTA
+    ESP32FwUploader.setEspOta(true);
+  #endif
+  #if ESP32FW_FEATURE_SIGNING
+    ESP32FwUploader.setSigningKey(SIGNING_KEY);
+  #endif
+  ESP32FwUploader.begin(&server);
+#else
+  server.on("/", []() { server.send(200, "text/plain", "OK"); });
+#endif
+  server.begin();
+}
+
+void loop() {
+  server.handleClient();
+#if !defined(SIZE_REPORT_BASELINE)
+  ESP32FwUploader.loop();
+#endif
+}
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Report the flash and RAM cost of ESP32FwUploader's compile-time features.
+
+    python3 tools/size_report/size_report.py
+    python3 tools/size_report/size_report.py --fqbn esp32:esp32:esp32 --additive
+
+Builds tools/size_report/SizeReport with arduino-cli once per feature
+combination and prints the program (flash) and global variable (RAM) size of
+each build, next to the difference from the full build:
+
+    baseline      WiFi and the web server only, without the library
+    full          every feature (the default build)
+    -FEATURE      everything except one feature: the difference is what
+                  that feature costs
+    minimal       every ESP32FW_FEATURE_* switch off
+    +FEATURE      (--additive) minimal plus one feature
+
+The default board is a generic ESP8266 module with 1 MB of flash and a 64 KB
+file system (eesz=1M64). There an update is written to the free space after
+the running sketch, so a sketch only updates itself while it fits twice into
+the sketch space: the "ota" column shows how much room is left for that. On
+ESP32 the column is the room left in the app partition.
+
+Needs arduino-cli with the esp8266 or esp32 core installed. Each build takes
+a while; --only limits the report to the named rows.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+SKETCH = os.path.join(os.path.dirname(os.path.abspath(__file__)), "SizeReport")
+
+# Switches from src/feature_flags.h, in the order they are listed there
+FEATURES = ["WEB_UI", "AUTH", "EVENT_LOG", "CALLBACKS", "FILESYSTEM", "PULL", "ESPOTA",
+            "SIGNING", "COMPRESSION", "DELTA"]
+
+SECTOR_SIZE = 4096
+
+
+def flag(feature, enabled):
+    return "-DESP32FW_FEATURE_%s=%d" % (feature, 1 if enabled else 0)
+
+
+def combinations(additive):
+    """(name, compiler flags) for every build in the report."""
+    rows = [("baseline", ["-DSIZE_REPORT_BASELINE"]), ("full", [])]
+    for feature in FEATURES:
+        rows.append(("-" + feature, [flag(feature, False)]))
+    rows.append(("minimal", [flag(f, False) for f in FEATURES]))
+    if additive:
+        for feature in FEATURES:
+            rows.append(("+" + feature, [flag(f, f == feature) for f in FEATURES]))
+    return rows
+
+
+def build(cli, fqbn, flags, build_path):
+    """Compile the sketch and return (flash, max flash, RAM) in bytes."""
+    extra = " ".join(flags)
+    command = [cli, "compile", "--fqbn", fqbn, "--library", ROOT, "--build-path", build_path,
+               "--build-property", "compiler.cpp.extra_flags=" + extra,
+               "--build-property", "compiler.c.extra_flags=" + extra,
+               SKETCH]
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError("build failed with " + (extra or "default flags"))
+    flash = re.search(r"Sketch uses (\d+) bytes.*?Maximum is (\d+) bytes", result.stdout)
+    ram = re.search(r"Global variables use (\d+) bytes", result.stdout)
+    if not flash or not ram:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError("no size summary in the arduino-cli output")
+    return int(flash.group(1)), int(flash.group(2)), int(ram.group(1))
+
+
+def ota_room(fqbn, flash, maximum):
+    if fqbn.startswith("esp8266:"):
+        # The new sketch is staged behind the running one, both sector aligned
+        aligned = (flash + SECTOR_SIZE - 1) // SECTOR_SIZE * SECTOR_SIZE
+        return maximum - 2 * aligned
+    return maximum - flash
+
+
+def signed(value):
+    return "%+d" % value if value else "0"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--fqbn", default="esp8266:esp8266:generic:eesz=1M64",
+                        help="board to build for (default: 1 MB ESP8266 module)")
+    parser.add_argument("--arduino-cli", default="arduino-cli", help="arduino-cli executable")
+    parser.add_argument("--additive", action="store_true", help="also build minimal plus each feature")
+    parser.add_argument("--only", nargs="+", metavar="ROW", help="build only these rows (e.g. full minimal -WEB_UI)")
+    args = parser.parse_args()
+
+    if not shutil.which(args.arduino_cli):
+        parser.error("%s not found; install arduino-cli or pass --arduino-cli" % args.arduino_cli)
+
+    rows = combinations(args.additive)
+    if args.only:
+        rows = [row for row in rows if row[0] in args.only]
+    results = []
+    build_root = tempfile.mkdtemp(prefix="esp32fw-size-")
+    try:
+        for name, flags in rows:
+            sys.stderr.write("building %s...\n" % name)
+            build_path = os.path.join(build_root, re.sub(r"\W", "_", name))
+            results.append((name,) + build(args.arduino_cli, args.fqbn, flags, build_path))
+    finally:
+        shutil.rmtree(build_root, ignore_errors=True)
+
+    full = next((r for r in results if r[0] == "full"), None)
+    print("%s" % args.fqbn)
+    print("%-12s %9s %9s %12s %10s %9s" % ("build", "flash", "ram", "flash/full", "ram/full", "ota"))
+    for name, flash, maximum, ram in results:
+        flash_diff = signed(flash - full[1]) if full else "-"
+        ram_diff = signed(ram - full[3]) if full else "-"
+        print("%-12s %9d %9d %12s %10s %9d" % (name, flash, ram, flash_diff, ram_diff, ota_room(args.fqbn, flash, maximum)))
+
+
+if __name__ == "__main__":
+    main()